@@ -1,62 +1,63 @@
 #include "action.h"
 #include "error.h"
-#include "msort.h"
 #include "rule.h"
+#include "state.h"
 #include "symbol.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 
-static void *action_list_get_next(void const *list);
-static void action_list_set_next(void *list, void *next);
-static int action_list_compare(void const *left, void const *right);
-
-struct action_list *
-action_list_insert(struct action *action, struct action_list **list) {
-  struct action_list *new_list = (struct action_list *)malloc(sizeof(struct action_list));
-  new_list->item = action;
-  new_list->next = *list;
-  *list = new_list;
-  return new_list;
-}
-
-void
-action_list_sort(struct action_list **list) {
-  *list = mergesort(*list, action_list_get_next, action_list_set_next, action_list_compare);
-}
+static int action_compare(void const *left, void const *right);
 
+/* Append a new action to the actions of a state and return it.  The
+ * pointer is good until the next action is added to the same state.
+ */
 struct action *
-make_action(struct symbol *symbol, enum action_type type, void *arg) {
-  struct action *new_action = malloc(sizeof(struct action));
-  MemoryCheck(new_action);
+action_add(struct state *stp, struct symbol *symbol, enum action_type type, void *arg) {
+  struct action *new_action;
+  if (stp->nAction >= stp->nActionAlloc) {
+    stp->nActionAlloc = stp->nActionAlloc * 2 + 8;
+    stp->actions = (struct action *)realloc(stp->actions, sizeof(stp->actions[0]) * stp->nActionAlloc);
+    MemoryCheck(stp->actions);
+  }
+  new_action = &stp->actions[stp->nAction++];
   new_action->sp = symbol;
   new_action->type = type;
-  if (type == SHIFT)
+  if (action_holds_state(type))
     new_action->x.stp = (struct state *)arg;
   else
     new_action->x.rp = (struct rule *)arg;
+  return new_action;
 }
 
-static void *
-action_list_get_next(void const *list) {
-  return ((struct action_list const *)list)->next;
+/* Sort the actions of a state by look-ahead symbol, and the actions on
+ * the same symbol by type, so that shifts come before reduces.
+ */
+void
+action_sort(struct state *stp) {
+  if (stp->nAction > 1)
+    qsort(stp->actions, (size_t)stp->nAction, sizeof(stp->actions[0]), action_compare);
 }
 
-static void
-action_list_set_next(void *list, void *next) {
-  ((struct action_list *)list)->next = next;
+/* Return true if an action of the given type holds a state in x.stp.
+ * Every other one holds a rule, or nothing.  An ERROR action is a shift
+ * undone by non-associativity.
+ */
+int
+action_holds_state(enum action_type type) {
+  return type == SHIFT || type == SSCONFLICT || type == SH_RESOLVED || type == ERROR;
 }
 
 static int
-action_list_compare(void const *left, void const *right) {
-  struct action *la = ((struct action_list *)left)->item;
-  struct action *ra = ((struct action_list *)right)->item;
+action_compare(void const *left, void const *right) {
+  struct action const *la = (struct action const *)left;
+  struct action const *ra = (struct action const *)right;
   int rc = la->sp->index - ra->sp->index;
   if (rc == 0)
     rc = (int)la->type - (int)ra->type;
-  if (rc == 0 && la->type == REDUCE)
+  if (rc == 0 && action_holds_state(la->type))
+    rc = la->x.stp->statenum - ra->x.stp->statenum;
+  else if (rc == 0 && la->x.rp && ra->x.rp)
     rc = la->x.rp->index - ra->x.rp->index;
-  if (rc == 0)
-    rc = (int)(ra - la);
   return rc;
 }
@@ -4,10 +4,6 @@
 /*
  * Routines processing parser actions in the LEMON parser generator.
  */
-struct action_list {
-  struct action *item;
-  struct action_list *next;
-};
 
 enum action_type {
   SHIFT,
@@ -22,7 +18,9 @@ enum action_type {
   NOT_USED     // Deleted by compression
 };
 
-/* Every shift or reduce operation is stored as one of the following */
+/* Every shift or reduce operation is stored as one of the following,
+ * packed one after another in the actions[] array of its state
+ */
 struct action {
   struct symbol *sp; // The look-ahead symbol
   enum action_type type;
@@ -32,9 +30,10 @@ struct action {
   } x;
 };
 
-struct action_list *action_list_insert(struct action *action, struct action_list **list);
-void action_list_sort(struct action_list **list);
+struct state;
 
-struct action *make_action(struct symbol *symbol, enum action_type type, void *arg);
+struct action *action_add(struct state *stp, struct symbol *symbol, enum action_type type, void *arg);
+void action_sort(struct state *stp);
+int action_holds_state(enum action_type type);
 
 #endif //_LEMON_ACTION_H_
@@ -11,9 +11,39 @@ void
 acttab_free(struct acttab *p) {
   free(p->aAction);
   free(p->aLookahead);
+  free(p->aOfstUse);
   free(p);
 }
 
+/* Return the number of entries of aAction[] inserted at offset ofst */
+static int
+ofst_use(struct acttab *p, int ofst) {
+  ofst -= p->mnOfst;
+  return ofst >= 0 && ofst < p->nOfstUse ? p->aOfstUse[ofst] : 0;
+}
+
+/* Count one more entry inserted at offset ofst */
+static void
+ofst_add(struct acttab *p, int ofst) {
+  if (p->nOfstUse == 0)
+    p->mnOfst = ofst;
+  if (ofst < p->mnOfst || ofst >= p->mnOfst + p->nOfstUse) {
+    int mn = ofst < p->mnOfst ? ofst : p->mnOfst;
+    int mx = ofst >= p->mnOfst + p->nOfstUse ? ofst + 1 : p->mnOfst + p->nOfstUse;
+    int n = (mx - mn) * 2 + 32; // Room to grow both ways
+    int *aNew = (int *)calloc((size_t)n, sizeof(int));
+    MemoryCheck(aNew);
+    mn -= (n - (mx - mn)) / 2;
+    if (p->nOfstUse > 0)
+      memcpy(&aNew[p->mnOfst - mn], p->aOfstUse, sizeof(int) * p->nOfstUse);
+    free(p->aOfstUse);
+    p->aOfstUse = aNew;
+    p->mnOfst = mn;
+    p->nOfstUse = n;
+  }
+  p->aOfstUse[ofst - p->mnOfst]++;
+}
+
 /* Allocate a new acttab structure */
 struct acttab *
 acttab_alloc(void) {
@@ -61,6 +91,7 @@ acttab_action(struct acttab *p, int lookahead, int action) {
 int
 acttab_insert(struct acttab *p) {
   int i, j, k, n;
+  int isDup; // True if the set is already in the table
   assert(p->nLookahead > 0);
 
   /* Make sure we have enough space to hold the expanded action table
@@ -107,14 +138,7 @@ acttab_insert(struct acttab *p) {
       /* No possible lookahead value that is not in the aLookahead[]
        * transaction is allowed to match aAction[i]
        */
-      n = 0;
-      for (j = 0; j < p->nAction; j++) {
-        if (p->aAction[j].lookahead < 0)
-          continue;
-        if (p->aAction[j].lookahead == j + p->mnLookahead - i)
-          n++;
-      }
-      if (n == p->nLookahead) {
+      if (ofst_use(p, i - p->mnLookahead) == p->nLookahead) {
         break; // An exact match is found at offset i
       }
     }
@@ -124,7 +148,8 @@ acttab_insert(struct acttab *p) {
    * an empty offset in the aAction[] table in which we can add the
    * aLookahead[] transaction.
    */
-  if (i < 0) {
+  isDup = i >= 0;
+  if (!isDup) {
     /* Look for holes in the aAction[] table that fit the current
      * aLookahead[] transaction.  Leave i set to the offset of the hole.
      * If no holes are found, i is left at p->nAction, which means the
@@ -141,22 +166,28 @@ acttab_insert(struct acttab *p) {
         }
         if (j < p->nLookahead)
           continue;
-        for (j = 0; j < p->nAction; j++) {
-          if (p->aAction[j].lookahead == j + p->mnLookahead - i)
-            break;
-        }
-        if (j == p->nAction) {
+        /* The offset must not be in use.  An empty slot just below it
+         * has always counted as a use too, as its lookahead of -1 is
+         * one less than the offset, and is kept so for the same tables.
+         */
+        k = i - p->mnLookahead - 1;
+        if (k >= 0 && k < p->nAction && p->aAction[k].lookahead < 0)
+          continue;
+        if (ofst_use(p, i - p->mnLookahead) == 0) {
           break; // Fits in empty slots
         }
       }
     }
   }
-  /* Insert transaction set at index i. */
-  for (j = 0; j < p->nLookahead; j++) {
-    k = p->aLookahead[j].lookahead - p->mnLookahead + i;
-    p->aAction[k] = p->aLookahead[j];
-    if (k >= p->nAction)
-      p->nAction = k + 1;
+  /* Insert transaction set at index i, unless it is already there. */
+  if (!isDup) {
+    for (j = 0; j < p->nLookahead; j++) {
+      k = p->aLookahead[j].lookahead - p->mnLookahead + i;
+      p->aAction[k] = p->aLookahead[j];
+      ofst_add(p, i - p->mnLookahead);
+      if (k >= p->nAction)
+        p->nAction = k + 1;
+    }
   }
   p->nLookahead = 0;
 
@@ -165,3 +196,22 @@ acttab_insert(struct acttab *p) {
    */
   return i - p->mnLookahead;
 }
+
+/* Take the transaction set built up with prior calls to acttab_action()
+ * instead of inserting it, so that it can be inserted later, maybe into
+ * another table.  The set is reset as by acttab_insert().
+ *
+ * Return the number of actions, whose array is left in *paAction for the
+ * caller to free, and the span of their lookaheads in *pnSpan.
+ */
+int
+acttab_take(struct acttab *p, struct lookahead_action **paAction, int *pnSpan) {
+  int n = p->nLookahead;
+  assert(n > 0);
+  *paAction = (struct lookahead_action *)malloc(sizeof(p->aLookahead[0]) * n);
+  MemoryCheck(*paAction);
+  memcpy(*paAction, p->aLookahead, sizeof(p->aLookahead[0]) * n);
+  *pnSpan = p->mxLookahead - p->mnLookahead + 1;
+  p->nLookahead = 0;
+  return n;
+}
@@ -40,6 +40,9 @@ struct acttab {
   int mxLookahead;                  // Maximum aLookahead[].lookahead
   int nLookahead;                   // Used slots in aLookahead[]
   int nLookaheadAlloc;              // Slots allocated in aLookahead[]
+  int *aOfstUse;                    // Entries of aAction[] inserted at each offset
+  int mnOfst;                       // Offset counted by aOfstUse[0]
+  int nOfstUse;                     // Slots allocated in aOfstUse[]
 };
 
 /* Return the number of entries in the yy_action table */
@@ -55,5 +58,6 @@ struct acttab *acttab_alloc(void);
 void acttab_free(struct acttab *);
 void acttab_action(struct acttab *, int, int);
 int acttab_insert(struct acttab *);
+int acttab_take(struct acttab *, struct lookahead_action **, int *);
 
 #endif //_LEMON_ACTTAB_H_
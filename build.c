@@ -1,6 +1,8 @@
 #include "action.h"
 #include "config.h"
 #include "error.h"
+#include "grammar.h"
+#include "hash.h"
 #include "lemon.h"
 #include "rule.h"
 #include "set.h"
@@ -9,19 +11,35 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 
 /* forward declarations */
 static void buildshifts(struct lemon *, struct state *);
-static struct state *get_state(struct lemon *, struct config_list **basis);
+static struct state *get_state(struct lemon *, struct config **basis, int nBasis, unsigned int hash);
 static int resolve_conflict(struct action *, struct action *);
 static int same_symbol(struct symbol *, struct symbol *);
-static void check_config_list(struct lemon *lemp, struct config_list *list);
+static void check_basis(struct lemon *lemp, struct config **basis, int nBasis);
+
+/* A nonterminal the walk over the first sets is in */
+struct first_frame {
+  int iSym;    // The nonterminal
+  int iRuleOf; // Its rule the walk is in, as an offset in aRuleOf[]
+  int iRhs;    // The next RHS symbol of the rule in aRhs[], or -1 for its first
+};
+
+static int next_first_edge(struct lemon *, struct first_frame *);
+
+/* A configuration the walk over the propagation links is in */
+struct follow_frame {
+  int iConfig;             // The number of the configuration
+  struct config_list *plp; // Its next link to walk
+};
 
 /* Compute the reduce actions, and resolve conflicts. */
 void
 FindActions(struct lemon *lemp) {
-  int i, j;
-  struct config_list *cfp;
+  int i, j, k;
+  struct config *cfp;
   struct symbol *sp;
   struct rule_list *rp;
 
@@ -32,14 +50,14 @@ FindActions(struct lemon *lemp) {
   for (i = 0; i < lemp->nstate; i++) { /* Loop over all states */
     struct state *stp;
     stp = lemp->sorted[i];
-    for (cfp = stp->configs; cfp; cfp = cfp->next) { /* Loop over all configurations */
-      if (cfp->item->rule->nrhs == cfp->item->position) {   /* Is dot at extreme right? */
+    for (k = 0; k < stp->nConfig; k++) { /* Loop over all configurations */
+      cfp = stp->configs[k];
+      if (cfp->rule->nrhs == cfp->position && cfp->fws) { /* Is dot at extreme right? */
         for (j = 0; j < lemp->nterminal; j++) {
-          if (SetFind(cfp->item->fws, j)) {
+          if (SetFind(cfp->fws, j)) {
             /* Add a reduce action to the state "stp" which will reduce by the
-             * rule "cfp->rp" if the lookahead symbol is "lemp->symbols[j]" */
-            action_list_insert(make_action(lemp->symbols[j], REDUCE, cfp->item->rule), &stp->actions);
-            // TODO: check rewrite Action_add(&stp->ap, REDUCE, lemp->symbols[j], (char *)cfp->rp);
+             * rule "cfp->rule" if the lookahead symbol is "lemp->symbols[j]" */
+            action_add(stp, lemp->symbols[j], REDUCE, cfp->rule);
           }
         }
       }
@@ -48,7 +66,7 @@ FindActions(struct lemon *lemp) {
 
   /* Add the accepting token */
   if (lemp->start) {
-    sp = lookup_symbol(lemp->start);
+    sp = lookup_symbol(lemp, lemp->start);
     if (sp == 0)
       sp = lemp->rules->item->lhs;
   } else {
@@ -58,33 +76,38 @@ FindActions(struct lemon *lemp) {
    * finite state machine) an action to ACCEPT if the lookahead is the
    * start nonterminal.
    */
-  action_list_insert(make_action(sp, ACCEPT, 0), &lemp->sorted[0]->actions);
-  // TODO: check rewrite Action_add(&lemp->sorted[0]->ap, ACCEPT, sp, 0);
+  action_add(lemp->sorted[0], sp, ACCEPT, 0);
 
   /* Resolve conflicts */
   for (i = 0; i < lemp->nstate; i++) {
-    struct action_list *ap, *nap;
+    struct action *ap, *nap, *end;
     struct state *stp;
     stp = lemp->sorted[i];
-    action_list_sort(&stp->actions);
-    for (ap = stp->actions; ap && ap->next; ap = ap->next) {
-      for (nap = ap->next; nap && nap->item->sp == ap->item->sp; nap = nap->next) {
-        /* The two actions "ap->item" and "nap->item" have the same lookahead.
+    action_sort(stp);
+    end = stp->actions + stp->nAction;
+    for (ap = stp->actions; ap < end; ap++) {
+      for (nap = ap + 1; nap < end && nap->sp == ap->sp; nap++) {
+        /* The two actions "ap" and "nap" have the same lookahead.
          * Figure out which one should be used
          */
-        lemp->nconflict += resolve_conflict(ap->item, nap->item);
+        lemp->nconflict += resolve_conflict(ap, nap);
       }
     }
   }
 
-  /* Report an error for each rule that can never be reduced. */
+  /* Report an error for each rule that can never be reduced.  The GLR
+   * driver also reduces by the losing side of an unresolved conflict.
+   */
   for (rp = lemp->rules; rp; rp = rp->next)
     rp->item->canReduce = false;
   for (i = 0; i < lemp->nstate; i++) {
-    struct action_list *ap;
-    for (ap = lemp->sorted[i]->actions; ap; ap = ap->next) {
-      if (ap->item->type == REDUCE)
-        ap->item->x.rp->canReduce = true;
+    struct state *stp = lemp->sorted[i];
+    for (j = 0; j < stp->nAction; j++) {
+      struct action *ap = &stp->actions[j];
+      if (ap->type == REDUCE)
+        ap->x.rp->canReduce = true;
+      else if (lemp->glr && (ap->type == SRCONFLICT || ap->type == RRCONFLICT))
+        ap->x.rp->canReduce = true;
     }
   }
   for (rp = lemp->rules; rp; rp = rp->next) {
@@ -98,112 +121,355 @@ FindActions(struct lemon *lemp) {
  * Then go back and compute the first sets of every nonterminal.
  * The first set is the set of all terminal symbols which can begin
  * a string generated by that nonterminal.
+ *
+ * A nonterminal is found to generate the empty string once every RHS
+ * symbol of one of its rules is, so each rule counts the symbols it
+ * still waits for, and only the rules that use a symbol are visited
+ * when it is found.
+ *
+ * The first set of a nonterminal takes in the first sets of the
+ * nonterminals that can begin its rules.  These form a graph, walked
+ * depth first so that every first set is done before the first sets
+ * that take it in.  The nonterminals of a cycle, such as one of left
+ * recursion, all end up with the same first set, which is gathered
+ * once the walk leaves the cycle.
  */
 void
 FindFirstSets(struct lemon *lemp) {
-  int i, j;
-  struct rule_list *rp;
-  int progress;
-
-  for (i = 0; i < lemp->nsymbol; i++) {
-    lemp->symbols[i]->lambda = false;
+  struct grammar *g = lemp->grammar;
+  int i, j, k, n;
+  int nnt = lemp->nsymbol - lemp->nterminal;
+  int *aWait;                 // RHS symbols each rule waits for to be lambda
+  int *aFirstUse, *aUse;      // The rules that use each nonterminal
+  struct first_frame *aFrame; // The nonterminals the walk is in
+  int *aOrder, *aLow;         // When the walk came to each, and how far back it reaches
+  int *aCycle;                // The nonterminals whose cycle is not done
+  bool *aOnCycle;             // True if the nonterminal is in aCycle[]
+  int nFrame, nCycle;
+
+  for (i = 0; i < g->nsymbol; i++) {
+    g->aLambda[i] = false;
   }
   for (i = lemp->nterminal; i < lemp->nsymbol; i++) {
-    lemp->symbols[i]->firstset = SetNew();
+    g->aFirstset[i] = SetNew(lemp);
   }
 
-  /* First compute all lambdas */
-  do {
-    progress = 0;
-    for (rp = lemp->rules; rp; rp = rp->next) {
-      if (rp->item->lhs->lambda)
-        continue;
-      for (i = 0; i < rp->item->nrhs; i++) {
-        struct symbol *sp = rp->item->rhs[i];
-        assert(sp->type == NONTERMINAL || sp->lambda == false);
-        if (sp->lambda == false)
-          break;
+  aWait = (int *)calloc((size_t)g->nrule + 1, sizeof(aWait[0]));
+  aFirstUse = (int *)calloc((size_t)nnt + 1, sizeof(aFirstUse[0]));
+  aFrame = (struct first_frame *)calloc((size_t)nnt + 1, sizeof(aFrame[0]));
+  aOrder = (int *)calloc((size_t)nnt + 1, sizeof(aOrder[0]));
+  aLow = (int *)calloc((size_t)nnt + 1, sizeof(aLow[0]));
+  aCycle = (int *)calloc((size_t)nnt + 1, sizeof(aCycle[0]));
+  aOnCycle = (bool *)calloc((size_t)nnt + 1, sizeof(aOnCycle[0]));
+  MemoryCheck(aWait);
+  MemoryCheck(aFirstUse);
+  MemoryCheck(aFrame);
+  MemoryCheck(aOrder);
+  MemoryCheck(aLow);
+  MemoryCheck(aCycle);
+  MemoryCheck(aOnCycle);
+
+  /* List the rules that use each nonterminal, once for every use */
+  n = 0;
+  for (i = 0; i < g->nrule; i++) {
+    aWait[i] = g->aRhsStart[i + 1] - g->aRhsStart[i];
+    for (j = g->aRhsStart[i]; j < g->aRhsStart[i + 1]; j++) {
+      if (g->aType[g->aRhs[j]] == NONTERMINAL) {
+        aFirstUse[g->aRhs[j] - lemp->nterminal + 1]++;
+        n++;
+      }
+    }
+  }
+  for (i = 0; i < nnt; i++)
+    aFirstUse[i + 1] += aFirstUse[i];
+  aUse = (int *)malloc(sizeof(aUse[0]) * (n > 0 ? n : 1));
+  MemoryCheck(aUse);
+  for (i = 0; i < g->nrule; i++) {
+    for (j = g->aRhsStart[i]; j < g->aRhsStart[i + 1]; j++) {
+      if (g->aType[g->aRhs[j]] == NONTERMINAL) {
+        k = g->aRhs[j] - lemp->nterminal;
+        aUse[aFirstUse[k] + aOrder[k]++] = i; // aOrder[] counts the uses listed so far
       }
-      if (i == rp->item->nrhs) {
-        rp->item->lhs->lambda = true;
-        progress = 1;
+    }
+  }
+
+  /* First compute all lambdas, starting from the empty rules.  The
+   * nonterminals found but not yet passed on to the rules that use them
+   * wait in aCycle[].
+   */
+  nCycle = 0;
+  for (i = 0; i < g->nrule; i++) {
+    if (aWait[i] == 0 && g->aLambda[g->aLhs[i]] == false) {
+      g->aLambda[g->aLhs[i]] = true;
+      aCycle[nCycle++] = g->aLhs[i];
+    }
+  }
+  while (nCycle > 0) {
+    k = aCycle[--nCycle] - lemp->nterminal;
+    for (j = aFirstUse[k]; j < aFirstUse[k + 1]; j++) {
+      int r = aUse[j];
+      assert(aWait[r] > 0);
+      if (--aWait[r] == 0 && g->aLambda[g->aLhs[r]] == false) {
+        g->aLambda[g->aLhs[r]] = true;
+        aCycle[nCycle++] = g->aLhs[r];
       }
     }
-  } while (progress);
+  }
 
   /* Now compute all first sets */
-  do {
-    struct symbol *s1, *s2;
-    progress = 0;
-    for (rp = lemp->rules; rp; rp = rp->next) {
-      s1 = rp->item->lhs;
-      for (i = 0; i < rp->item->nrhs; i++) {
-        s2 = rp->item->rhs[i];
-        if (s2->type == TERMINAL) {
-          progress += SetAdd(s1->firstset, s2->index);
-          break;
-        } else if (s2->type == MULTITERMINAL) {
-          for (j = 0; j < s2->nsubsym; j++) {
-            progress += SetAdd(s1->firstset, s2->subsym[j]->index);
-          }
-          break;
-        } else if (s1 == s2) {
-          if (s1->lambda == false)
-            break;
+  memset(aOrder, 0, sizeof(aOrder[0]) * (nnt + 1));
+  n = 0;
+  for (i = 0; i < nnt; i++) {
+    if (aOrder[i])
+      continue;
+    aOrder[i] = aLow[i] = ++n;
+    aCycle[nCycle++] = i;
+    aOnCycle[i] = true;
+    aFrame[0].iSym = lemp->nterminal + i;
+    aFrame[0].iRuleOf = g->aRuleStart[aFrame[0].iSym];
+    aFrame[0].iRhs = -1;
+    nFrame = 1;
+    while (nFrame > 0) {
+      struct first_frame *fp = &aFrame[nFrame - 1];
+      int s2 = next_first_edge(lemp, fp);
+      int up = fp->iSym - lemp->nterminal;
+      if (s2 >= 0) {
+        k = s2 - lemp->nterminal;
+        if (aOrder[k] == 0) {
+          aOrder[k] = aLow[k] = ++n;
+          aCycle[nCycle++] = k;
+          aOnCycle[k] = true;
+          fp = &aFrame[nFrame++];
+          fp->iSym = s2;
+          fp->iRuleOf = g->aRuleStart[s2];
+          fp->iRhs = -1;
+        } else if (aOnCycle[k]) {
+          if (aOrder[k] < aLow[up])
+            aLow[up] = aOrder[k];
         } else {
-          progress += SetUnion(s1->firstset, s2->firstset);
-          if (s2->lambda == false)
-            break;
+          SetUnion(lemp, g->aFirstset[fp->iSym], g->aFirstset[s2]);
+        }
+        continue;
+      }
+
+      /* The walk leaves this nonterminal.  If it is the first one of a
+       * cycle, the cycle is done, and every nonterminal in it gets all
+       * of the first sets of the others.
+       */
+      if (aLow[up] == aOrder[up]) {
+        for (j = nCycle - 1; aCycle[j] != up; j--)
+          SetUnion(lemp, g->aFirstset[fp->iSym], g->aFirstset[lemp->nterminal + aCycle[j]]);
+        for (j = nCycle - 1; aCycle[j] != up; j--)
+          SetUnion(lemp, g->aFirstset[lemp->nterminal + aCycle[j]], g->aFirstset[fp->iSym]);
+        while (aCycle[--nCycle] != up)
+          aOnCycle[aCycle[nCycle]] = false;
+        aOnCycle[up] = false;
+      }
+      nFrame--;
+      if (nFrame > 0) {
+        int s1 = aFrame[nFrame - 1].iSym;
+        k = s1 - lemp->nterminal;
+        if (aOnCycle[up]) {
+          if (aLow[up] < aLow[k])
+            aLow[k] = aLow[up];
+        } else {
+          SetUnion(lemp, g->aFirstset[s1], g->aFirstset[fp->iSym]);
         }
       }
     }
-  } while (progress);
-  return;
+  }
+
+  free(aOnCycle);
+  free(aCycle);
+  free(aLow);
+  free(aOrder);
+  free(aFrame);
+  free(aUse);
+  free(aFirstUse);
+  free(aWait);
 }
 
 /* Compute all followsets.
  *
  * A followset is the set of all symbols which can come immediately
  * after a configuration.
+ *
+ * The propagation links are walked once, and each cycle of links is
+ * merged into one set that is passed on along the links that leave it,
+ * before the configurations those links reach are looked at.  Only the
+ * configurations with the dot at the end are used by FindActions(), so
+ * every other one gives up its set once it has passed it on.  The first
+ * configuration it reaches that has no set yet takes it over.
  */
 void
 FindFollowSets(struct lemon *lemp) {
-  int i;
-  struct config_list *cfp;
+  int i, j, k, n;
+  struct config *cfp;
   struct config_list *plp;
-  int progress;
-  int change;
-
+  struct config **aConfig;     // Every configuration, by number
+  struct follow_frame *aFrame; // The configurations the walk is in
+  int *aOrder, *aLow;          // When the walk came to each, and how far back it reaches
+  int *aCycle;                 // The configurations whose cycle is not done
+  int *aGroup;                 // The cycle of every configuration, or -1 if not done
+  int *aMember, *aGroupStart;  // The configurations of every cycle, one cycle after another
+  int nConfig, nFrame, nCycle, nGroup, nMember;
+
+  nConfig = 0;
   for (i = 0; i < lemp->nstate; i++) {
-    for (cfp = lemp->sorted[i]->configs; cfp; cfp = cfp->next) {
-      cfp->item->status = INCOMPLETE;
+    for (j = 0; j < lemp->sorted[i]->nConfig; j++) {
+      lemp->sorted[i]->configs[j]->status = INCOMPLETE;
+    }
+    nConfig += lemp->sorted[i]->nConfig;
+  }
+  aConfig = (struct config **)calloc((size_t)nConfig + 1, sizeof(aConfig[0]));
+  aFrame = (struct follow_frame *)calloc((size_t)nConfig + 1, sizeof(aFrame[0]));
+  aOrder = (int *)calloc((size_t)nConfig + 1, sizeof(aOrder[0]));
+  aLow = (int *)calloc((size_t)nConfig + 1, sizeof(aLow[0]));
+  aCycle = (int *)calloc((size_t)nConfig + 1, sizeof(aCycle[0]));
+  aGroup = (int *)calloc((size_t)nConfig + 1, sizeof(aGroup[0]));
+  aMember = (int *)calloc((size_t)nConfig + 1, sizeof(aMember[0]));
+  aGroupStart = (int *)calloc((size_t)nConfig + 1, sizeof(aGroupStart[0]));
+  MemoryCheck(aConfig);
+  MemoryCheck(aFrame);
+  MemoryCheck(aOrder);
+  MemoryCheck(aLow);
+  MemoryCheck(aCycle);
+  MemoryCheck(aGroup);
+  MemoryCheck(aMember);
+  MemoryCheck(aGroupStart);
+
+  /* Number the configurations */
+  nConfig = 0;
+  for (i = 0; i < lemp->nstate; i++) {
+    for (j = 0; j < lemp->sorted[i]->nConfig; j++) {
+      cfp = lemp->sorted[i]->configs[j];
+      if (cfp->status == COMPLETE)
+        continue;
+      cfp->status = COMPLETE;
+      cfp->index = nConfig;
+      aGroup[nConfig] = -1;
+      aConfig[nConfig++] = cfp;
+    }
+  }
+
+  /* Walk the propagation links.  A cycle is done when the walk leaves
+   * the first configuration of it, and all cycles reached from it are
+   * done before.
+   */
+  n = nCycle = nGroup = nMember = 0;
+  for (i = 0; i < nConfig; i++) {
+    if (aOrder[i])
+      continue;
+    aOrder[i] = aLow[i] = ++n;
+    aCycle[nCycle++] = i;
+    aFrame[0].iConfig = i;
+    aFrame[0].plp = aConfig[i]->fplp;
+    nFrame = 1;
+    while (nFrame > 0) {
+      struct follow_frame *fp = &aFrame[nFrame - 1];
+      int up = fp->iConfig;
+      if (fp->plp) {
+        assert(fp->plp->item->status == COMPLETE);
+        k = fp->plp->item->index;
+        fp->plp = fp->plp->next;
+        if (aOrder[k] == 0) {
+          aOrder[k] = aLow[k] = ++n;
+          aCycle[nCycle++] = k;
+          fp = &aFrame[nFrame++];
+          fp->iConfig = k;
+          fp->plp = aConfig[k]->fplp;
+        } else if (aGroup[k] < 0 && aOrder[k] < aLow[up]) {
+          aLow[up] = aOrder[k];
+        }
+        continue;
+      }
+      if (aLow[up] == aOrder[up]) {
+        do {
+          k = aCycle[--nCycle];
+          aGroup[k] = nGroup;
+          aMember[nMember++] = k;
+        } while (k != up);
+        aGroupStart[++nGroup] = nMember;
+      }
+      nFrame--;
+      if (nFrame > 0) {
+        k = aFrame[nFrame - 1].iConfig;
+        if (aGroup[up] < 0 && aLow[up] < aLow[k])
+          aLow[k] = aLow[up];
+      }
     }
   }
 
-  do {
-    progress = 0;
-    for (i = 0; i < lemp->nstate; i++) {
-      for (cfp = lemp->sorted[i]->configs; cfp; cfp = cfp->next) {
-        if (cfp->item->status == COMPLETE)
+  /* The cycles came out with those reached from a cycle before it, so
+   * go through them the other way round.
+   */
+  for (i = nGroup - 1; i >= 0; i--) {
+    char *set = NULL, *kept;
+    bool keep = false, handed = false;
+    for (j = aGroupStart[i]; j < aGroupStart[i + 1]; j++) {
+      cfp = aConfig[aMember[j]];
+      if (cfp->rule->nrhs == cfp->position)
+        keep = true;
+      if (!cfp->fws)
+        continue;
+      if (!set) {
+        set = cfp->fws;
+      } else {
+        SetUnion(lemp, set, cfp->fws);
+        SetFree(cfp->fws);
+      }
+      cfp->fws = NULL;
+    }
+    if (!set)
+      continue;
+    for (j = aGroupStart[i]; j < aGroupStart[i + 1]; j++) {
+      for (plp = aConfig[aMember[j]]->fplp; plp; plp = plp->next) {
+        struct config *other = plp->item;
+        if (aGroup[other->index] == i)
           continue;
-        for (plp = cfp->item->fplp; plp; plp = plp->next) {
-          change = SetUnion(plp->item->fws, cfp->item->fws);
-          if (change) {
-            plp->item->status = INCOMPLETE;
-            progress = 1;
-          }
+        if (!other->fws && !keep && !handed) {
+          other->fws = set;
+          handed = true;
+        } else {
+          SetUnion(lemp, config_follow(lemp, other), set);
         }
-        cfp->item->status = COMPLETE;
       }
     }
-  } while (progress);
+    if (!keep) {
+      if (!handed)
+        SetFree(set);
+      continue;
+    }
+    /* The first configuration of the cycle with the dot at the end keeps
+     * the set, and any other one gets a copy
+     */
+    kept = NULL;
+    for (j = aGroupStart[i]; j < aGroupStart[i + 1]; j++) {
+      cfp = aConfig[aMember[j]];
+      if (cfp->rule->nrhs != cfp->position)
+        continue;
+      if (!kept)
+        kept = cfp->fws = set;
+      else
+        SetUnion(lemp, config_follow(lemp, cfp), kept);
+    }
+  }
+
+  free(aGroupStart);
+  free(aMember);
+  free(aGroup);
+  free(aCycle);
+  free(aLow);
+  free(aOrder);
+  free(aFrame);
+  free(aConfig);
 }
 
 /* Construct the propagation links */
 void
 FindLinks(struct lemon *lemp) {
-  int i;
-  struct config_list *cfp;
+  int i, j;
+  struct config *cfp;
   struct config *other;
   struct state *stp;
   struct config_list *plp;
@@ -214,8 +480,8 @@ FindLinks(struct lemon *lemp) {
    */
   for (i = 0; i < lemp->nstate; i++) {
     stp = lemp->sorted[i];
-    for (cfp = stp->configs; cfp; cfp = cfp->next) {
-      cfp->item->stp = stp;
+    for (j = 0; j < stp->nConfig; j++) {
+      stp->configs[j]->stp = stp;
     }
   }
 
@@ -224,10 +490,11 @@ FindLinks(struct lemon *lemp) {
    */
   for (i = 0; i < lemp->nstate; i++) {
     stp = lemp->sorted[i];
-    for (cfp = stp->configs; cfp; cfp = cfp->next) {
-      for (plp = cfp->item->bplp; plp; plp = plp->next) {
+    for (j = 0; j < stp->nConfig; j++) {
+      cfp = stp->configs[j];
+      for (plp = cfp->bplp; plp; plp = plp->next) {
         other = plp->item;
-        other->fplp = config_list_insert(cfp->item, &other->fplp);
+        other->fplp = config_list_insert(cfp, &other->fplp);
       }
     }
   }
@@ -273,10 +540,13 @@ void
 FindStates(struct lemon *lemp) {
   struct symbol *sp;
   struct rule_list *rp;
+  struct config **basis;
+  int nBasis;
+  unsigned int hash;
 
   /* Find the start symbol */
   if (lemp->start) {
-    sp = lookup_symbol(lemp->start);
+    sp = lookup_symbol(lemp, lemp->start);
     if (sp == 0) {
       ErrorMsg(lemp, 0,
                "The specified start symbol \"%s\" is not \
@@ -310,20 +580,27 @@ FindStates(struct lemon *lemp) {
    * is all rules which have the start symbol as their
    * left-hand side
    */
-  struct config_list *state_config_list = NULL;
+  nBasis = 0;
+  for (rp = sp->rules; rp; rp = rp->next)
+    nBasis++;
+  basis = (struct config **)malloc(sizeof(basis[0]) * (nBasis + 1));
+  MemoryCheck(basis);
+  nBasis = 0;
+  hash = 0;
   for (rp = sp->rules; rp; rp = rp->next) {
     struct config *new_config;
     rp->item->lhsStart = 1;
-    new_config = make_config(rp->item, 0);
-    SetAdd(new_config->fws, 0);
-    state_config_list = config_list_insert(new_config, &state_config_list);
+    new_config = make_config(lemp, rp->item, 0);
+    SetAdd(lemp, config_follow(lemp, new_config), 0);
+    basis[nBasis++] = new_config;
+    hash += ruleposhash(rp->item, 0);
   }
 
   /* Compute the first state.  All other states will be
    * computed automatically during the computation of the first one.
    * The returned pointer to the first state is not used.
    */
-  (void)get_state(lemp, &state_config_list);
+  (void)get_state(lemp, basis, nBasis, hash);
   return;
 }
 
@@ -332,102 +609,118 @@ FindStates(struct lemon *lemp) {
  */
 static void
 buildshifts(struct lemon *lemp, struct state *stp) {
-  struct config_list *cfp;  // For looping thru the config closure of "stp"
-  struct config_list *bcfp; // For the inner loop on config closure of "stp"
-  struct config_list *new_cl = NULL;
+  struct config *cfp;     // For looping thru the config closure of "stp"
+  struct config *bcfp;    // For the inner loop on config closure of "stp"
+  struct config **basis;  // The basis of the successor under construction
+  int nBasis;             // Number of configurations in basis[]
+  unsigned int hash;      // Hash of basis[], kept up as it grows
   struct config *newcfg;
   struct symbol *sp;    // Symbol following the dot in configuration "cfp"
   struct symbol *bsp;   // Symbol following the dot in configuration "bcfp"
   struct state *newstp; // A pointer to a successor state
+  int i, j;
 
   /* Each configuration becomes complete after it contibutes to a successor
    * state.  Initially, all configurations are incomplete
    */
-  for (cfp = stp->configs; cfp; cfp = cfp->next)
-    cfp->item->status = INCOMPLETE;
+  for (i = 0; i < stp->nConfig; i++)
+    stp->configs[i]->status = INCOMPLETE;
 
   /* Loop through all configurations of the state "stp" */
-  for (cfp = stp->configs; cfp; cfp = cfp->next) {
-    if (cfp->item->status == COMPLETE)
+  for (i = 0; i < stp->nConfig; i++) {
+    cfp = stp->configs[i];
+    if (cfp->status == COMPLETE)
       continue; // Already used by inner loop
-    if (cfp->item->position >= cfp->item->rule->nrhs)
-      continue;                              // Can't shift this config
-    sp = cfp->item->rule->rhs[cfp->item->position]; // Symbol after the dot
+    if (cfp->position >= cfp->rule->nrhs)
+      continue;                           // Can't shift this config
+    sp = cfp->rule->rhs[cfp->position]; // Symbol after the dot
 
     /* For every configuration in the state "stp" which has the symbol "sp"
      * following its dot, add the same configuration to the basis set under
      * construction but with the dot shifted one symbol to the right.
      */
-    for (bcfp = cfp; bcfp; bcfp = bcfp->next) {
-      if (bcfp->item->status == COMPLETE)
+    basis = (struct config **)malloc(sizeof(basis[0]) * (stp->nConfig - i));
+    MemoryCheck(basis);
+    nBasis = 0;
+    hash = 0;
+    for (j = i; j < stp->nConfig; j++) {
+      bcfp = stp->configs[j];
+      if (bcfp->status == COMPLETE)
         continue; /* Already used */
-      if (bcfp->item->position >= bcfp->item->rule->nrhs)
-        continue;                                 /* Can't shift this one */
-      bsp = bcfp->item->rule->rhs[bcfp->item->position]; /* Get symbol after dot */
+      if (bcfp->position >= bcfp->rule->nrhs)
+        continue;                              /* Can't shift this one */
+      bsp = bcfp->rule->rhs[bcfp->position]; /* Get symbol after dot */
       if (!same_symbol(bsp, sp))
-        continue;                    /* Must be same as for "cfp" */
-      bcfp->item->status = COMPLETE; /* Mark this config as used */
-      newcfg = make_config(bcfp->item->rule, bcfp->item->position + 1);
-      newcfg->bplp = config_list_insert(bcfp->item, &newcfg->bplp);
-      new_cl = config_list_insert(newcfg, &new_cl);
+        continue;              /* Must be same as for "cfp" */
+      bcfp->status = COMPLETE; /* Mark this config as used */
+      newcfg = make_config(lemp, bcfp->rule, bcfp->position + 1);
+      newcfg->bplp = config_list_insert(bcfp, &newcfg->bplp);
+      basis[nBasis++] = newcfg;
+      hash += ruleposhash(newcfg->rule, newcfg->position);
     }
 
     /* Get a pointer to the state described by the basis configuration set
      * constructed in the preceding loop
      */
-    newstp = get_state(lemp, &new_cl);
+    newstp = get_state(lemp, basis, nBasis, hash);
 
     /* The state "newstp" is reached from the state "stp" by a shift action
      * on the symbol "sp"
      */
     if (sp->type == MULTITERMINAL) {
-      int i;
-      for (i = 0; i < sp->nsubsym; i++) {
-        action_list_insert(make_action(sp->subsym[i], SHIFT, newstp), &stp->actions);
-        // TODO: check rewrite Action_add(&stp->ap, SHIFT, sp->subsym[i], (char *)newstp);
+      int k;
+      for (k = 0; k < sp->nsubsym; k++) {
+        action_add(stp, sp->subsym[k], SHIFT, newstp);
       }
     } else {
-      action_list_insert(make_action(sp, SHIFT, newstp), &stp->actions);
-      // TODO: check rewrite Action_add(&stp->ap, SHIFT, sp, (char *)newstp);
+      action_add(stp, sp, SHIFT, newstp);
     }
   }
 }
 
-/* Return a pointer to a state which is described by the configuration.*/
+/* Return a pointer to a state which is described by the configuration.
+ * The basis array passes to the state if it is new, and is freed if not.
+ * The hash is the sum of the ruleposhash() of the configurations, so the
+ * caller can add it up while it builds the basis, in any order.
+ */
 static struct state *
-get_state(struct lemon *lemp, struct config_list **basis) {
+get_state(struct lemon *lemp, struct config **basis, int nBasis, unsigned int hash) {
   struct state *stp;
+  int i;
 
   /* Sort basis of the new state. */
-  config_list_sort(basis);
-  stp = lookup_state(*basis);
+  config_sort(basis, nBasis);
+  stp = lookup_state(lemp, basis, nBasis, hash);
   if (stp) {
     /* A state with the same basis already exists!  Copy all the follow-set
      * propagation links from the state under construction into the
-     * preexisting state, then resymbolturn a pointer to the preexisting state
+     * preexisting state, then return a pointer to the preexisting state
      */
-    struct config_list *x;
-    struct config_list const *y;
-    for (x = *basis, y = stp->basis; x && y; x = x->next, y = y->next) {
-      y->item->bplp = config_list_copy(&y->item->bplp, x->item->bplp);
-      clear_config_list(x->item->fplp);
-      x->item->fplp = x->item->bplp = 0;
+    for (i = 0; i < nBasis && i < stp->nBasis; i++) {
+      stp->basis[i]->bplp = config_list_copy(&stp->basis[i]->bplp, basis[i]->bplp);
+      clear_config_list(basis[i]->fplp);
+      basis[i]->fplp = basis[i]->bplp = 0;
     }
+    free(basis);
   } else {
     /* This really is a new state.  Construct all the details */
-    check_config_list(lemp, *basis);
-    stp = make_state(*basis);       // A new state structure
-    stp->statenum = lemp->nstate++; // Every state gets a sequence number
-    buildshifts(lemp, stp);         // Recursively compute successor states
+    check_basis(lemp, basis, nBasis);
+    stp = make_state(lemp, basis, nBasis, hash); // A new state structure
+    stp->statenum = lemp->nstate++;             // Every state gets a sequence number
+    buildshifts(lemp, stp);                     // Recursively compute successor states
   }
   return stp;
 }
 
 static void
-check_config_list(struct lemon *lemp, struct config_list *list) {
-  for (; list; list = list->next) {
-    struct rule *rule = list->item->rule;
-    struct symbol *symbol = rule->rhs[list->item->position];
+check_basis(struct lemon *lemp, struct config **basis, int nBasis) {
+  int i;
+  for (i = 0; i < nBasis; i++) {
+    struct rule *rule = basis[i]->rule;
+    struct symbol *symbol;
+    if (basis[i]->position >= rule->nrhs)
+      continue;
+    symbol = rule->rhs[basis[i]->position];
     if (symbol->type == NONTERMINAL) {
       if (symbol->rules == 0 && symbol != lemp->errsym) {
         ErrorMsg(lemp, rule->line, "Nonterminal \"%s\" has no rules.", symbol->name);
@@ -518,3 +811,41 @@ same_symbol(struct symbol *a, struct symbol *b) {
   }
   return 1;
 }
+
+/* Return the next nonterminal whose first set the first set of the
+ * frame's nonterminal takes in, or -1 after the last one.  The
+ * terminals that can begin its rules go into its first set on the way.
+ */
+static int
+next_first_edge(struct lemon *lemp, struct first_frame *fp) {
+  struct grammar *g = lemp->grammar;
+  char *first = g->aFirstset[fp->iSym];
+  int iRule, iEnd, s2, j;
+
+  for (; fp->iRuleOf < g->aRuleStart[fp->iSym + 1]; fp->iRuleOf++, fp->iRhs = -1) {
+    iRule = g->aRuleOf[fp->iRuleOf];
+    if (fp->iRhs < 0)
+      fp->iRhs = g->aRhsStart[iRule];
+    iEnd = g->aRhsStart[iRule + 1];
+    while (fp->iRhs < iEnd) {
+      s2 = g->aRhs[fp->iRhs++];
+      if (g->aType[s2] == TERMINAL) {
+        SetAdd(lemp, first, s2);
+        break;
+      } else if (g->aType[s2] == MULTITERMINAL) {
+        for (j = g->aSubStart[s2]; j < g->aSubStart[s2 + 1]; j++) {
+          SetAdd(lemp, first, g->aSub[j]);
+        }
+        break;
+      } else if (s2 == fp->iSym) {
+        if (g->aLambda[s2] == false)
+          break;
+      } else {
+        if (g->aLambda[s2] == false)
+          fp->iRhs = iEnd;
+        return s2;
+      }
+    }
+  }
+  return -1;
+}
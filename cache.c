@@ -0,0 +1,325 @@
+#include "action.h"
+#include "acttab.h"
+#include "cache.h"
+#include "config.h"
+#include "context.h"
+#include "error.h"
+#include "lemon.h"
+#include "output.h"
+#include "rule.h"
+#include "state.h"
+#include "symbol.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Identifies a cache file and the layout of what follows */
+static const char zMagic[8] = "LEMONKC3";
+
+/* Add n bytes to an FNV-1a hash */
+static void
+key_add(unsigned long long *pKey, const void *p, size_t n) {
+  const unsigned char *z = (const unsigned char *)p;
+  size_t i;
+  for (i = 0; i < n; i++) {
+    *pKey ^= z[i];
+    *pKey *= 0x100000001b3ULL;
+  }
+}
+
+static void
+key_int(unsigned long long *pKey, int v) {
+  key_add(pKey, &v, sizeof(v));
+}
+
+static void
+key_str(unsigned long long *pKey, const char *z) {
+  if (z == 0)
+    z = "";
+  key_add(pKey, z, strlen(z) + 1);
+}
+
+/* Add a symbol of the right-hand side of a rule to the hash */
+static void
+key_symbol(unsigned long long *pKey, struct symbol *sp) {
+  int i;
+  key_str(pKey, sp->name);
+  if (sp->type == MULTITERMINAL) {
+    key_int(pKey, sp->nsubsym);
+    for (i = 0; i < sp->nsubsym; i++)
+      key_int(pKey, sp->subsym[i]->index);
+  }
+}
+
+/* Return a hash of everything the automaton is computed from: the
+ * symbols with their precedences and fallbacks, the rules, the start
+ * symbol, the wildcard, and the options bits given by the caller.  Of
+ * the code and the types, only what decides which unit rules the gotos
+ * bypass goes in: whether a rule or a nonterminal has code, and the
+ * types of the nonterminals.  Call this before the analysis, which
+ * fills in the precedence of rules.
+ */
+unsigned long long
+CacheKey(struct lemon *lemp, int options) {
+  unsigned long long key = 0xcbf29ce484222325ULL;
+  struct rule_list *rp;
+  int i;
+
+  key_add(&key, zMagic, sizeof(zMagic));
+  key_int(&key, options);
+  key_int(&key, lemp->glr);
+  key_int(&key, lemp->packmsec);
+  key_int(&key, lemp->nsymbol);
+  key_int(&key, lemp->nterminal);
+  for (i = 0; i < lemp->nsymbol; i++) {
+    struct symbol *sp = lemp->symbols[i];
+    key_str(&key, sp->name);
+    key_int(&key, sp->prec);
+    key_int(&key, sp->assoc);
+    key_int(&key, sp->fallback ? sp->fallback->index : -1);
+    key_int(&key, sp->destructor != 0);
+    key_str(&key, sp->datatype);
+  }
+  key_int(&key, lemp->vardest != 0);
+  key_str(&key, lemp->vartype);
+  key_str(&key, lemp->start);
+  key_str(&key, lemp->wildcard ? lemp->wildcard->name : 0);
+  for (rp = lemp->rules; rp; rp = rp->next) {
+    key_int(&key, rp->item->index);
+    key_int(&key, rp->item->lhs->index);
+    key_int(&key, rp->item->nrhs);
+    for (i = 0; i < rp->item->nrhs; i++)
+      key_symbol(&key, rp->item->rhs[i]);
+    key_str(&key, rp->item->precsym ? rp->item->precsym->name : 0);
+    key_int(&key, rp->item->code != 0);
+  }
+  return key;
+}
+
+/* A cache file being read */
+struct cache_reader {
+  const char *z; // Next byte to read
+  size_t n;      // Number of bytes left
+  int ok;        // False once a read has failed
+};
+
+/* Read an integer no less than lwr and less than upr */
+static int
+cache_int(struct cache_reader *p, int lwr, int upr) {
+  int v;
+  if (!p->ok || p->n < sizeof(v)) {
+    p->ok = 0;
+    return lwr;
+  }
+  memcpy(&v, p->z, sizeof(v));
+  p->z += sizeof(v);
+  p->n -= sizeof(v);
+  if (v < lwr || v >= upr) {
+    p->ok = 0;
+    return lwr;
+  }
+  return v;
+}
+
+/* Read the number of items that follow, each of nInt integers at least */
+static int
+cache_count(struct cache_reader *p, int nInt) {
+  return cache_int(p, 0, (int)(p->n / (sizeof(int) * nInt)) + 1);
+}
+
+static void
+cache_put(struct output *out, int v) {
+  output_write(out, (const char *)&v, sizeof(v));
+}
+
+/* Read the whole of file zFile into memory.  Return 0 if it can't be read */
+static char *
+cache_read_file(const char *zFile, size_t *pn) {
+  FILE *in;
+  char *z;
+  long n;
+
+  in = fopen(zFile, "rb");
+  if (in == 0)
+    return 0;
+  z = 0;
+  if (fseek(in, 0, SEEK_END) == 0 && (n = ftell(in)) > 0 && fseek(in, 0, SEEK_SET) == 0) {
+    z = (char *)malloc((size_t)n);
+    MemoryCheck(z);
+    if (fread(z, 1, (size_t)n, in) != (size_t)n) {
+      free(z);
+      z = 0;
+    }
+    *pn = (size_t)n;
+  }
+  fclose(in);
+  return z;
+}
+
+/* Restore the states of the automaton, with their configurations and
+ * actions, and the packed action table from the cache file zFile.  Return true on success, or false
+ * if the file is missing, stale or damaged and the automaton has to be
+ * computed afresh.
+ */
+int
+CacheLoad(struct lemon *lemp, const char *zFile, unsigned long long key) {
+  struct cache_reader r;
+  struct acttab *pActtab;
+  struct rule **aRule;
+  struct state **aState;
+  struct rule_list *rp;
+  char *zBuf;
+  size_t n;
+  int nstate, nconflict;
+  int i, j, k;
+
+  zBuf = cache_read_file(zFile, &n);
+  if (zBuf == 0)
+    return 0;
+  if (n < sizeof(zMagic) + sizeof(key) || memcmp(zBuf, zMagic, sizeof(zMagic)) != 0 ||
+      memcmp(zBuf + sizeof(zMagic), &key, sizeof(key)) != 0) {
+    free(zBuf);
+    return 0;
+  }
+  r.z = zBuf + sizeof(zMagic) + sizeof(key);
+  r.n = n - sizeof(zMagic) - sizeof(key);
+  r.ok = 1;
+
+  aRule = (struct rule **)calloc((size_t)lemp->nrule, sizeof(aRule[0]));
+  MemoryCheck(aRule);
+  for (rp = lemp->rules; rp; rp = rp->next)
+    aRule[rp->item->index] = rp->item;
+  nconflict = cache_int(&r, 0, 0x7fffffff);
+  nstate = cache_count(&r, 9);
+  aState = (struct state **)calloc((size_t)nstate + 1, sizeof(aState[0]));
+  MemoryCheck(aState);
+  /* The states, and the configurations they are given, are in no table
+   * of the context, which keeps them in a list of their own to release
+   */
+  lemp->ctx->loaded = aState;
+  lemp->ctx->nLoaded = nstate;
+  for (i = 0; r.ok && i < nstate; i++) {
+    aState[i] = (struct state *)calloc(1, sizeof(struct state));
+    MemoryCheck(aState[i]);
+  }
+
+  /* The states are stored in the order of lemp->sorted[], and actions
+   * refer to states by their place in that order.
+   */
+  for (i = 0; r.ok && i < nstate; i++) {
+    struct state *stp = aState[i];
+    int ncfg, nact;
+
+    stp->statenum = cache_int(&r, 0, nstate);
+    stp->nTknAct = cache_int(&r, 0, 0x7fffffff);
+    stp->nNtAct = cache_int(&r, 0, 0x7fffffff);
+    stp->iTknOfst = cache_int(&r, -0x7fffffff, 0x7fffffff);
+    stp->iNtOfst = cache_int(&r, -0x7fffffff, 0x7fffffff);
+    stp->iDflt = cache_int(&r, -0x7fffffff, 0x7fffffff);
+    stp->autoReduce = cache_int(&r, 0, 2);
+    ncfg = cache_count(&r, 2);
+    stp->configs = (struct config **)malloc(sizeof(stp->configs[0]) * (ncfg + 1));
+    MemoryCheck(stp->configs);
+    for (j = 0; r.ok && j < ncfg; j++) {
+      struct rule *rule = aRule[cache_int(&r, 0, lemp->nrule)];
+      struct config *cfp = (struct config *)calloc(1, sizeof(struct config));
+      MemoryCheck(cfp);
+      cfp->rule = rule;
+      cfp->position = (unsigned int)cache_int(&r, 0, rule->nrhs + 1);
+      cfp->stp = stp;
+      cfp->status = COMPLETE;
+      stp->configs[stp->nConfig++] = cfp;
+    }
+    nact = cache_count(&r, 3);
+    for (j = 0; r.ok && j < nact; j++) {
+      enum action_type type = (enum action_type)cache_int(&r, SHIFT, NOT_USED + 1);
+      struct symbol *sp = lemp->symbols[cache_int(&r, 0, lemp->nsymbol + 1)];
+      if (action_holds_state(type)) {
+        action_add(stp, sp, type, aState[cache_int(&r, 0, nstate)]);
+      } else {
+        k = cache_int(&r, -1, lemp->nrule);
+        action_add(stp, sp, type, k >= 0 ? aRule[k] : 0);
+      }
+    }
+  }
+  pActtab = acttab_alloc();
+  pActtab->nAction = pActtab->nActionAlloc = cache_count(&r, 2);
+  pActtab->aAction = (struct lookahead_action *)malloc(sizeof(pActtab->aAction[0]) * (pActtab->nAction + 1));
+  MemoryCheck(pActtab->aAction);
+  for (i = 0; r.ok && i < pActtab->nAction; i++) {
+    pActtab->aAction[i].lookahead = cache_int(&r, -1, lemp->nsymbol);
+    pActtab->aAction[i].action = cache_int(&r, -1, 0x7fffffff);
+  }
+  free(aRule);
+  free(zBuf);
+  if (!r.ok || r.n != 0) {
+    // A damaged cache is ignored.  The states go with the context.
+    acttab_free(pActtab);
+    return 0;
+  }
+  lemp->nstate = nstate;
+  lemp->nconflict = nconflict;
+  lemp->sorted = (struct state **)malloc(sizeof(aState[0]) * (nstate + 1));
+  MemoryCheck(lemp->sorted);
+  memcpy(lemp->sorted, aState, sizeof(aState[0]) * nstate);
+  lemp->acttab = pActtab;
+  return 1;
+}
+
+/* Write the states of the automaton and the packed action table to the
+ * cache file zFile, to be found by CacheLoad() when the grammar hashes to
+ * the same key.  Call this once ReportTable() has packed the table.
+ */
+void
+CacheSave(struct lemon *lemp, const char *zFile, unsigned long long key) {
+  struct output out;
+  int *aPlace; // The place of each state in lemp->sorted[], by number
+  int i, n;
+
+  aPlace = (int *)malloc(sizeof(aPlace[0]) * lemp->nstate);
+  MemoryCheck(aPlace);
+  for (i = 0; i < lemp->nstate; i++)
+    aPlace[lemp->sorted[i]->statenum] = i;
+  output_init(&out);
+  output_write(&out, zMagic, sizeof(zMagic));
+  output_write(&out, (const char *)&key, sizeof(key));
+  cache_put(&out, lemp->nconflict);
+  cache_put(&out, lemp->nstate);
+  for (i = 0; i < lemp->nstate; i++) {
+    struct state *stp = lemp->sorted[i];
+    struct action *ap;
+
+    cache_put(&out, stp->statenum);
+    cache_put(&out, stp->nTknAct);
+    cache_put(&out, stp->nNtAct);
+    cache_put(&out, stp->iTknOfst);
+    cache_put(&out, stp->iNtOfst);
+    cache_put(&out, stp->iDflt);
+    cache_put(&out, stp->autoReduce);
+    cache_put(&out, stp->nConfig);
+    for (n = 0; n < stp->nConfig; n++) {
+      cache_put(&out, stp->configs[n]->rule->index);
+      cache_put(&out, (int)stp->configs[n]->position);
+    }
+    cache_put(&out, stp->nAction);
+    for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+      cache_put(&out, ap->type);
+      cache_put(&out, ap->sp->index);
+      if (action_holds_state(ap->type)) {
+        cache_put(&out, aPlace[ap->x.stp->statenum]);
+      } else {
+        cache_put(&out, ap->x.rp ? ap->x.rp->index : -1);
+      }
+    }
+  }
+  cache_put(&out, lemp->acttab->nAction);
+  for (i = 0; i < lemp->acttab->nAction; i++) {
+    cache_put(&out, lemp->acttab->aAction[i].lookahead);
+    cache_put(&out, lemp->acttab->aAction[i].action);
+  }
+  free(aPlace);
+  if (output_save(&out, zFile)) {
+    lprintf(LWARN, "Can't write the cache file \"%s\".", zFile);
+  }
+}
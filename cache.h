@@ -0,0 +1,16 @@
+#ifndef _LEMON_CACHE_H_
+#define _LEMON_CACHE_H_
+
+/*
+ * Persistent cache of the automaton computed by the LEMON parser generator.
+ * The cache is keyed by a hash of the grammar skeleton, so that edits to
+ * the code of actions or to %include need no new analysis of the grammar.
+ */
+
+struct lemon;
+
+unsigned long long CacheKey(struct lemon *, int);                 // Hash the grammar skeleton
+int CacheLoad(struct lemon *, const char *, unsigned long long);  // Restore the automaton on a hit
+void CacheSave(struct lemon *, const char *, unsigned long long); // Store the automaton
+
+#endif //_LEMON_CACHE_H_
@@ -1,114 +1,126 @@
 #include "error.h"
-#include "hash_table.h"
 #include "config.h"
+#include "context.h"
+#include "grammar.h"
+#include "lemon.h"
 #include "set.h"
-#include "msort.h"
 #include "rule.h"
-#include "hash.h"
 #include "symbol.h"
 
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
-struct config_key {
-  struct rule *rule;
-  unsigned int position;
-};
-struct hash_table config_hash;
-
-static int compare_config_key(void const *left, void const *right);
-static void const *get_key_config(void const *obj);
-static unsigned int hash_config(void const *obj, unsigned int size);
-static void *config_list_get_next(void const *list);
-static void config_list_set_next(void *list, void *next);
-static int config_list_compare(void const *left, void const *right);
+static int config_compare(void const *left, void const *right);
 
+/* Make a new configuration.  Every configuration belongs to one state,
+ * so none is ever shared, and the context keeps them all to release.
+ */
 struct config *
-make_config(struct rule *rule, unsigned int position) {
-  struct config *obj, *new_obj;
-  struct config_key key;
-  key.rule = rule;
-  key.position = position;
+make_config(struct lemon *lemp, struct rule *rule, unsigned int position) {
+  struct context *ctx = lemp->ctx;
+  struct config *new_obj;
   if (!rule)
     return NULL;
-  obj = (struct config *) lookup_hash(&key, get_key_config, compare_config_key, hash_config, &config_hash);
-  if (!obj && (new_obj = (struct config *)calloc(1, sizeof(struct config))) != NULL) {
-    new_obj->rule = rule;
-    new_obj->position = position;
-    new_obj->fws = SetNew();
-    insert_hash(new_obj, hash_config, &config_hash);
-    obj = new_obj;
+  new_obj = (struct config *)calloc(1, sizeof(struct config));
+  MemoryCheck(new_obj);
+  new_obj->rule = rule;
+  new_obj->position = position;
+  if (ctx->nConfig >= ctx->nConfigAlloc) {
+    ctx->nConfigAlloc = ctx->nConfigAlloc * 2 + 64;
+    ctx->configs = (struct config **)realloc(ctx->configs, sizeof(ctx->configs[0]) * ctx->nConfigAlloc);
+    MemoryCheck(ctx->configs);
   }
-  MemoryCheck(obj);
-  return obj;
+  ctx->configs[ctx->nConfig++] = new_obj;
+  return new_obj;
 }
 
-static int
-compare_config_key(void const *left, void const *right) {
-  struct config_key const *a = (struct config_key const *)left;
-  struct config_key const *b = (struct config_key const *)right;
-  int rc = a->rule->index - b->rule->index;
-  if (rc == 0)
-    rc = a->position - b->position;
-  return rc;
+/* Return the follow-set of a configuration.  The set is only made when
+ * something is first added to it, so configurations that no follow
+ * symbol reaches never own one.
+ */
+char *
+config_follow(struct lemon *lemp, struct config *cfp) {
+  if (!cfp->fws)
+    cfp->fws = SetNew(lemp);
+  return cfp->fws;
 }
 
-static void const *
-get_key_config(void const *obj) {
-  return (struct config_key *)obj;
-}
-
-static unsigned int
-hash_config(void const *obj, unsigned int size) {
-  return ruleposhash(((struct config *)obj)->rule, ((struct config *)obj)->position) & (size - 1);
-}
-
-
-
-/* Compute the closure of the configuration list */
-struct config_list *
-config_list_closure(struct config_list *list) {
-  struct config_list *new_cl = NULL;
-  int i;
+/* Compute the closure of the basis configurations.  Return a new array
+ * of the basis and the configurations it brings in, and write their
+ * number to *pnConfig.  Each rule is brought in at most once, and every
+ * configuration whose rest can be empty gets a propagation link to the
+ * configurations it brings in.
+ */
+struct config **
+config_closure(struct lemon *lemp, struct config **basis, int nBasis, int *pnConfig) {
+  struct grammar *g = lemp->grammar;
+  struct config **array;
+  int n, nAlloc;
+  int i, j;
+
+  nAlloc = nBasis * 2 + 16;
+  array = (struct config **)malloc(sizeof(array[0]) * nAlloc);
+  MemoryCheck(array);
+  for (n = 0; n < nBasis; n++) {
+    array[n] = basis[n];
+    if (basis[n]->position == 0)
+      g->aClosure[basis[n]->rule->index] = basis[n];
+  }
 
-  for (; list; list = list->next) {
+  for (j = 0; j < n; j++) {
     struct rule *rule;
-    struct symbol *symbol, *x_symbol;
+    const int *rhs;
+    int symbol, x_symbol, r;
     unsigned int dot;
-    rule = list->item->rule;
-    dot = list->item->position;
+    rule = array[j]->rule;
+    dot = array[j]->position;
     if (dot >= rule->nrhs)
       continue;
-    symbol = rule->rhs[dot];
-    if (symbol->type == NONTERMINAL) {
-      struct rule_list *rp;
-      for (rp = symbol->rules; rp; rp = rp->next) {
-        struct config *cfg = make_config(rp->item, 0);
+    rhs = &g->aRhs[g->aRhsStart[rule->index]];
+    symbol = rhs[dot];
+    if (g->aType[symbol] == NONTERMINAL) {
+      for (r = g->aRuleStart[symbol]; r < g->aRuleStart[symbol + 1]; r++) {
+        int iRule = g->aRuleOf[r];
+        struct config *cfg = g->aClosure[iRule];
+        if (!cfg) {
+          cfg = g->aClosure[iRule] = make_config(lemp, g->aRule[iRule], 0);
+          if (n >= nAlloc) {
+            nAlloc = nAlloc * 2 + 16;
+            array = (struct config **)realloc(array, sizeof(array[0]) * nAlloc);
+            MemoryCheck(array);
+          }
+          array[n++] = cfg;
+        }
         for (i = dot + 1; i < rule->nrhs; i++) {
-          x_symbol = rule->rhs[i];
-          if (x_symbol->type == TERMINAL) {
-            SetAdd(cfg->fws, x_symbol->index);
+          x_symbol = rhs[i];
+          if (g->aType[x_symbol] == TERMINAL) {
+            SetAdd(lemp, config_follow(lemp, cfg), x_symbol);
             break;
-          } else if (x_symbol->type == MULTITERMINAL) {
+          } else if (g->aType[x_symbol] == MULTITERMINAL) {
             int k;
-            for (k = 0; k < x_symbol->nsubsym; k++) {
-              SetAdd(cfg->fws, x_symbol->subsym[k]->index);
+            for (k = g->aSubStart[x_symbol]; k < g->aSubStart[x_symbol + 1]; k++) {
+              SetAdd(lemp, config_follow(lemp, cfg), g->aSub[k]);
             }
             break;
           } else {
-            SetUnion(cfg->fws, x_symbol->firstset);
-            if (x_symbol->lambda == false)
+            SetUnion(lemp, config_follow(lemp, cfg), g->aFirstset[x_symbol]);
+            if (g->aLambda[x_symbol] == false)
               break;
           }
         }
         if (i == rule->nrhs)
-          list->item->fplp = config_list_insert(cfg, &list->item->fplp);
-        new_cl = config_list_insert(cfg, &new_cl);
+          array[j]->fplp = config_list_insert(cfg, &array[j]->fplp);
       }
     }
   }
-  return new_cl;
+
+  for (j = 0; j < n; j++) {
+    if (array[j]->position == 0)
+      g->aClosure[array[j]->rule->index] = NULL;
+  }
+  *pnConfig = n;
+  return array;
 }
 
 struct config_list *
@@ -143,25 +155,17 @@ clear_config_list(struct config_list *list) {
   }
 }
 
+/* Sort an array of configurations by rule and dot position */
 void
-config_list_sort(struct config_list **list) {
-  *list = mergesort(*list, config_list_get_next, config_list_set_next, config_list_compare);
-}
-
-static void *
-config_list_get_next(void const *list) {
-  return ((struct config_list const *)list)->next;
-}
-
-static void
-config_list_set_next(void *list, void *next) {
-  ((struct config_list *)list)->next = next;
+config_sort(struct config **array, int n) {
+  if (n > 1)
+    qsort(array, (size_t)n, sizeof(array[0]), config_compare);
 }
 
 static int
-config_list_compare(void const *left, void const *right) {
-  const struct config *a = ((struct config_list *)left)->item;
-  const struct config *b = ((struct config_list *)right)->item;
+config_compare(void const *left, void const *right) {
+  const struct config *a = *(struct config *const *)left;
+  const struct config *b = *(struct config *const *)right;
   int x;
   x = a->rule->index - b->rule->index;
   if (x == 0)
@@ -16,19 +16,23 @@ enum cfgstatus { COMPLETE, INCOMPLETE };
 struct config {
   struct rule *rule;     // The rule upon which the configuration is based
   unsigned int position; // The parse point
-  char *fws;             // Follow-set for this configuration only
+  char *fws;             // Follow-set for this configuration only, or NULL
   struct config_list *fplp;    // Follow-set forward propagation links
   struct config_list *bplp;    // Follow-set backwards propagation links
   struct state *stp;     // Pointer to state which contains this
   enum cfgstatus status; // used during followset and shift computations
+  int index;             // Number of the configuration in the followset computation
 };
 
+struct lemon;
+
 struct config_list *config_list_insert(struct config *config, struct config_list **list);
 struct config_list *config_list_copy(struct config_list **dest, struct config_list *src);
 void clear_config_list(struct config_list *list);
-void config_list_sort(struct config_list **list);
-struct config *make_config(struct rule *rule, unsigned int position);
+void config_sort(struct config **array, int n);
+struct config *make_config(struct lemon *lemp, struct rule *rule, unsigned int position);
+char *config_follow(struct lemon *lemp, struct config *cfp);
 
-struct config_list *config_list_closure(struct config_list *list);
+struct config **config_closure(struct lemon *lemp, struct config **basis, int nBasis, int *pnConfig);
 
 #endif //_LEMON_CONFIG_H_
@@ -0,0 +1,88 @@
+#include "context.h"
+#include "config.h"
+#include "error.h"
+#include "set.h"
+#include "state.h"
+#include "symbol.h"
+
+#include <stdlib.h>
+
+/* Allocate the context of a new run */
+struct context *
+context_new(void) {
+  struct context *ctx = (struct context *)calloc(1, sizeof(struct context));
+  MemoryCheck(ctx);
+  return ctx;
+}
+
+/* Release the slots of a table and, through freeobj, every object
+ * indexed in it
+ */
+static void
+free_table(struct hash_table *table, void (*freeobj)(void *)) {
+  unsigned int h;
+  for (h = 0; h < table->size; h++) {
+    if (table->hash[h])
+      freeobj(table->hash[h]);
+  }
+  free(table->hash);
+}
+
+static void
+free_symbol(void *obj) {
+  struct symbol *sp = (struct symbol *)obj;
+  if (sp->type == MULTITERMINAL)
+    free(sp->subsym);
+  free(sp);
+}
+
+static void
+free_config(void *obj) {
+  struct config *cfp = (struct config *)obj;
+  SetFree(cfp->fws);
+  clear_config_list(cfp->fplp);
+  clear_config_list(cfp->bplp);
+  free(cfp);
+}
+
+static void
+free_state(void *obj) {
+  struct state *stp = (struct state *)obj;
+  free(stp->basis);
+  free(stp->configs);
+  free(stp->actions);
+  free(stp);
+}
+
+/* Release a state read back from a cache, which is in no table, with
+ * the configurations it was given
+ */
+static void
+free_loaded_state(struct state *stp) {
+  int i;
+  if (!stp)
+    return;
+  for (i = 0; i < stp->nConfig; i++)
+    free_config(stp->configs[i]);
+  free_state(stp);
+}
+
+/* Release a context together with the strings, symbols, configurations
+ * and states it indexes.  Nothing of the run may be used afterwards.
+ */
+void
+context_free(struct context *ctx) {
+  int i;
+  if (!ctx)
+    return;
+  for (i = 0; i < ctx->nLoaded; i++)
+    free_loaded_state(ctx->loaded[i]);
+  free(ctx->loaded);
+  free_table(&ctx->states, free_state);
+  for (i = 0; i < ctx->nConfig; i++)
+    free_config(ctx->configs[i]);
+  free(ctx->configs);
+  free_table(&ctx->symbols, free_symbol);
+  free_table(&ctx->strings, free);
+  free(ctx);
+}
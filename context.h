@@ -0,0 +1,29 @@
+#ifndef _LEMON_CONTEXT_H_
+#define _LEMON_CONTEXT_H_
+
+#include "hash_table.h"
+
+struct config;
+struct state;
+
+/*
+ * Working storage of one run of the LEMON parser generator.  Every
+ * grammar gets a context of its own, so that one process can build
+ * several grammars, one after another or side by side on threads.
+ */
+
+struct context {
+  struct hash_table strings; // Interned strings
+  struct hash_table symbols; // Symbols, by name
+  struct config **configs;   // Every configuration made, to release
+  int nConfig, nConfigAlloc; // Number of configurations, and of slots in configs[]
+  struct hash_table states;  // States, by basis configurations
+  struct state **loaded;     // States read back from a cache, which own their configurations
+  int nLoaded;               // Number of states in loaded[]
+  int setsize;               // Number of elements in every set
+};
+
+struct context *context_new(void);     // An empty context
+void context_free(struct context *);   // Release a context and what it indexes
+
+#endif //_LEMON_CONTEXT_H_
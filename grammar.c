@@ -0,0 +1,151 @@
+#include "grammar.h"
+#include "context.h"
+#include "error.h"
+#include "lemon.h"
+#include "rule.h"
+#include "set.h"
+#include "symbol.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+/* Return true if sp is a compound A|B written into the RHS of a rule.
+ * Those are made afresh for every use and are not in the symbol table,
+ * so their index is not their own.
+ */
+static bool
+is_inline_multiterminal(struct lemon *lemp, struct symbol *sp, int nsymbol) {
+  return sp->type == MULTITERMINAL && !(sp->index >= 0 && sp->index < nsymbol && lemp->symbols[sp->index] == sp);
+}
+
+/* Lay out the rules and symbols of the grammar in flat arrays.  Call
+ * this once the symbols are sorted and numbered, and before the first
+ * sets are computed.  The rules and symbols must not change afterwards.
+ *
+ * Every A|B on the RHS of a rule gets a number of its own after those of
+ * the symbol table, with its constituents in aSub[] as for %token_class.
+ */
+void
+FreezeGrammar(struct lemon *lemp) {
+  struct grammar *g;
+  struct rule_list *rp;
+  struct symbol *sp;
+  int nTable, nRhs, nRuleOf, nSub, nInline;
+  int i, j, k;
+
+  g = (struct grammar *)calloc(1, sizeof(struct grammar));
+  MemoryCheck(g);
+  g->nrule = lemp->nrule;
+  nTable = (int)lemp->ctx->symbols.count;
+
+  nRhs = nRuleOf = nSub = nInline = 0;
+  for (rp = lemp->rules; rp; rp = rp->next) {
+    nRhs += rp->item->nrhs;
+    nRuleOf++;
+    for (k = 0; k < rp->item->nrhs; k++) {
+      sp = rp->item->rhs[k];
+      if (is_inline_multiterminal(lemp, sp, nTable)) {
+        nInline++;
+        nSub += sp->nsubsym;
+      }
+    }
+  }
+  for (i = 0; i < nTable; i++) {
+    if (lemp->symbols[i]->type == MULTITERMINAL)
+      nSub += lemp->symbols[i]->nsubsym;
+  }
+  g->nsymbol = nTable + nInline;
+  g->aRule = (struct rule **)calloc((size_t)g->nrule + 1, sizeof(g->aRule[0]));
+  g->aLhs = (int *)calloc((size_t)g->nrule + 1, sizeof(g->aLhs[0]));
+  g->aRhsStart = (int *)calloc((size_t)g->nrule + 1, sizeof(g->aRhsStart[0]));
+  g->aRhs = (int *)calloc((size_t)nRhs + 1, sizeof(g->aRhs[0]));
+  g->aRuleStart = (int *)calloc((size_t)g->nsymbol + 1, sizeof(g->aRuleStart[0]));
+  g->aRuleOf = (int *)calloc((size_t)nRuleOf + 1, sizeof(g->aRuleOf[0]));
+  g->aType = (unsigned char *)calloc((size_t)g->nsymbol + 1, sizeof(g->aType[0]));
+  g->aSubStart = (int *)calloc((size_t)g->nsymbol + 1, sizeof(g->aSubStart[0]));
+  g->aSub = (int *)calloc((size_t)nSub + 1, sizeof(g->aSub[0]));
+  g->aLambda = (bool *)calloc((size_t)g->nsymbol + 1, sizeof(g->aLambda[0]));
+  g->aFirstset = (char **)calloc((size_t)g->nsymbol + 1, sizeof(g->aFirstset[0]));
+  g->aClosure = (struct config **)calloc((size_t)g->nrule + 1, sizeof(g->aClosure[0]));
+  MemoryCheck(g->aRule);
+  MemoryCheck(g->aLhs);
+  MemoryCheck(g->aRhsStart);
+  MemoryCheck(g->aRhs);
+  MemoryCheck(g->aRuleStart);
+  MemoryCheck(g->aRuleOf);
+  MemoryCheck(g->aType);
+  MemoryCheck(g->aSubStart);
+  MemoryCheck(g->aSub);
+  MemoryCheck(g->aLambda);
+  MemoryCheck(g->aFirstset);
+  MemoryCheck(g->aClosure);
+
+  /* The symbols of the table, with the rules of each nonterminal and the
+   * constituents of each MULTITERMINAL
+   */
+  nRuleOf = nSub = 0;
+  for (i = 0; i < nTable; i++) {
+    sp = lemp->symbols[i];
+    g->aType[i] = (unsigned char)sp->type;
+    g->aRuleStart[i] = nRuleOf;
+    for (rp = sp->rules; rp; rp = rp->next)
+      g->aRuleOf[nRuleOf++] = rp->item->index;
+    g->aSubStart[i] = nSub;
+    if (sp->type == MULTITERMINAL) {
+      for (j = 0; j < sp->nsubsym; j++)
+        g->aSub[nSub++] = sp->subsym[j]->index;
+    }
+  }
+
+  /* The rules, with the RHS of each right after that of the rule before.
+   * Each A|B on a RHS is numbered as it comes.
+   */
+  for (rp = lemp->rules; rp; rp = rp->next)
+    g->aRule[rp->item->index] = rp->item;
+  for (i = j = 0; i < g->nrule; i++) {
+    g->aLhs[i] = g->aRule[i]->lhs->index;
+    g->aRhsStart[i] = j;
+    for (k = 0; k < g->aRule[i]->nrhs; k++) {
+      sp = g->aRule[i]->rhs[k];
+      if (is_inline_multiterminal(lemp, sp, nTable)) {
+        int m, iSym = nTable++;
+        g->aType[iSym] = MULTITERMINAL;
+        g->aRuleStart[iSym] = nRuleOf;
+        g->aSubStart[iSym] = nSub;
+        for (m = 0; m < sp->nsubsym; m++)
+          g->aSub[nSub++] = sp->subsym[m]->index;
+        g->aRhs[j++] = iSym;
+      } else {
+        g->aRhs[j++] = sp->index;
+      }
+    }
+  }
+  g->aRhsStart[g->nrule] = j;
+  assert(nTable == g->nsymbol);
+  g->aRuleStart[g->nsymbol] = nRuleOf;
+  g->aSubStart[g->nsymbol] = nSub;
+  lemp->grammar = g;
+}
+
+/* Release a frozen grammar together with the first sets it holds */
+void
+grammar_free(struct grammar *g) {
+  int i;
+  if (!g)
+    return;
+  for (i = 0; i < g->nsymbol; i++)
+    SetFree(g->aFirstset[i]);
+  free(g->aClosure);
+  free(g->aFirstset);
+  free(g->aLambda);
+  free(g->aSub);
+  free(g->aSubStart);
+  free(g->aType);
+  free(g->aRuleOf);
+  free(g->aRuleStart);
+  free(g->aRhs);
+  free(g->aRhsStart);
+  free(g->aLhs);
+  free(g->aRule);
+  free(g);
+}
@@ -0,0 +1,39 @@
+#ifndef _LEMON_GRAMMAR_H_
+#define _LEMON_GRAMMAR_H_
+
+#include <stdbool.h>
+
+/*
+ * The grammar frozen into flat arrays once it is parsed and its symbols
+ * are numbered, for the analyses that walk every rule over and over.
+ * Rules and symbols are referred to by index.  The attributes those
+ * walks read are kept here, apart from the rest of struct symbol.  A
+ * compound A|B written into a rule is in no symbol table, so it gets a
+ * number past those of the table.
+ */
+
+struct config;
+
+struct grammar {
+    int nrule;                // Number of rules
+    int nsymbol;              // Number of symbols, MULTITERMINALs and every A|B on a RHS included
+    struct rule **aRule;      // The rules, by index
+    int *aLhs;                // Left-hand side of every rule
+    int *aRhsStart;           // Offset of the RHS of every rule in aRhs[], and one past the last
+    int *aRhs;                // The RHS symbols of all rules, one after another
+    int *aRuleStart;          // Offset of the rules of every symbol in aRuleOf[], and one past the last
+    int *aRuleOf;             // The rules of every nonterminal, as in its rules list
+    unsigned char *aType;     // The enum symbol_type of every symbol
+    int *aSubStart;           // Offset of the constituents of every symbol in aSub[], and one past the last
+    int *aSub;                // The constituent symbols of every MULTITERMINAL
+    bool *aLambda;            // True if the symbol is an NT and can generate an empty string
+    char **aFirstset;         // First-set of every nonterminal, NULL for other symbols
+    struct config **aClosure; // Work space of config_closure(), by rule, NULL between calls
+};
+
+struct lemon;
+
+void FreezeGrammar(struct lemon *);  // Lay the grammar out in lemp->grammar
+void grammar_free(struct grammar *); // Release a frozen grammar and its first sets
+
+#endif //_LEMON_GRAMMAR_H_
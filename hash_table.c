@@ -1,4 +1,5 @@
 #include "hash_table.h"
+#include "error.h"
 
 #include <stddef.h>
 #include <stdlib.h>
@@ -11,8 +12,8 @@ void *
 lookup_hash(void const *key, void const *get_key_fn(void const *), int (*compare_fn)(void const *, void const *),
             unsigned int (*hash_fn)(void const *, unsigned int), struct hash_table *hash) {
   unsigned int h, first;
-  void const *obj;
-  if (!hash)
+  void *obj;
+  if (!hash || hash->size == 0)
     return NULL;
   first = h = hash_fn(key, hash->size);
   while ((obj = hash->hash[h]) != NULL) {
@@ -23,16 +24,15 @@ lookup_hash(void const *key, void const *get_key_fn(void const *), int (*compare
       h = 0;
   }
   if (obj && h != first) {
-    void *tmp = hash->hash[h];
     hash->hash[h] = hash->hash[first];
-    hash->hash[first] = tmp;
+    hash->hash[first] = obj;
   }
-  return NULL;
+  return obj;
 }
 
 void
 insert_hash(void *obj, unsigned int (*hash_fn)(void const *, unsigned int), struct hash_table *hash) {
-  if (hash->size - 1 <= hash->count * 2)
+  if (hash->size == 0 || hash->size - 1 <= hash->count * 2)
     grow_hash(hash_fn, hash);
   insert_hash_internal(obj, hash_fn, hash);
   hash->count++;
@@ -40,18 +40,20 @@ insert_hash(void *obj, unsigned int (*hash_fn)(void const *, unsigned int), stru
 
 static void
 grow_hash(unsigned int (*hash_fn)(void const *, unsigned int), struct hash_table *hash) {
-  unsigned int new_size = hash->size < 32 ? 32 : 2 * hash->size;
-  void **new_hash = (void **)calloc(new_size, sizeof(void const *));
-  int i;
+  struct hash_table new_hash;
+  unsigned int i;
+  new_hash.size = hash->size < 32 ? 32 : 2 * hash->size;
+  new_hash.count = hash->count;
+  new_hash.hash = (void **)calloc(new_hash.size, sizeof(void *));
+  MemoryCheck(new_hash.hash);
   for (i = 0; i < hash->size; i++) {
     void *obj = hash->hash[i];
     if (!obj)
       continue;
-    insert_hash_internal(obj, hash_fn, hash);
+    insert_hash_internal(obj, hash_fn, &new_hash);
   }
   free(hash->hash);
-  hash->hash = new_hash;
-  hash->size = new_size;
+  *hash = new_hash;
 }
 
 static void
@@ -14,9 +14,12 @@ struct lemon {
   unsigned int nsymbol;    // Number of terminal and nonterminal symbols
   int nterminal;           // Number of terminal symbols
   struct symbol **symbols; // Sorted array of pointers to symbols
+  struct grammar *grammar; // The rules and symbols in flat arrays, once frozen
+  struct acttab *acttab;   // The packed yy_action[] table, once computed
   int errorcnt;            // Number of errors
   struct symbol *errsym;   // The error symbol
   struct symbol *wildcard; // Token that matches anything
+  struct symbol *synctoken; // Token that ends an independent segment of input
   char *name;              // Name of the generated parser
   char *arg;               // Declaration of the 3th argument to parser
   char *tokentype;         // Type of terminal symbols in the parser stack
@@ -37,7 +40,15 @@ struct lemon {
   int nconflict;           // Number of parsing conflicts
   int tablesize;           // Size of the parse tables
   int has_fallback;        // True if any %fallback is seen in the grammar
+  int glr;                 // True to keep unresolved conflicts for the GLR driver
+  int cplusplus;           // True to generate a C++ header from a .hpp template
+  int tablefile;           // True to write the parse tables to a file read at run time
+  int packmsec;            // Milliseconds to search for a smaller action table
   char *argv0;             // Name of the program
+  int nDefine;             // Number of %ifdef macros defined for this run
+  char **azDefine;         // Names of those macros
+  char *variant;           // Appended to the names of the output files, or NULL
+  struct context *ctx;     // Hash tables and set size of this run
 };
 
 #endif //_LEMON_STRUCT_H_
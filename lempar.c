@@ -34,6 +34,8 @@
  *    YYFALLBACK         If defined, this indicates that one or more tokens
  *                       have fall-back values which should be used if the
  *                       original value of the token will not parse.
+ *    YYTOKENCLASS       If defined, terminals are looked up in the action
+ *                       table by their class in yy_token_class[].
  *    YYACTIONTYPE       is the data type used for storing terminal
  *                       and nonterminal numbers.  "unsigned char" is
  *                       used if there are fewer than 250 rules and
@@ -44,16 +46,31 @@
  *                       This is typically a union of many types, one of
  *                       which is ParseTOKENTYPE.  The entry in the union
  *                       for base tokens is called "yy0".
+ *    YYMINORTYPES(X)    lists the number and type of every member of
+ *                       YYMINORTYPE, for ParseUnionReport().
+ *    YYBOXTYPES(X)      If defined, lists the types of the %boxed symbols.
+ *                       Their values are kept in a box arena, one box per
+ *                       stack entry, and YYMINORTYPE holds a pointer to
+ *                       the box in its "yybox" member.
  *    YYSTACKDEPTH       is the maximum depth of the parser's stack.  If
  *                       zero the stack is dynamically sized using realloc()
  *    ParseARG_SDECL     A static variable declaration for the %extra_argument
  *    ParseARG_PDECL     A parameter declaration for the %extra_argument
  *    ParseARG_STORE     Code to store %extra_argument into yypParser
  *    ParseARG_FETCH     Code to extract %extra_argument from yypParser
+ *    ParseARG_PARAM(X)  Passes X as the %extra_argument in a call to Parse
  *    YYNSTATE           the combined number of states.
  *    YYNRULE            the number of rules in the grammar
  *    YYERRORSYMBOL      is the code number of the error symbol.  If not
  *                       defined, then do no error processing.
+ *    YYSYNCTOKEN        is the code number of the %sync_token.  If
+ *                       defined, ParseParallel() is available when
+ *                       YYPARSEPOOL is also defined.
+ *    YYTABLEFILE        If defined, the parse tables are read at run time
+ *                       by ParseLoadTables() instead of compiled in.
+ *    YYTABLESIGNATURE   identifies the symbols and rules of the grammar
+ *                       that a table file must have been made from.
+ *    YYNTOKEN           the number of terminals.
  */
 
 // clang-format off
@@ -62,10 +79,16 @@
 #ifndef NDEBUG
 #include <stdio.h>
 void ParseTrace(FILE *, char *);
+void ParseUnionReport(FILE *);
 #endif
 void *ParseAlloc();
 void ParseFree(void *);
 void Parse(void *, int , ParseTOKENTYPE yyminor ParseARG_PDECL);
+int ParseExpectedTokens(void *, int *, int);
+#ifdef YYTABLEFILE
+int ParseLoadTables(const char *);
+void ParseUnloadTables(void);
+#endif
 
 /* First off, code is included that follows the "include" declaration
  * in the input grammar file.
@@ -73,6 +96,18 @@ void Parse(void *, int , ParseTOKENTYPE yyminor ParseARG_PDECL);
 // clang-format off
 %%
 // clang-format on
+#ifdef YYBOXTYPES
+#include <string.h>
+
+/* The box of a stack entry holds the value of a boxed symbol, so that
+ * a large type does not make every entry of the stack as large.
+ */
+union yyBox {
+#define YY_BOX_MEMBER(N, T) T yy##N;
+  YYBOXTYPES(YY_BOX_MEMBER)
+#undef YY_BOX_MEMBER
+};
+#endif
 #define YY_NO_ACTION (YYNSTATE + YYNRULE + 2)
 #define YY_ACCEPT_ACTION (YYNSTATE + YYNRULE + 1)
 #define YY_ERROR_ACTION (YYNSTATE + YYNRULE)
@@ -128,7 +163,8 @@ static const YYMINORTYPE yyzerominor = {0};
  * a terminal symbol.  If the lookahead is a non-terminal (as occurs after
  * a reduce action) then the yy_reduce_ofst[] array is used in place of
  * the yy_shift_ofst[] array and YY_REDUCE_USE_DFLT is used in place of
- * YY_SHIFT_USE_DFLT.
+ * YY_SHIFT_USE_DFLT, and a goto that is not in the table is found in
+ * yy_goto_default[X-YYNTOKEN] instead of yy_default[S].
  *
  * The following are the tables generated in this section:
  *
@@ -140,10 +176,340 @@ static const YYMINORTYPE yyzerominor = {0};
  *  yy_reduce_ofst[]   For each state, the offset into yy_action for
  *                     shifting non-terminals after a reduce.
  *  yy_default[]       Default action for each state.
+ *  yy_goto_default[]  For each non-terminal, the state that most gotos on
+ *                     it lead to.  yy_action holds only the others.
+ *  yy_expected[]      Bitmaps of YY_EXPECTED_WORDS words of the terminals
+ *                     that states expect, for ParseExpectedTokens().
+ *  yy_expected_row[]  For each state, the number of its bitmap.
+ *  yy_token_class[]   For each terminal, the terminal whose actions it
+ *                     shares.  Only present if YYTOKENCLASS is defined.
+ *
+ * States numbered YY_MIN_AUTOREDUCE and up have no action but to reduce
+ * by the rule of yy_default[], which the parser does right after the
+ * shift into them unless YYNOEAGERREDUCE is defined.
  */
 // clang-format off
 %%
 // clang-format on
+#ifdef YYTABLEFILE
+/* The tables above are not compiled into this parser.  ParseLoadTables()
+ * reads them at run time from the binary file that "lemon -b" writes
+ * along with the parser, and the macros below stand for their parts.
+ *
+ * The file starts with the 8 bytes "LEMONTBL" and a header of the
+ * YYTBL_NWORD words numbered below.  Every table is an array of
+ * 32-bit integers at the offset from the start of the file given in
+ * the header, and the parser reads it where it lies.  All integers are
+ * in the byte order of the machine that ran lemon.  The token names
+ * come last, as offsets to NUL-terminated strings.
+ */
+#include <stdio.h>
+#include <string.h>
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define YYTBL_MAGIC "LEMONTBL"
+#define YYTBL_VERSION 4
+#define YYTBL_BYTEORDER 0x01020304
+
+enum {
+  YYTBL_W_VERSION,       // YYTBL_VERSION
+  YYTBL_W_BYTEORDER,     // YYTBL_BYTEORDER, as written by lemon
+  YYTBL_W_SIGNATURE,     // YYTABLESIGNATURE of the grammar
+  YYTBL_W_NOCODE,        // YYNOCODE
+  YYTBL_W_NRULE,         // YYNRULE
+  YYTBL_W_NSTATE,        // YYNSTATE
+  YYTBL_W_NACTION,       // Entries in yy_action[] and yy_lookahead[]
+  YYTBL_W_NSHIFT,        // Entries in yy_shift_ofst[]
+  YYTBL_W_NREDUCE,       // Entries in yy_reduce_ofst[]
+  YYTBL_W_SHIFT_DFLT,    // YY_SHIFT_USE_DFLT
+  YYTBL_W_REDUCE_DFLT,   // YY_REDUCE_USE_DFLT
+  YYTBL_W_MIN_AUTOREDUCE, // YY_MIN_AUTOREDUCE
+  YYTBL_W_NTOKEN,        // Entries in yy_token_class[]
+  YYTBL_W_NFALLBACK,     // Entries in yyFallback[]
+  YYTBL_W_NEXPECTED,     // Number of bitmaps in yy_expected[]
+  YYTBL_W_ACTION,        // Offset of yy_action[]
+  YYTBL_W_LOOKAHEAD,     // Offset of yy_lookahead[]
+  YYTBL_W_SHIFT_OFST,    // Offset of yy_shift_ofst[]
+  YYTBL_W_REDUCE_OFST,   // Offset of yy_reduce_ofst[]
+  YYTBL_W_DEFAULT,       // Offset of yy_default[]
+  YYTBL_W_GOTO_DEFAULT,  // Offset of yy_goto_default[]
+  YYTBL_W_EXPECTED,      // Offset of yy_expected[]
+  YYTBL_W_EXPECTED_ROW,  // Offset of yy_expected_row[]
+  YYTBL_W_TOKEN_CLASS,   // Offset of yy_token_class[]
+  YYTBL_W_FALLBACK,      // Offset of yyFallback[]
+  YYTBL_W_TOKEN_NAME,    // Offset of the YYNOCODE-1 offsets of the names
+  YYTBL_W_SIZE,          // Size of the file in bytes, a multiple of 8
+  YYTBL_W_CHECKSUM,      // FNV-1a hash of all other words after the magic
+  YYTBL_NWORD
+};
+
+/* The tables in use, and the file they came from */
+static struct {
+  char *pFile;                              // Content of the table file
+  size_t nFile;                             // Size of the file in bytes
+  int isMapped;                             // True if pFile is mapped, false if malloc()ed
+  int nState;                               // YYNSTATE
+  int nAction;                              // YY_ACTTAB_COUNT
+  int nShift;                               // YY_SHIFT_COUNT+1
+  int nReduce;                              // YY_REDUCE_COUNT+1
+  int iShiftUseDflt;                        // YY_SHIFT_USE_DFLT
+  int iReduceUseDflt;                       // YY_REDUCE_USE_DFLT
+  int iMinAutoReduce;                       // YY_MIN_AUTOREDUCE
+  int nFallback;                            // Entries in yyFallback[]
+  const int *aAction;                       // yy_action[]
+  const int *aLookahead;                    // yy_lookahead[]
+  const int *aShiftOfst;                    // yy_shift_ofst[]
+  const int *aReduceOfst;                   // yy_reduce_ofst[]
+  const int *aDefault;                      // yy_default[]
+  const int *aGotoDefault;                  // yy_goto_default[]
+  const unsigned int *aExpected;            // yy_expected[]
+  const int *aExpectedRow;                  // yy_expected_row[]
+  const int *aTokenClass;                   // yy_token_class[]
+  const int *aFallback;                     // yyFallback[]
+#ifndef NDEBUG
+  const char **azTokenName;                 // yyTokenName[]
+#endif
+} yyTables;
+
+#define YY_ACTTAB_COUNT (yyTables.nAction)
+#define YY_SHIFT_USE_DFLT (yyTables.iShiftUseDflt)
+#define YY_SHIFT_COUNT (yyTables.nShift - 1)
+#define YY_REDUCE_USE_DFLT (yyTables.iReduceUseDflt)
+#define YY_REDUCE_COUNT (yyTables.nReduce - 1)
+#define YY_MIN_AUTOREDUCE (yyTables.iMinAutoReduce)
+#define YY_FALLBACK_COUNT (yyTables.nFallback)
+#define yy_action (yyTables.aAction)
+#define yy_lookahead (yyTables.aLookahead)
+#define yy_shift_ofst (yyTables.aShiftOfst)
+#define yy_reduce_ofst (yyTables.aReduceOfst)
+#define yy_default (yyTables.aDefault)
+#define yy_goto_default (yyTables.aGotoDefault)
+#define yy_expected (yyTables.aExpected)
+#define yy_expected_row (yyTables.aExpectedRow)
+#define YY_EXPECTED_WORDS ((YYNTOKEN + 31) / 32)
+#define yy_token_class (yyTables.aTokenClass)
+#define yyFallback (yyTables.aFallback)
+#ifndef NDEBUG
+#define yyTokenName (yyTables.azTokenName)
+#endif
+
+/* Return a pointer to the n words of a table at offset iOfst of the
+ * file, or NULL if they are not all inside the file or not aligned.
+ */
+static const int *
+yyTableAt(const char *pFile, size_t nFile, unsigned int iOfst, size_t n) {
+  if (iOfst % sizeof(int) != 0 || iOfst > nFile || n > (nFile - iOfst) / sizeof(int))
+    return 0;
+  return (const int *)&pFile[iOfst];
+}
+
+/* Add the n words of a[] to the FNV-1a hash h */
+static unsigned int
+yyTableChecksum(unsigned int h, const unsigned int *a, size_t n) {
+  size_t i;
+  for (i = 0; i < n; i++)
+    h = (h ^ a[i]) * 0x01000193;
+  return h;
+}
+
+/* Return true if all n values of a[] are between lwr and upr */
+static int
+yyTableInRange(const int *a, int n, int lwr, int upr) {
+  int i;
+  for (i = 0; i < n; i++) {
+    if (a[i] < lwr || a[i] > upr)
+      return 0;
+  }
+  return 1;
+}
+
+/* Release the tables read by ParseLoadTables().  No parser may be
+ * used afterwards until tables are loaded again.
+ */
+void
+ParseUnloadTables(void) {
+#ifndef NDEBUG
+  free((void *)yyTables.azTokenName);
+#endif
+  if (yyTables.isMapped) {
+#ifndef __WIN32__
+    munmap(yyTables.pFile, yyTables.nFile);
+#endif
+  } else {
+    free(yyTables.pFile);
+  }
+  memset(&yyTables, 0, sizeof(yyTables));
+}
+
+/* Read the parse tables from the file zFile, which "lemon -b" made from
+ * this same grammar.  The file is mapped into memory where the system
+ * allows it, so processes that load the same file share its pages.
+ * Tables loaded before are released.  No parser may be running while
+ * the tables change.
+ *
+ * Outputs:
+ * 0 on success.  -1 if the file cannot be read or does not hold tables
+ * for this grammar, in which case the tables in use stay as they were.
+ */
+int
+ParseLoadTables(const char *zFile) {
+  char *pFile = 0;
+  size_t nFile = 0;
+  int isMapped = 0;
+  const unsigned int *aHdr;
+  const int *aAction, *aLookahead, *aShiftOfst, *aReduceOfst, *aDefault, *aGotoDefault;
+  const int *aExpected, *aExpectedRow;
+  const int *aTokenClass, *aFallback, *aName;
+  int nState, nAction, nShift, nReduce, nFallback, nExpected, nLast, i;
+#ifndef NDEBUG
+  const char **azTokenName;
+#endif
+
+#ifndef __WIN32__
+  {
+    struct stat st;
+    int fd = open(zFile, O_RDONLY);
+    if (fd < 0)
+      return -1;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      nFile = (size_t)st.st_size;
+      pFile = (char *)mmap(0, nFile, PROT_READ, MAP_SHARED, fd, 0);
+      if (pFile == (char *)MAP_FAILED)
+        pFile = 0;
+      else
+        isMapped = 1;
+    }
+    close(fd);
+  }
+#endif
+  if (pFile == 0) {
+    FILE *in = fopen(zFile, "rb");
+    long n;
+    if (in == 0)
+      return -1;
+    if (fseek(in, 0, SEEK_END) == 0 && (n = ftell(in)) > 0 && fseek(in, 0, SEEK_SET) == 0) {
+      nFile = (size_t)n;
+      pFile = (char *)malloc(nFile);
+      if (pFile && fread(pFile, 1, nFile, in) != nFile) {
+        free(pFile);
+        pFile = 0;
+      }
+    }
+    fclose(in);
+    if (pFile == 0)
+      return -1;
+  }
+
+  /* Check that the file holds tables for this parser, undamaged, and
+   * that nothing in them leads the parser outside of them.
+   */
+  aHdr = (const unsigned int *)yyTableAt(pFile, nFile, 8, YYTBL_NWORD);
+  if (aHdr == 0 || memcmp(pFile, YYTBL_MAGIC, 8) != 0 || aHdr[YYTBL_W_VERSION] != YYTBL_VERSION ||
+      aHdr[YYTBL_W_BYTEORDER] != YYTBL_BYTEORDER || aHdr[YYTBL_W_SIGNATURE] != YYTABLESIGNATURE ||
+      aHdr[YYTBL_W_NOCODE] != YYNOCODE || aHdr[YYTBL_W_NRULE] != YYNRULE || aHdr[YYTBL_W_SIZE] != nFile ||
+      aHdr[YYTBL_W_NTOKEN] != YYNTOKEN || nFile % 8 != 0 || pFile[nFile - 1] != 0 ||
+      aHdr[YYTBL_W_CHECKSUM] != yyTableChecksum(yyTableChecksum(0x811c9dc5, aHdr, YYTBL_W_CHECKSUM),
+                                                &aHdr[YYTBL_NWORD], nFile / 4 - 2 - YYTBL_NWORD)) {
+    goto bad_file;
+  }
+  nState = (int)aHdr[YYTBL_W_NSTATE];
+  nAction = (int)aHdr[YYTBL_W_NACTION];
+  nShift = (int)aHdr[YYTBL_W_NSHIFT];
+  nReduce = (int)aHdr[YYTBL_W_NREDUCE];
+  nFallback = (int)aHdr[YYTBL_W_NFALLBACK];
+  nExpected = (int)aHdr[YYTBL_W_NEXPECTED];
+  if (nState <= 0 || nAction < 0 || nShift < 0 || nShift > nState || nReduce < 0 || nReduce > nState ||
+      nFallback < 0 || nFallback > YYNTOKEN || nExpected <= 0 || nExpected > nState) {
+    goto bad_file;
+  }
+  nLast = nState + YYNRULE + 2; // YY_NO_ACTION
+  aAction = yyTableAt(pFile, nFile, aHdr[YYTBL_W_ACTION], nAction);
+  aLookahead = yyTableAt(pFile, nFile, aHdr[YYTBL_W_LOOKAHEAD], nAction);
+  aShiftOfst = yyTableAt(pFile, nFile, aHdr[YYTBL_W_SHIFT_OFST], nShift);
+  aReduceOfst = yyTableAt(pFile, nFile, aHdr[YYTBL_W_REDUCE_OFST], nReduce);
+  aDefault = yyTableAt(pFile, nFile, aHdr[YYTBL_W_DEFAULT], nState);
+  aGotoDefault = yyTableAt(pFile, nFile, aHdr[YYTBL_W_GOTO_DEFAULT], YYNOCODE - 1 - YYNTOKEN);
+  aExpected = yyTableAt(pFile, nFile, aHdr[YYTBL_W_EXPECTED], (size_t)nExpected * YY_EXPECTED_WORDS);
+  aExpectedRow = yyTableAt(pFile, nFile, aHdr[YYTBL_W_EXPECTED_ROW], nState);
+  aTokenClass = yyTableAt(pFile, nFile, aHdr[YYTBL_W_TOKEN_CLASS], YYNTOKEN);
+  aFallback = yyTableAt(pFile, nFile, aHdr[YYTBL_W_FALLBACK], nFallback);
+  aName = yyTableAt(pFile, nFile, aHdr[YYTBL_W_TOKEN_NAME], YYNOCODE - 1);
+  if (aAction == 0 || aLookahead == 0 || aShiftOfst == 0 || aReduceOfst == 0 || aDefault == 0 || aGotoDefault == 0 ||
+      aTokenClass == 0 || aFallback == 0 || aName == 0 || aExpected == 0 || aExpectedRow == 0 ||
+      !yyTableInRange(aExpectedRow, nState, 0, nExpected - 1) ||
+      !yyTableInRange(aAction, nAction, 0, nLast) || !yyTableInRange(aLookahead, nAction, 0, YYNOCODE - 1) ||
+      !yyTableInRange(aDefault, nState, 0, nLast) || !yyTableInRange(aGotoDefault, YYNOCODE - 1 - YYNTOKEN, 0, nLast) ||
+      !yyTableInRange(aTokenClass, YYNTOKEN, 0, YYNTOKEN - 1) ||
+      !yyTableInRange(aFallback, nFallback, 0, YYNTOKEN - 1) ||
+      !yyTableInRange(aName, YYNOCODE - 1, (int)aHdr[YYTBL_W_TOKEN_NAME] + 4 * (YYNOCODE - 1), (int)nFile - 1)) {
+    goto bad_file;
+  }
+#ifndef NDEBUG
+  azTokenName = (const char **)malloc((YYNOCODE - 1) * sizeof(azTokenName[0]));
+  if (azTokenName == 0)
+    goto bad_file;
+  for (i = 0; i < YYNOCODE - 1; i++)
+    azTokenName[i] = &pFile[aName[i]];
+#endif
+
+  ParseUnloadTables();
+  yyTables.pFile = pFile;
+  yyTables.nFile = nFile;
+  yyTables.isMapped = isMapped;
+  yyTables.nState = nState;
+  yyTables.nAction = nAction;
+  yyTables.nShift = nShift;
+  yyTables.nReduce = nReduce;
+  yyTables.iShiftUseDflt = (int)aHdr[YYTBL_W_SHIFT_DFLT];
+  yyTables.iReduceUseDflt = (int)aHdr[YYTBL_W_REDUCE_DFLT];
+  yyTables.iMinAutoReduce = (int)aHdr[YYTBL_W_MIN_AUTOREDUCE];
+  yyTables.nFallback = nFallback;
+  yyTables.aAction = aAction;
+  yyTables.aLookahead = aLookahead;
+  yyTables.aShiftOfst = aShiftOfst;
+  yyTables.aReduceOfst = aReduceOfst;
+  yyTables.aDefault = aDefault;
+  yyTables.aGotoDefault = aGotoDefault;
+  yyTables.aExpected = (const unsigned int *)aExpected;
+  yyTables.aExpectedRow = aExpectedRow;
+  yyTables.aTokenClass = aTokenClass;
+  yyTables.aFallback = aFallback;
+#ifndef NDEBUG
+  yyTables.azTokenName = azTokenName;
+#endif
+  return 0;
+
+bad_file:
+  if (isMapped) {
+#ifndef __WIN32__
+    munmap(pFile, nFile);
+#endif
+  } else {
+    free(pFile);
+  }
+  return -1;
+}
+#else
+#define YY_FALLBACK_COUNT ((int)(sizeof(yyFallback) / sizeof(yyFallback[0])))
+#endif /* YYTABLEFILE */
+
+/* States from YY_MIN_AUTOREDUCE on are reduced right after the shift
+ * into them, unless YYNOEAGERREDUCE is defined or there are none.
+ */
+#ifndef YYNOEAGERREDUCE
+#ifdef YYTABLEFILE
+#define YYEAGERREDUCE 1
+#else
+#if YY_MIN_AUTOREDUCE < YYNSTATE
+#define YYEAGERREDUCE 1
+#endif
+#endif
+#endif
 
 /* The next table maps tokens into fallback tokens.  If a construct
  * like the following:
@@ -155,7 +521,7 @@ static const YYMINORTYPE yyzerominor = {0};
  * but it does not parse, the type of the token is changed to ID and
  * the parse is retried before an error is thrown.
  */
-#ifdef YYFALLBACK
+#if defined(YYFALLBACK) && !defined(YYTABLEFILE)
 static const YYCODETYPE yyFallback[] = {
 // clang-format off
 %%
@@ -195,12 +561,32 @@ struct yyParser {
 #if YYSTACKDEPTH <= 0
   int yystksz;           // Current side of the stack
   yyStackEntry *yystack; // The parser's stack
+#ifdef YYBOXTYPES
+  int yynbox;            // Number of chunks of boxes
+  union yyBox **yyboxes; // Chunks of YYBOXCHUNK boxes, which never move
+#endif
 #else
   yyStackEntry yystack[YYSTACKDEPTH]; // The parser's stack
+#ifdef YYBOXTYPES
+  union yyBox yybox[YYSTACKDEPTH + 1]; // The box of each stack entry, and one for a reduce
+#endif
 #endif
 };
 typedef struct yyParser yyParser;
 
+/* yyBoxAt(p, i) is the box of the i-th entry of the stack.  The box
+ * above the top of the stack holds the left-hand side of a reduce until
+ * the right-hand side is popped.
+ */
+#ifdef YYBOXTYPES
+#if YYSTACKDEPTH > 0
+#define yyBoxAt(p, i) (&(p)->yybox[i])
+#else
+#define YYBOXCHUNK 64
+#define yyBoxAt(p, i) (&(p)->yyboxes[(i) / YYBOXCHUNK][(i) % YYBOXCHUNK])
+#endif
+#endif
+
 #ifndef NDEBUG
 static FILE *yyTraceFILE = 0;
 static char *yyTracePrompt = 0;
@@ -231,14 +617,51 @@ ParseTrace(FILE *TraceFILE, char *zTracePrompt) {
     yyTraceFILE = 0;
 }
 
+/* Write the size of every member of the union of semantic values, to
+ * find the types that make each entry of the stack large.  A boxed type
+ * is listed with the size of its box, as the stack only holds a pointer
+ * to it.
+ */
+void
+ParseUnionReport(FILE *out) {
+  static const struct {
+    int iMember;       // The member is yy<iMember>
+    const char *zType; // Its type, as declared in the grammar
+    unsigned nByte;    // Size of the type
+    int isBoxed;       // True if the value is kept in a box
+  } aMember[] = {
+#define YY_MEMBER(N, T) {N, #T, (unsigned)sizeof(T), 0},
+    YYMINORTYPES(YY_MEMBER)
+#undef YY_MEMBER
+#ifdef YYBOXTYPES
+#define YY_MEMBER(N, T) {N, #T, (unsigned)sizeof(T), 1},
+    YYBOXTYPES(YY_MEMBER)
+#undef YY_MEMBER
+#endif
+  };
+  unsigned i;
+  fprintf(out, "YYMINORTYPE: %u bytes, stack entry: %u bytes\n", (unsigned)sizeof(YYMINORTYPE),
+          (unsigned)sizeof(yyStackEntry));
+  for (i = 0; i < sizeof(aMember) / sizeof(aMember[0]); i++) {
+    const char *zNote = "";
+    if (aMember[i].isBoxed)
+      zNote = "  (boxed)";
+    else if (aMember[i].nByte == sizeof(YYMINORTYPE))
+      zNote = "  (sets the size)";
+    fprintf(out, "  yy%-5d %6u  %s%s\n", aMember[i].iMember, aMember[i].nByte, aMember[i].zType, zNote);
+  }
+}
+
 /* For tracing shifts, the names of all terminals and nonterminals
  * are required.  The following table supplies these names
  */
+#ifndef YYTABLEFILE
 static const char *const yyTokenName[] = {
 // clang-format off
 %%
 // clang-format on
 };
+#endif
 
 /* For tracing reduce actions, the names of all rules are required. */
 static const char *const yyRuleName[] = {
@@ -256,6 +679,21 @@ yyGrowStack(yyParser *p) {
   yyStackEntry *pNew;
 
   newSize = p->yystksz * 2 + 100;
+#ifdef YYBOXTYPES
+  /* The stack holds pointers to boxes, so they are added a chunk at a
+   * time rather than moved.  There is one box more than stack entries.
+   */
+  while (p->yynbox <= newSize / YYBOXCHUNK) {
+    union yyBox **aNew = realloc(p->yyboxes, (p->yynbox + 1) * sizeof(aNew[0]));
+    if (aNew == 0)
+      return;
+    p->yyboxes = aNew;
+    aNew[p->yynbox] = malloc(YYBOXCHUNK * sizeof(union yyBox));
+    if (aNew[p->yynbox] == 0)
+      return;
+    p->yynbox++;
+  }
+#endif
   pNew = realloc(p->yystack, newSize * sizeof(pNew[0]));
   if (pNew) {
     p->yystack = pNew;
@@ -292,6 +730,10 @@ ParseAlloc() {
 #if YYSTACKDEPTH <= 0
     pParser->yystack = NULL;
     pParser->yystksz = 0;
+#ifdef YYBOXTYPES
+    pParser->yyboxes = NULL;
+    pParser->yynbox = 0;
+#endif
     yyGrowStack(pParser);
 #endif
   }
@@ -372,6 +814,11 @@ ParseFree(void *p) {
     yy_pop_parser_stack(pParser);
 #if YYSTACKDEPTH <= 0
   free(pParser->yystack);
+#ifdef YYBOXTYPES
+  while (pParser->yynbox > 0)
+    free(pParser->yyboxes[--pParser->yynbox]);
+  free(pParser->yyboxes);
+#endif
 #endif
   free((void *)pParser);
 }
@@ -385,8 +832,35 @@ ParseStackPeak(void *p) {
 }
 #endif
 
+/* Write the codes of up to nToken of the terminals that the parser
+ * expects next to aToken[], in increasing order, and return how many
+ * it expects in all.  Called from %syntax_error, these are the tokens
+ * that would have been accepted in place of the one in error.
+ */
+int
+ParseExpectedTokens(void *p, int *aToken, int nToken) {
+  yyParser *pParser = (yyParser *)p;
+  const unsigned int *aWord;
+  unsigned int w;
+  int stateno, i, j, n;
+
+  stateno = pParser->yyidx >= 0 ? pParser->yystack[pParser->yyidx].stateno : 0;
+  aWord = &yy_expected[yy_expected_row[stateno] * YY_EXPECTED_WORDS];
+  n = 0;
+  for (i = 0; i < YY_EXPECTED_WORDS; i++) {
+    for (w = aWord[i], j = 0; w; w >>= 1, j++) {
+      if (w & 1) {
+        if (n < nToken)
+          aToken[n] = i * 32 + j;
+        n++;
+      }
+    }
+  }
+  return n;
+}
+
 /* Find the appropriate action for a parser given the terminal
- * look-ahead token iLookAhead.
+ * look-ahead token iLookAhead, or rather its class in yy_token_class[].
  *
  * If the look-ahead token is YYNOCODE, then check to see if the action is
  * independent of the look-ahead.  If it is, return the action, otherwise
@@ -408,7 +882,7 @@ yy_find_shift_action(yyParser *pParser,    // The parser
     if (iLookAhead > 0) {
 #ifdef YYFALLBACK
       YYCODETYPE iFallback; // Fallback token
-      if (iLookAhead < sizeof(yyFallback) / sizeof(yyFallback[0]) && (iFallback = yyFallback[iLookAhead]) != 0) {
+      if (iLookAhead < YY_FALLBACK_COUNT && (iFallback = yyFallback[iLookAhead]) != 0) {
 #ifndef NDEBUG
         if (yyTraceFILE) {
           fprintf(yyTraceFILE, "%sFALLBACK %s => %s\n", yyTracePrompt, yyTokenName[iLookAhead], yyTokenName[iFallback]);
@@ -421,11 +895,15 @@ yy_find_shift_action(yyParser *pParser,    // The parser
       {
         int j = i - iLookAhead + YYWILDCARD;
         if (
-#if YY_SHIFT_MIN + YYWILDCARD < 0
+#if defined(YYTABLEFILE) || YY_SHIFT_MIN + YYWILDCARD < 0
             j >= 0 &&
 #endif
+#ifdef YYTABLEFILE
+            j < YY_ACTTAB_COUNT &&
+#else
 #if YY_SHIFT_MAX + YYWILDCARD >= YY_ACTTAB_COUNT
             j < YY_ACTTAB_COUNT &&
+#endif
 #endif
             yy_lookahead[j] == YYWILDCARD) {
 #ifndef NDEBUG
@@ -450,33 +928,28 @@ yy_find_shift_action(yyParser *pParser,    // The parser
  *
  * If the look-ahead token is YYNOCODE, then check to see if the action is
  * independent of the look-ahead.  If it is, return the action, otherwise
- * return YY_NO_ACTION.
+ * return YY_NO_ACTION.  A goto that yy_action[] leaves out is the default
+ * of its non-terminal.
  */
 static int
 yy_find_reduce_action(int stateno,          // Current state number
                       YYCODETYPE iLookAhead // The look-ahead token
                       ) {
   int i;
-#ifdef YYERRORSYMBOL
-  if (stateno > YY_REDUCE_COUNT) {
-    return yy_default[stateno];
-  }
-#else
-  assert(stateno <= YY_REDUCE_COUNT);
-#endif
-  i = yy_reduce_ofst[stateno];
-  assert(i != YY_REDUCE_USE_DFLT);
   assert(iLookAhead != YYNOCODE);
-  i += iLookAhead;
+  if (stateno <= YY_REDUCE_COUNT && yy_reduce_ofst[stateno] != YY_REDUCE_USE_DFLT) {
+    i = yy_reduce_ofst[stateno] + iLookAhead;
+    if (i >= 0 && i < YY_ACTTAB_COUNT && yy_lookahead[i] == iLookAhead) {
+      return yy_action[i];
+    }
+  }
 #ifdef YYERRORSYMBOL
-  if (i < 0 || i >= YY_ACTTAB_COUNT || yy_lookahead[i] != iLookAhead) {
+  if (iLookAhead == YYERRORSYMBOL) {
     return yy_default[stateno];
   }
-#else
-  assert(i >= 0 && i < YY_ACTTAB_COUNT);
-  assert(yy_lookahead[i] == iLookAhead);
 #endif
-  return yy_action[i];
+  assert(iLookAhead >= YYNTOKEN);
+  return yy_goto_default[iLookAhead - YYNTOKEN];
 }
 
 /* The following routine is called if the stack overflows. */
@@ -544,7 +1017,8 @@ yy_shift(yyParser *yypParser,  // The parser to be shifted
 }
 
 /* The following table contains information about every rule that
- * is used during the reduce.
+ * is used during the reduce.  It is compiled in even with YYTABLEFILE,
+ * since the code of the rules below depends on it.
  */
 static const struct {
   YYCODETYPE lhs;     // Symbol on the left-hand side of the rule
@@ -592,6 +1066,15 @@ yy_reduce(yyParser *yypParser, // The parser
    * that it has not been previously stressed...  (SQLite ticket #2172)
    */
   yygotominor = yyzerominor;
+#ifdef YYBOXTYPES
+  /* A boxed left-hand side is built in the box above the top of the
+   * stack.  The action moves it down once the right-hand side is done.
+   * The box still holds whatever was built in it last, so it is zeroed
+   * here as yygotominor is above.
+   */
+  yygotominor.yybox = yyBoxAt(yypParser, yypParser->yyidx + 1);
+  memset(yygotominor.yybox, 0, sizeof(*yygotominor.yybox));
+#endif
 
   switch (yyruleno) {
     /* Beginning here are the reduction cases.  A typical example
@@ -720,6 +1203,7 @@ Parse(void *yyp,             // The parser
   YYMINORTYPE yyminorunion;
   int yyact;        // The parser action.
   int yyendofinput; // True if we are at the end of input
+  int yyclass;      // The column of yymajor in the action table
 #ifdef YYERRORSYMBOL
   int yyerrorhit = 0; // True if yymajor has invoked an error
 #endif
@@ -742,6 +1226,11 @@ Parse(void *yyp,             // The parser
   }
   yyminorunion.yy0 = yyminor;
   yyendofinput = (yymajor == 0);
+#ifdef YYTOKENCLASS
+  yyclass = yy_token_class[yymajor];
+#else
+  yyclass = yymajor;
+#endif
   ParseARG_STORE;
 
 #ifndef NDEBUG
@@ -751,12 +1240,22 @@ Parse(void *yyp,             // The parser
 #endif
 
   do {
-    yyact = yy_find_shift_action(yypParser, (YYCODETYPE)yymajor);
+    yyact = yy_find_shift_action(yypParser, (YYCODETYPE)yyclass);
     if (yyact < YYNSTATE) {
       assert(!yyendofinput); // Impossible to shift the $ token
       yy_shift(yypParser, yyact, yymajor, &yyminorunion);
       yypParser->yyerrcnt--;
       yymajor = YYNOCODE;
+#ifdef YYEAGERREDUCE
+      /* States from YY_MIN_AUTOREDUCE on reduce by their default rule
+       * whatever the next token is, so there is no need to wait for it.
+       * This lets the actions of a complete statement run before the
+       * tokenizer delivers another token.
+       */
+      while (yypParser->yyidx >= 0 && yypParser->yystack[yypParser->yyidx].stateno >= YY_MIN_AUTOREDUCE) {
+        yy_reduce(yypParser, yy_default[yypParser->yystack[yypParser->yyidx].stateno] - YYNSTATE);
+      }
+#endif
     } else if (yyact < YYNSTATE + YYNRULE) {
       yy_reduce(yypParser, yyact - YYNSTATE);
     } else {
@@ -855,3 +1354,145 @@ Parse(void *yyp,             // The parser
   } while (yymajor != YYNOCODE && yypParser->yyidx >= 0);
   return;
 }
+
+#ifdef YYPARSEPOOL
+#ifndef YYSYNCTOKEN
+#error "YYPARSEPOOL requires a %sync_token declaration in the grammar"
+#endif
+#include <pthread.h>
+
+/* The parallel driver.  The input is split into segments after every
+ * YYSYNCTOKEN, and every segment is parsed as a complete input on one of
+ * a pool of parsers, each owned by a worker thread.  The generated tables
+ * are read-only, so the parsers share nothing but the job below.
+ */
+typedef struct yyPoolJob {
+  const int *aMajor;            // Major token codes of the whole input
+  const ParseTOKENTYPE *aMinor; // Minor token values of the whole input
+  const int *aStart;            // First token of each segment, then nToken
+  int nSegment;                 // Number of segments
+  int iNext;                    // Next segment to hand out
+  void **apArg;                 // The %extra_argument of each segment
+  void *(*xArg)(void *, int);   // Makes the argument of a segment
+  void *pCtx;                   // First argument to xArg
+  pthread_mutex_t mutex;        // Protects iNext
+} yyPoolJob;
+
+/* Parse segments until the job runs out of them.  A worker that gets no
+ * parser leaves the segments to the others.
+ */
+static void *
+yy_pool_worker(void *pArg) {
+  yyPoolJob *pJob = (yyPoolJob *)pArg;
+  yyParser *pParser;
+  int i, j;
+
+  pParser = (yyParser *)ParseAlloc();
+  if (pParser == 0)
+    return 0;
+  for (;;) {
+    pthread_mutex_lock(&pJob->mutex);
+    i = pJob->iNext;
+    if (i < pJob->nSegment)
+      pJob->iNext++;
+    pthread_mutex_unlock(&pJob->mutex);
+    if (i >= pJob->nSegment)
+      break;
+    pArg = pJob->xArg(pJob->pCtx, i);
+    pJob->apArg[i] = pArg;
+    for (j = pJob->aStart[i]; j < pJob->aStart[i + 1]; j++) {
+      Parse(pParser, pJob->aMajor[j], pJob->aMinor[j] ParseARG_PARAM(pArg));
+    }
+    Parse(pParser, 0, yyzerominor.yy0 ParseARG_PARAM(pArg));
+    /* A segment that failed without recovering may leave symbols behind */
+    while (pParser->yyidx >= 0) {
+      yy_pop_parser_stack(pParser);
+    }
+  }
+  ParseFree(pParser);
+  return 0;
+}
+
+/* Parse the "nToken" tokens in aMajor[] and aMinor[] on "nThread" threads.
+ * The input does not include the final end-of-input token; every segment
+ * gets its own.
+ *
+ * "xArg" is called from the worker threads, once per segment and before
+ * its first token, to make the %extra_argument the segment is parsed with,
+ * so the %extra_argument must be a pointer.  Once the workers are done,
+ * "xMerge" is called from this thread with each of those arguments, in
+ * input order.
+ *
+ * Outputs:
+ * Zero on success, or non-zero if memory ran out.  If no thread could get
+ * a parser for the last segments, xMerge is called only for the segments
+ * before them, which are all that have an argument.
+ */
+int
+ParseParallel(const int *aMajor,                       // Major token codes
+              const ParseTOKENTYPE *aMinor,            // Minor token values
+              int nToken,                              // Number of tokens
+              int nThread,                             // Number of threads
+              void *(*xArg)(void *, int),              // Argument of a segment
+              void (*xMerge)(void *, int, void *),     // Merges a segment
+              void *pCtx                               // First argument to xArg and xMerge
+              ) {
+  yyPoolJob job;
+  pthread_t *aThread;
+  int *aStart;
+  int i, nSegment, nStarted;
+
+  nSegment = 0;
+  for (i = 0; i < nToken; i++) {
+    if (aMajor[i] == YYSYNCTOKEN || i == nToken - 1)
+      nSegment++;
+  }
+  aStart = (int *)malloc((nSegment + 1) * sizeof(aStart[0]));
+  job.apArg = (void **)malloc((nSegment + 1) * sizeof(job.apArg[0]));
+  if (nThread > nSegment)
+    nThread = nSegment;
+  if (nThread < 1)
+    nThread = 1;
+  aThread = (pthread_t *)malloc(nThread * sizeof(aThread[0]));
+  if (aStart == 0 || job.apArg == 0 || aThread == 0) {
+    free(aStart);
+    free(job.apArg);
+    free(aThread);
+    return 1;
+  }
+  nSegment = 0;
+  aStart[0] = 0;
+  for (i = 0; i < nToken; i++) {
+    if (aMajor[i] == YYSYNCTOKEN || i == nToken - 1)
+      aStart[++nSegment] = i + 1;
+  }
+
+  job.aMajor = aMajor;
+  job.aMinor = aMinor;
+  job.aStart = aStart;
+  job.nSegment = nSegment;
+  job.iNext = 0;
+  job.xArg = xArg;
+  job.pCtx = pCtx;
+  pthread_mutex_init(&job.mutex, 0);
+  for (nStarted = 0; nStarted < nThread; nStarted++) {
+    if (pthread_create(&aThread[nStarted], 0, yy_pool_worker, &job) != 0)
+      break;
+  }
+  for (i = 0; i < nStarted; i++) {
+    pthread_join(aThread[i], 0);
+  }
+  if (job.iNext < nSegment)
+    yy_pool_worker(&job); // No threads or no parsers to be had: parse the rest here
+  pthread_mutex_destroy(&job.mutex);
+
+  /* The segments are handed out in order, so those parsed come first */
+  for (i = 0; i < job.iNext; i++) {
+    xMerge(pCtx, i, job.apArg[i]);
+  }
+  free(aStart);
+  free(job.apArg);
+  free(aThread);
+  return job.iNext < nSegment;
+}
+#endif /* YYPARSEPOOL */
@@ -0,0 +1,669 @@
+/* C++ driver template for the LEMON parser generator.
+ * The author disclaims copyright to this source code.
+ *
+ * This template is selected with "-T lempar.hpp" and turns the grammar
+ * into a header holding the class template ParseParser.  It differs from
+ * lempar.c in three ways:
+ *
+ *   +  The tables are static constexpr members of the class.
+ *
+ *   +  Semantic values live in a tagged YYMINORTYPE that is moved, never
+ *      copied, between the caller, the stack and the reduce actions.
+ *
+ *   +  Every distinct reduce action is a member function of its own, which
+ *      the compiler is free to inline into yy_reduce_action().
+ *
+ * C++17 is required.  Every %type must be default-constructible and
+ * nothrow-movable.
+ */
+#pragma once
+#include <cassert>
+#include <cstdio>
+#include <new>
+#include <utility>
+#include <vector>
+
+/* Make sure the INTERFACE macro is defined. */
+#ifndef INTERFACE
+#define INTERFACE 1
+#endif
+
+/* These constants (all generated automatically by the parser generator)
+ * specify the various kinds of tokens (terminals) that the parser
+ * understands.
+ *
+ * Each symbol here is a terminal symbol in the grammar.
+ */
+// clang-format off
+%%
+// clang-format on
+/* The next thing included is series of defines which control
+ * various aspects of the generated parser.  They are the same as in
+ * lempar.c, except that YYMINORTYPE is a class defined below from
+ *    YYMINORTYPES(X)    which applies X(N, type) to every data type of
+ *                       the parser stack, to become member yyN.
+ */
+
+// clang-format off
+%%
+// clang-format on
+
+/* Next is the code that follows the "include" declaration in the input
+ * grammar file.
+ */
+// clang-format off
+%%
+// clang-format on
+#define YY_TYPEDEF(N, ...) typedef __VA_ARGS__ yytype##N;
+YYMINORTYPES(YY_TYPEDEF)
+#undef YY_TYPEDEF
+
+/* The semantic value stored at one level of the stack, with a member
+ * yyN of type yytypeN for every X(N, type) in YYMINORTYPES.  Method yyN()
+ * returns the value as a yytypeN.  If the object held a value of another
+ * type, or none at all, that value is destroyed and a default-constructed
+ * yytypeN takes its place first, so the left-hand side of a rule starts
+ * out empty instead of being reset to zero on every reduce.
+ */
+class YYMINORTYPE {
+public:
+  YYMINORTYPE() noexcept : yytag(-1) {}
+  YYMINORTYPE(YYMINORTYPE &&yyother) noexcept : yytag(-1) { yymove(yyother); }
+  YYMINORTYPE &operator=(YYMINORTYPE &&yyother) noexcept {
+    if (this != &yyother) {
+      yyreset();
+      yymove(yyother);
+    }
+    return *this;
+  }
+  ~YYMINORTYPE() { yyreset(); }
+
+#define YY_ACCESSOR(N, ...)                                                                                            \
+  yytype##N &yy##N() {                                                                                                 \
+    if (yytag != N) {                                                                                                  \
+      yyreset();                                                                                                       \
+      ::new ((void *)&yyu.yy##N) yytype##N();                                                                          \
+      yytag = N;                                                                                                       \
+    }                                                                                                                  \
+    return yyu.yy##N;                                                                                                  \
+  }
+  YYMINORTYPES(YY_ACCESSOR)
+#undef YY_ACCESSOR
+
+private:
+  /* Destroy the value held, if any */
+  void yyreset() noexcept {
+    switch (yytag) {
+#define YY_DESTROY(N, ...)                                                                                             \
+  case N:                                                                                                              \
+    yyu.yy##N.~yytype##N();                                                                                            \
+    break;
+      YYMINORTYPES(YY_DESTROY)
+#undef YY_DESTROY
+    }
+    yytag = -1;
+  }
+
+  /* Take over the value of an empty-handed object */
+  void yymove(YYMINORTYPE &yyother) noexcept {
+    switch (yyother.yytag) {
+#define YY_MOVE(N, ...)                                                                                                \
+  case N:                                                                                                              \
+    ::new ((void *)&yyu.yy##N) yytype##N(std::move(yyother.yyu.yy##N));                                                \
+    break;
+      YYMINORTYPES(YY_MOVE)
+#undef YY_MOVE
+    }
+    yytag = yyother.yytag;
+    yyother.yyreset();
+  }
+
+  int yytag; // Which member of yyu holds a value, or -1 if none
+  union yyunion {
+    yyunion() {}
+    ~yyunion() {}
+#define YY_MEMBER(N, ...) yytype##N yy##N;
+    YYMINORTYPES(YY_MEMBER)
+#undef YY_MEMBER
+  } yyu;
+};
+
+#define YY_NO_ACTION (YYNSTATE + YYNRULE + 2)
+#define YY_ACCEPT_ACTION (YYNSTATE + YYNRULE + 1)
+#define YY_ERROR_ACTION (YYNSTATE + YYNRULE)
+
+/* Define the yytestcase() macro to be a no-op if is not already defined
+ * otherwise.
+ */
+#ifndef yytestcase
+#define yytestcase(X)
+#endif
+
+/* The parser.  YYDEPTH is the maximum depth of its stack, or zero for a
+ * stack that grows as needed.
+ *
+ * Usage, with the names changed by %name:
+ *
+ *      ParseParser<> parser;
+ *      parser.Parse(major, minor, ...);   // For every token
+ *      parser.Parse(0, minor, ...);       // At the end of input
+ */
+template <int YYDEPTH = YYSTACKDEPTH>
+class ParseParser {
+public:
+  ParseParser() { yystack.reserve(YYDEPTH > 0 ? YYDEPTH : 100); }
+  ParseParser(const ParseParser &) = delete;
+  ParseParser &operator=(const ParseParser &) = delete;
+
+  /* Destructors are called for all stack elements */
+  ~ParseParser() {
+    while (!yystack.empty())
+      yy_pop_parser_stack();
+  }
+
+#ifndef NDEBUG
+  /* Turn tracing on by giving a stream and a prompt for each trace
+   * message.  Tracing is turned off by making either argument NULL.
+   */
+  void
+  ParseTrace(FILE *TraceFILE, const char *zTracePrompt) {
+    yyTraceFILE = TraceFILE;
+    yyTracePrompt = zTracePrompt;
+    if (yyTraceFILE == 0)
+      yyTracePrompt = 0;
+    else if (yyTracePrompt == 0)
+      yyTraceFILE = 0;
+  }
+#endif
+
+#ifdef YYTRACKMAXSTACKDEPTH
+  /* Return the peak depth of the stack */
+  int
+  ParseStackPeak() const {
+    return yyidxMax;
+  }
+#endif
+
+  int ParseExpectedTokens(int *aToken, int nToken) const;
+
+  void Parse(int yymajor, ParseTOKENTYPE yyminor ParseARG_PDECL);
+
+private:
+  /* The action tables, described in lempar.c */
+  // clang-format off
+%%
+  // clang-format on
+
+#ifdef YYFALLBACK
+  /* The next table maps tokens into fallback tokens. */
+  static constexpr YYCODETYPE yyFallback[] = {
+  // clang-format off
+%%
+  // clang-format on
+  };
+#endif /* YYFALLBACK */
+
+  /* One element of the parser's stack */
+  struct yyStackEntry {
+    YYACTIONTYPE stateno; // The state-number
+    YYCODETYPE major;     // The major token value.  This is the code number for the token at this stack level
+    YYMINORTYPE minor;    // The user-supplied minor token value.  This is the value of the token
+  };
+
+  std::vector<yyStackEntry> yystack; // The parser's stack
+#ifdef YYTRACKMAXSTACKDEPTH
+  int yyidxMax = 0; // Maximum index of the top of the stack
+#endif
+  int yyerrcnt = -1; // Shifts left before out of the error
+  ParseARG_SDECL     // A place to hold %extra_argument
+
+#ifndef NDEBUG
+  FILE *yyTraceFILE = 0;
+  const char *yyTracePrompt = 0;
+
+  /* For tracing shifts, the names of all terminals and nonterminals
+   * are required.  The following table supplies these names
+   */
+  static constexpr const char *yyTokenName[] = {
+  // clang-format off
+%%
+  // clang-format on
+  };
+
+  /* For tracing reduce actions, the names of all rules are required. */
+  static constexpr const char *yyRuleName[] = {
+  // clang-format off
+%%
+  // clang-format on
+  };
+#endif /* NDEBUG */
+
+  /* The following function deletes the value associated with a
+   * symbol.  The symbol can be either a terminal or nonterminal.
+   * "yymajor" is the symbol code, and "yypminor" is a pointer to
+   * the value.
+   */
+  void
+  yy_destructor(YYCODETYPE yymajor,   // Type code for object to destroy
+                YYMINORTYPE *yypminor // The object to be destroyed
+                ) {
+    switch (yymajor) {
+      /* Here is inserted the actions which take place when a
+       * terminal or non-terminal is destroyed.
+       */
+    // clang-format off
+%%
+    // clang-format on
+    default : break; // If no destructor action specified: do nothing
+    }
+    (void)yypminor;
+  }
+
+  /* Pop the parser's stack once, calling the destructor of the symbol
+   * popped.  Return the major token number for the symbol popped.
+   */
+  int
+  yy_pop_parser_stack() {
+    YYCODETYPE yymajor;
+
+    if (yystack.empty())
+      return 0;
+    yyStackEntry &yytos = yystack.back();
+#ifndef NDEBUG
+    if (yyTraceFILE) {
+      fprintf(yyTraceFILE, "%sPopping %s\n", yyTracePrompt, yyTokenName[yytos.major]);
+    }
+#endif
+    yymajor = yytos.major;
+    yy_destructor(yymajor, &yytos.minor);
+    yystack.pop_back();
+    return yymajor;
+  }
+
+  /* Find the appropriate action for a parser given the terminal
+   * look-ahead token iLookAhead, or rather its class in yy_token_class[].
+   */
+  int
+  yy_find_shift_action(YYCODETYPE iLookAhead // The look-ahead token
+                       ) {
+    int i;
+    int stateno = yystack.back().stateno;
+
+    if (stateno > YY_SHIFT_COUNT || (i = yy_shift_ofst[stateno]) == YY_SHIFT_USE_DFLT) {
+      return yy_default[stateno];
+    }
+    assert(iLookAhead != YYNOCODE);
+    i += iLookAhead;
+    if (i < 0 || i >= YY_ACTTAB_COUNT || yy_lookahead[i] != iLookAhead) {
+      if (iLookAhead > 0) {
+#ifdef YYFALLBACK
+        YYCODETYPE iFallback; // Fallback token
+        if (iLookAhead < sizeof(yyFallback) / sizeof(yyFallback[0]) && (iFallback = yyFallback[iLookAhead]) != 0) {
+#ifndef NDEBUG
+          if (yyTraceFILE) {
+            fprintf(yyTraceFILE, "%sFALLBACK %s => %s\n", yyTracePrompt, yyTokenName[iLookAhead],
+                    yyTokenName[iFallback]);
+          }
+#endif
+          return yy_find_shift_action(iFallback);
+        }
+#endif
+#ifdef YYWILDCARD
+        {
+          int j = i - iLookAhead + YYWILDCARD;
+          if (
+#if YY_SHIFT_MIN + YYWILDCARD < 0
+              j >= 0 &&
+#endif
+#if YY_SHIFT_MAX + YYWILDCARD >= YY_ACTTAB_COUNT
+              j < YY_ACTTAB_COUNT &&
+#endif
+              yy_lookahead[j] == YYWILDCARD) {
+#ifndef NDEBUG
+            if (yyTraceFILE) {
+              fprintf(yyTraceFILE, "%sWILDCARD %s => %s\n", yyTracePrompt, yyTokenName[iLookAhead],
+                      yyTokenName[YYWILDCARD]);
+            }
+#endif /* NDEBUG */
+            return yy_action[j];
+          }
+        }
+#endif /* YYWILDCARD */
+      }
+      return yy_default[stateno];
+    } else {
+      return yy_action[i];
+    }
+  }
+
+  /* Find the appropriate action for a parser given the non-terminal
+   * look-ahead token iLookAhead.  A goto that yy_action[] leaves out is
+   * the default of its non-terminal.
+   */
+  static int
+  yy_find_reduce_action(int stateno,          // Current state number
+                        YYCODETYPE iLookAhead // The look-ahead token
+                        ) {
+    int i;
+    assert(iLookAhead != YYNOCODE);
+    if (stateno <= YY_REDUCE_COUNT && yy_reduce_ofst[stateno] != YY_REDUCE_USE_DFLT) {
+      i = yy_reduce_ofst[stateno] + iLookAhead;
+      if (i >= 0 && i < YY_ACTTAB_COUNT && yy_lookahead[i] == iLookAhead) {
+        return yy_action[i];
+      }
+    }
+#ifdef YYERRORSYMBOL
+    if (iLookAhead == YYERRORSYMBOL) {
+      return yy_default[stateno];
+    }
+#endif
+    assert(iLookAhead >= YYNTOKEN);
+    return yy_goto_default[iLookAhead - YYNTOKEN];
+  }
+
+  /* The following routine is called if the stack overflows. */
+  void
+  yyStackOverflow(YYMINORTYPE *yypMinor) {
+#ifndef NDEBUG
+    if (yyTraceFILE) {
+      fprintf(yyTraceFILE, "%sStack Overflow!\n", yyTracePrompt);
+    }
+#endif
+    while (!yystack.empty())
+      yy_pop_parser_stack();
+    (void)yypMinor;
+    /* Here code is inserted which will execute if the parser
+     * stack every overflows */
+    // clang-format off
+%%
+    // clang-format on
+  }
+
+  /* Perform a shift action, moving the minor token onto the stack. */
+  void
+  yy_shift(int yyNewState,      // The new state to shift in
+           int yyMajor,         // The major token to shift in
+           YYMINORTYPE &&yyMinor // The minor token to shift in
+           ) {
+    if (YYDEPTH > 0 && (int)yystack.size() >= YYDEPTH) {
+      yyStackOverflow(&yyMinor);
+      return;
+    }
+    yystack.push_back(yyStackEntry{(YYACTIONTYPE)yyNewState, (YYCODETYPE)yyMajor, std::move(yyMinor)});
+#ifdef YYTRACKMAXSTACKDEPTH
+    if ((int)yystack.size() - 1 > yyidxMax) {
+      yyidxMax = (int)yystack.size() - 1;
+    }
+#endif
+#ifndef NDEBUG
+    if (yyTraceFILE && yystack.size() > 1) {
+      size_t i;
+      fprintf(yyTraceFILE, "%sShift %d\n", yyTracePrompt, yyNewState);
+      fprintf(yyTraceFILE, "%sStack:", yyTracePrompt);
+      for (i = 1; i < yystack.size(); i++)
+        fprintf(yyTraceFILE, " %s", yyTokenName[yystack[i].major]);
+      fprintf(yyTraceFILE, "\n");
+    }
+#endif
+  }
+
+  /* The following table contains information about every rule that
+   * is used during the reduce.
+   */
+  struct yyRuleInfoEntry {
+    YYCODETYPE lhs;     // Symbol on the left-hand side of the rule
+    unsigned char nrhs; // Number of right-hand side symbols in the rule
+  };
+  static constexpr yyRuleInfoEntry yyRuleInfo[] = {
+  // clang-format off
+%%
+  // clang-format on
+  };
+
+  /* Beginning here are the reduce actions: a member function for every
+   * distinct action, followed by yy_reduce_action() which picks one by
+   * rule number.  A typical example follows:
+   *
+   *   void yy_rule_0(yyStackEntry *yymsp, YYMINORTYPE &yygotominor) {
+   *  #line <lineno> <grammarfile>
+   *     { ... }           // User supplied code
+   *  #line <lineno> <thisfile>
+   *   }
+   */
+  // clang-format off
+%%
+  // clang-format on
+
+  /* Perform a reduce action and the shift that must immediately
+   * follow the reduce.
+   */
+  void
+  yy_reduce(int yyruleno // Number of the rule by which to reduce
+            ) {
+    int yygoto;              // The next state
+    int yyact;               // The next action
+    YYMINORTYPE yygotominor; // The LHS of the rule reduced
+    int yysize;              // Amount to pop the stack
+#ifndef NDEBUG
+    if (yyTraceFILE && yyruleno >= 0 && yyruleno < (int)(sizeof(yyRuleName) / sizeof(yyRuleName[0]))) {
+      fprintf(yyTraceFILE, "%sReduce [%s].\n", yyTracePrompt, yyRuleName[yyruleno]);
+    }
+#endif /* NDEBUG */
+
+    yy_reduce_action(yyruleno, &yystack.back(), yygotominor);
+    yygoto = yyRuleInfo[yyruleno].lhs;
+    yysize = yyRuleInfo[yyruleno].nrhs;
+    yystack.erase(yystack.end() - yysize, yystack.end());
+    yyact = yy_find_reduce_action(yystack.back().stateno, (YYCODETYPE)yygoto);
+    if (yyact < YYNSTATE) {
+      yy_shift(yyact, yygoto, std::move(yygotominor));
+    } else {
+      assert(yyact == YYNSTATE + YYNRULE + 1);
+      yy_accept();
+    }
+  }
+
+  /* The following code executes when the parse fails */
+#ifndef YYNOERRORRECOVERY
+  void
+  yy_parse_failed() {
+#ifndef NDEBUG
+    if (yyTraceFILE) {
+      fprintf(yyTraceFILE, "%sFail!\n", yyTracePrompt);
+    }
+#endif
+    while (!yystack.empty())
+      yy_pop_parser_stack();
+    /* Here code is inserted which will be executed whenever the
+     * parser fails
+     */
+    // clang-format off
+%%
+    // clang-format on
+  }
+#endif /* YYNOERRORRECOVERY */
+
+  /* The following code executes when a syntax error first occurs. */
+  void
+  yy_syntax_error(int yymajor,         // The major type of the error token
+                  YYMINORTYPE &yyminor // The minor type of the error token
+                  ) {
+#define TOKEN (yyminor.yy0())
+    // clang-format off
+%%
+    // clang-format on
+#undef TOKEN
+    (void)yymajor;
+    (void)yyminor;
+  }
+
+  /* The following is executed when the parser accepts */
+  void
+  yy_accept() {
+#ifndef NDEBUG
+    if (yyTraceFILE) {
+      fprintf(yyTraceFILE, "%sAccept!\n", yyTracePrompt);
+    }
+#endif
+    while (!yystack.empty())
+      yy_pop_parser_stack();
+    /* Here code is inserted which will be executed whenever the
+     * parser accepts
+     */
+    // clang-format off
+%%
+    // clang-format on
+  }
+};
+
+/* Write the codes of up to nToken of the terminals that the parser
+ * expects next to aToken[], in increasing order, and return how many it
+ * expects in all.  Called from %syntax_error, these are the tokens that
+ * would have been accepted in place of the one in error.
+ */
+template <int YYDEPTH>
+int
+ParseParser<YYDEPTH>::ParseExpectedTokens(int *aToken, int nToken) const {
+  const unsigned int *aWord;
+  unsigned int w;
+  int stateno, i, j, n;
+
+  stateno = yystack.empty() ? 0 : yystack.back().stateno;
+  aWord = &yy_expected[yy_expected_row[stateno] * YY_EXPECTED_WORDS];
+  n = 0;
+  for (i = 0; i < YY_EXPECTED_WORDS; i++) {
+    for (w = aWord[i], j = 0; w; w >>= 1, j++) {
+      if (w & 1) {
+        if (n < nToken)
+          aToken[n] = i * 32 + j;
+        n++;
+      }
+    }
+  }
+  return n;
+}
+
+/* The main parser program.  The first argument is the major token
+ * number, the second the minor token, which is moved onto the stack,
+ * and the third optional argument is whatever the user wants (and
+ * specified in the grammar) and is available for use by the action
+ * routines.
+ */
+template <int YYDEPTH>
+void
+ParseParser<YYDEPTH>::Parse(int yymajor,           // The major token code number
+                            ParseTOKENTYPE yyminor // The value for the token
+                            ParseARG_PDECL         // Optional %extra_argument parameter
+                            ) {
+  YYMINORTYPE yyminorunion;
+  int yyact;        // The parser action.
+  int yyendofinput; // True if we are at the end of input
+  int yyclass;      // The column of yymajor in the action table
+#ifdef YYERRORSYMBOL
+  int yyerrorhit = 0; // True if yymajor has invoked an error
+#endif
+  ParseParser *yypParser = this; // For ParseARG_STORE
+  (void)yypParser;
+
+  /* (re)initialize the parser, if necessary */
+  if (yystack.empty()) {
+    yyerrcnt = -1;
+    yystack.push_back(yyStackEntry{0, 0, YYMINORTYPE()});
+  }
+  yyminorunion.yy0() = std::move(yyminor);
+  yyendofinput = (yymajor == 0);
+#ifdef YYTOKENCLASS
+  yyclass = yy_token_class[yymajor];
+#else
+  yyclass = yymajor;
+#endif
+  ParseARG_STORE;
+
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sInput %s\n", yyTracePrompt, yyTokenName[yymajor]);
+  }
+#endif
+
+  do {
+    yyact = yy_find_shift_action((YYCODETYPE)yyclass);
+    if (yyact < YYNSTATE) {
+      assert(!yyendofinput); // Impossible to shift the $ token
+      yy_shift(yyact, yymajor, std::move(yyminorunion));
+      yyerrcnt--;
+      yymajor = YYNOCODE;
+#if YY_MIN_AUTOREDUCE < YYNSTATE && !defined(YYNOEAGERREDUCE)
+      /* Reduce at once in states that would reduce whatever comes next */
+      while (!yystack.empty() && yystack.back().stateno >= YY_MIN_AUTOREDUCE) {
+        yy_reduce(yy_default[yystack.back().stateno] - YYNSTATE);
+      }
+#endif
+    } else if (yyact < YYNSTATE + YYNRULE) {
+      yy_reduce(yyact - YYNSTATE);
+    } else {
+      assert(yyact == YY_ERROR_ACTION);
+#ifdef YYERRORSYMBOL
+      int yymx;
+#endif
+#ifndef NDEBUG
+      if (yyTraceFILE) {
+        fprintf(yyTraceFILE, "%sSyntax Error!\n", yyTracePrompt);
+      }
+#endif
+#ifdef YYERRORSYMBOL
+      /* A syntax error has occurred.  The recovery is the same as in
+       * lempar.c: report it, pop the stack until the error symbol can be
+       * shifted, shift it, and accept no new errors for three tokens.
+       */
+      if (yyerrcnt < 0) {
+        yy_syntax_error(yymajor, yyminorunion);
+      }
+      yymx = yystack.back().major;
+      if (yymx == YYERRORSYMBOL || yyerrorhit) {
+#ifndef NDEBUG
+        if (yyTraceFILE) {
+          fprintf(yyTraceFILE, "%sDiscard input token %s\n", yyTracePrompt, yyTokenName[yymajor]);
+        }
+#endif
+        yy_destructor((YYCODETYPE)yymajor, &yyminorunion);
+        yymajor = YYNOCODE;
+      } else {
+        while (!yystack.empty() && yymx != YYERRORSYMBOL &&
+               (yyact = yy_find_reduce_action(yystack.back().stateno, YYERRORSYMBOL)) >= YYNSTATE) {
+          yy_pop_parser_stack();
+        }
+        if (yystack.empty() || yymajor == 0) {
+          yy_destructor((YYCODETYPE)yymajor, &yyminorunion);
+          yy_parse_failed();
+          yymajor = YYNOCODE;
+        } else if (yymx != YYERRORSYMBOL) {
+          YYMINORTYPE u2;
+          u2.YYERRSYMDT() = 0;
+          yy_shift(yyact, YYERRORSYMBOL, std::move(u2));
+        }
+      }
+      yyerrcnt = 3;
+      yyerrorhit = 1;
+#elif defined(YYNOERRORRECOVERY)
+      /* Report the error and go on as if nothing had happened. */
+      yy_syntax_error(yymajor, yyminorunion);
+      yy_destructor((YYCODETYPE)yymajor, &yyminorunion);
+      yymajor = YYNOCODE;
+
+#else // YYERRORSYMBOL is not defined
+      /* Report the error, throw away the input token, and fail the parse
+       * at the end of input.
+       */
+      if (yyerrcnt <= 0) {
+        yy_syntax_error(yymajor, yyminorunion);
+      }
+      yyerrcnt = 3;
+      yy_destructor((YYCODETYPE)yymajor, &yyminorunion);
+      if (yyendofinput) {
+        yy_parse_failed();
+      }
+      yymajor = YYNOCODE;
+#endif
+    }
+  } while (yymajor != YYNOCODE && !yystack.empty());
+}
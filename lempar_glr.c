@@ -0,0 +1,1412 @@
+/* GLR driver template for the LEMON parser generator.
+ * The author disclaims copyright to this source code.
+ *
+ * This template is used instead of lempar.c when lemon is run with the
+ * -G switch.  The tables keep every parsing conflict the grammar could
+ * not resolve, and the parser splits into several branches whenever it
+ * meets one.  See the comment above yyGlrNode for the details.
+ */
+#include <assert.h>
+#include <stdlib.h>
+
+/* Make sure the INTERFACE macro is defined. */
+#ifndef INTERFACE
+#define INTERFACE 1
+#endif
+
+/* Next is all token values, in a form suitable for use by makeheaders.
+ * This section will be null unless lemon is run with the -m switch.
+ */
+/* These constants (all generated automatically by the parser generator)
+ * specify the various kinds of tokens (terminals) that the parser
+ * understands.
+ *
+ * Each symbol here is a terminal symbol in the grammar.
+ */
+// clang-format off
+%%
+// clang-format on
+/* The next thing included is series of defines which control
+ * various aspects of the generated parser.
+ *    YYCODETYPE         is the data type used for storing terminal
+ *                       and nonterminal numbers.  "unsigned char" is
+ *                       used if there are fewer than 250 terminals
+ *                       and nonterminals.  "int" is used otherwise.
+ *    YYNOCODE           is a number of type YYCODETYPE which corresponds
+ *                       to no legal terminal or nonterminal number.  This
+ *                       number is used to fill in empty slots of the hash
+ *                       table.
+ *    YYFALLBACK         If defined, this indicates that one or more tokens
+ *                       have fall-back values which should be used if the
+ *                       original value of the token will not parse.
+ *    YYTOKENCLASS       If defined, terminals are looked up in the action
+ *                       table by their class in yy_token_class[].
+ *    YYACTIONTYPE       is the data type used for storing terminal
+ *                       and nonterminal numbers.  "unsigned char" is
+ *                       used if there are fewer than 250 rules and
+ *                       states combined.  "int" is used otherwise.
+ *    ParseTOKENTYPE     is the data type used for minor tokens given
+ *                       directly to the parser from the tokenizer.
+ *    YYMINORTYPE        is the data type used for all minor tokens.
+ *                       This is typically a union of many types, one of
+ *                       which is ParseTOKENTYPE.  The entry in the union
+ *                       for base tokens is called "yy0".
+ *    YYSTACKDEPTH       is the maximum depth of the parser's stack.  If
+ *                       zero the stack is dynamically sized using realloc()
+ *    ParseARG_SDECL     A static variable declaration for the %extra_argument
+ *    ParseARG_PDECL     A parameter declaration for the %extra_argument
+ *    ParseARG_STORE     Code to store %extra_argument into yypParser
+ *    ParseARG_FETCH     Code to extract %extra_argument from yypParser
+ *    YYNSTATE           the combined number of states.
+ *    YYNRULE            the number of rules in the grammar
+ *    YYERRORSYMBOL      is the code number of the error symbol.  If not
+ *                       defined, then do no error processing.
+ *    YYNTOKEN           the number of terminals.
+ */
+
+// clang-format off
+%%
+// clang-format on
+#ifndef NDEBUG
+#include <stdio.h>
+void ParseTrace(FILE *, char *);
+#endif
+void *ParseAlloc();
+void ParseFree(void *);
+void Parse(void *, int , ParseTOKENTYPE yyminor ParseARG_PDECL);
+int ParseExpectedTokens(void *, int *, int);
+
+/* First off, code is included that follows the "include" declaration
+ * in the input grammar file.
+ */
+// clang-format off
+%%
+// clang-format on
+#define YY_NO_ACTION (YYNSTATE + YYNRULE + 2)
+#define YY_ACCEPT_ACTION (YYNSTATE + YYNRULE + 1)
+#define YY_ERROR_ACTION (YYNSTATE + YYNRULE)
+#define YY_CONFLICT_ACTION (YYNSTATE + YYNRULE + 3)
+
+/* The yyzerominor constant is used to initialize instances of
+ * YYMINORTYPE objects to zero.
+ */
+static const YYMINORTYPE yyzerominor = {0};
+
+/* Define the yytestcase() macro to be a no-op if is not already defined
+ * otherwise.
+ *
+ * Applications can choose to define yytestcase() in the %include section
+ * to a macro that can assist in verifying code coverage.  For production
+ * code the yytestcase() macro should be turned off.  But it is useful
+ * for testing.
+ */
+#ifndef yytestcase
+#define yytestcase(X)
+#endif
+
+/* Next are the tables used to determine what action to take based on the
+ * current state and lookahead token.  These tables are used to implement
+ * functions that take a state number and lookahead value and return an
+ * action integer.
+ *
+ * Suppose the action integer is N.  Then the action is determined as
+ * follows
+ *
+ *   0 <= N < YYNSTATE                  Shift N.  That is, push the lookahead
+ *                                      token onto the stack and goto state N.
+ *
+ *   YYNSTATE <= N < YYNSTATE+YYNRULE   Reduce by rule N-YYNSTATE.
+ *
+ *   N == YYNSTATE+YYNRULE              A syntax error has occurred.
+ *
+ *   N == YYNSTATE+YYNRULE+1            The parser accepts its input.
+ *
+ *   N == YYNSTATE+YYNRULE+2            No such action.  Denotes unused
+ *                                      slots in the yy_action[] table.
+ *
+ *   YYNSTATE+YYNRULE+3 <= N            A parsing conflict.  All the actions
+ *                                      which may be taken are listed from
+ *                                      yy_conflict[N-YYNSTATE-YYNRULE-3]
+ *                                      up to the next YY_NO_ACTION, the one
+ *                                      LR would have taken first.
+ *
+ * The action table is constructed as a single large table named yy_action[].
+ * Given state S and lookahead X, the action is computed as
+ *
+ *      yy_action[ yy_shift_ofst[S] + X ]
+ *
+ * If the index value yy_shift_ofst[S]+X is out of range or if the value
+ * yy_lookahead[yy_shift_ofst[S]+X] is not equal to X or if yy_shift_ofst[S]
+ * is equal to YY_SHIFT_USE_DFLT, it means that the action is not in the table
+ * and that yy_default[S] should be used instead.
+ *
+ * The formula above is for computing the action when the lookahead is
+ * a terminal symbol.  If the lookahead is a non-terminal (as occurs after
+ * a reduce action) then the yy_reduce_ofst[] array is used in place of
+ * the yy_shift_ofst[] array and YY_REDUCE_USE_DFLT is used in place of
+ * YY_SHIFT_USE_DFLT, and a goto that is not in the table is found in
+ * yy_goto_default[X-YYNTOKEN] instead of yy_default[S].
+ *
+ * The following are the tables generated in this section:
+ *
+ *  yy_action[]        A single table containing all actions.
+ *  yy_lookahead[]     A table containing the lookahead for each entry in
+ *                     yy_action.  Used to detect hash collisions.
+ *  yy_shift_ofst[]    For each state, the offset into yy_action for
+ *                     shifting terminals.
+ *  yy_reduce_ofst[]   For each state, the offset into yy_action for
+ *                     shifting non-terminals after a reduce.
+ *  yy_default[]       Default action for each state.
+ *  yy_goto_default[]  For each non-terminal, the state that most gotos on
+ *                     it lead to.  yy_action holds only the others.
+ *  yy_expected[]      Bitmaps of YY_EXPECTED_WORDS words of the terminals
+ *                     that states expect, for ParseExpectedTokens().
+ *  yy_expected_row[]  For each state, the number of its bitmap.
+ *  yy_token_class[]   For each terminal, the terminal whose actions it
+ *                     shares.  Only present if YYTOKENCLASS is defined.
+ *  yy_conflict[]      The lists of actions of every parsing conflict.
+ *
+ * States numbered YY_MIN_AUTOREDUCE and up have no action but to reduce
+ * by the rule of yy_default[], which the parser does right after the
+ * shift into them unless YYNOEAGERREDUCE is defined.
+ */
+// clang-format off
+%%
+// clang-format on
+
+/* The next table maps tokens into fallback tokens.  If a construct
+ * like the following:
+ *
+ *      %fallback ID X Y Z.
+ *
+ * appears in the grammar, then ID becomes a fallback token for X, Y,
+ * and Z.  Whenever one of the tokens X, Y, or Z is input to the parser
+ * but it does not parse, the type of the token is changed to ID and
+ * the parse is retried before an error is thrown.
+ */
+#ifdef YYFALLBACK
+static const YYCODETYPE yyFallback[] = {
+// clang-format off
+%%
+// clang-format on
+};
+#endif /* YYFALLBACK */
+
+/* The following structure represents a single element of the
+ * parser's stack.  Information stored includes:
+ *
+ *   +  The state number for the parser at this level of the stack.
+ *
+ *   +  The value of the token stored at this level of the stack.
+ *      (In other words, the "major" token.)
+ *
+ *   +  The semantic value stored at this level of the stack.  This is
+ *      the information used by the action routines in the grammar.
+ *      It is sometimes called the "minor" token.
+ */
+struct yyStackEntry {
+  YYACTIONTYPE stateno; // The state-number
+  YYCODETYPE major;     // The major token value.  This is the code number for the token at this stack level
+  YYMINORTYPE minor;    // The user-supplied minor token value.  This is the value of the token
+};
+typedef struct yyStackEntry yyStackEntry;
+
+#if YY_CONFLICT_COUNT > 0
+/* While the input is deterministic the parser runs on its stack exactly
+ * like the LR driver.  When a parsing conflict is seen, the parser splits:
+ * every action of the conflict continues as a branch of its own, and the
+ * entries the branches push are kept in a graph-structured stack of
+ * yyGlrNode objects on top of the plain stack, which becomes the shared
+ * trunk of all branches.  The trunk is not changed while split.
+ *
+ * A branch which hits a syntax error dies.  Two reductions of the same
+ * token which end in the same state on top of the same entry are
+ * ambiguous parses of the same input; the first one found wins, which is
+ * the one LR would have taken.
+ *
+ * The reduce actions of the grammar are deferred while split, so only
+ * the parse which survives ever runs them: a node made by a reduce
+ * records the rule and the right-hand side it popped.  As soon as a
+ * single branch remains, its deferred actions run in input order and
+ * the branch is moved onto the trunk.
+ *
+ * Every branch alive at a token has shifted every token since the split,
+ * so the values in the nodes of a dying branch are copies of values held
+ * by the survivors, and the nodes are dropped without their destructors.
+ */
+typedef struct yyGlrNode yyGlrNode;
+
+/* A position in the graph-structured stack: a node or a trunk entry */
+struct yyGlrPos {
+  yyGlrNode *pNode; // A node, or NULL for an entry of the trunk
+  int iTrunk;       // Index of the trunk entry if pNode is NULL
+};
+typedef struct yyGlrPos yyGlrPos;
+
+struct yyGlrNode {
+  yyGlrPos below; // The entry under this one.  Free nodes chain through below.pNode
+  yyGlrPos rhs;   // The top of the right-hand side of a deferred reduce
+  int iRule;      // Rule of the deferred reduce, or -1 if e.minor holds the value
+  int nRef;       // References from heads and from the nodes above
+  yyStackEntry e; // State, symbol and value of this entry
+};
+
+/* A growable list of branch heads.  "act" is an action already chosen
+ * for the head, or -1 to look it up.
+ */
+struct yyGlrList {
+  struct {
+    yyGlrPos pos;
+    int act;
+  } *a;
+  int n;      // Number of heads in the list
+  int nAlloc; // Number of slots allocated for a[]
+};
+typedef struct yyGlrList yyGlrList;
+#endif /* YY_CONFLICT_COUNT */
+
+/* The state of the parser is completely contained in an instance of
+ * the following structure
+ */
+struct yyParser {
+  int yyidx; // Index of top element in stack
+#ifdef YYTRACKMAXSTACKDEPTH
+  int yyidxMax; // Maximum value of yyidx
+#endif
+  int yyerrcnt;  // Shifts left before out of the error
+  ParseARG_SDECL // A place to hold %extra_argument
+#if YYSTACKDEPTH <= 0
+  int yystksz;           // Current side of the stack
+  yyStackEntry *yystack; // The parser's stack
+#else
+  yyStackEntry yystack[YYSTACKDEPTH]; // The parser's stack
+#endif
+#if YY_CONFLICT_COUNT > 0
+  yyGlrList yyheads;        // Heads of the live branches.  Empty while not split
+  yyGlrList yywork;         // Heads yet to act on the current token
+  yyGlrList yynext;         // Heads which shifted the current token
+  yyGlrList yymade;         // Nodes made by a reduce on the current token
+  yyGlrNode *yyfree;        // Nodes ready for reuse
+  yyStackEntry yyrhs[256];  // The right-hand side of a deferred reduce
+#endif
+};
+typedef struct yyParser yyParser;
+
+#ifndef NDEBUG
+static FILE *yyTraceFILE = 0;
+static char *yyTracePrompt = 0;
+
+/* Turn parser tracing on by giving a stream to which to write the trace
+ * and a prompt to preface each trace message.  Tracing is turned off
+ * by making either argument NULL
+ *
+ * Inputs:
+ * <ul>
+ * <li> A FILE* to which trace output should be written.
+ *      If NULL, then tracing is turned off.
+ * <li> A prefix string written at the beginning of every
+ *      line of trace output.  If NULL, then tracing is
+ *      turned off.
+ * </ul>
+ *
+ * Outputs:
+ * None.
+ */
+void
+ParseTrace(FILE *TraceFILE, char *zTracePrompt) {
+  yyTraceFILE = TraceFILE;
+  yyTracePrompt = zTracePrompt;
+  if (yyTraceFILE == 0)
+    yyTracePrompt = 0;
+  else if (yyTracePrompt == 0)
+    yyTraceFILE = 0;
+}
+
+/* For tracing shifts, the names of all terminals and nonterminals
+ * are required.  The following table supplies these names
+ */
+static const char *const yyTokenName[] = {
+// clang-format off
+%%
+// clang-format on
+};
+
+/* For tracing reduce actions, the names of all rules are required. */
+static const char *const yyRuleName[] = {
+// clang-format off
+%%
+// clang-format on
+};
+#endif /* NDEBUG */
+
+#if YYSTACKDEPTH <= 0
+/* Try to increase the size of the parser stack. */
+static void
+yyGrowStack(yyParser *p) {
+  int newSize;
+  yyStackEntry *pNew;
+
+  newSize = p->yystksz * 2 + 100;
+  pNew = realloc(p->yystack, newSize * sizeof(pNew[0]));
+  if (pNew) {
+    p->yystack = pNew;
+    p->yystksz = newSize;
+#ifndef NDEBUG
+    if (yyTraceFILE) {
+      fprintf(yyTraceFILE, "%sStack grows to %d entries!\n", yyTracePrompt, p->yystksz);
+    }
+#endif
+  }
+}
+#endif
+
+/* This function allocates a new parser.
+ * The only argument is a pointer to a function which works like
+ * malloc.
+ *
+ * Inputs:
+ * A pointer to the function used to allocate memory.
+ *
+ * Outputs:
+ * A pointer to a parser.  This pointer is used in subsequent calls
+ * to Parse and ParseFree.
+ */
+void *
+ParseAlloc() {
+  yyParser *pParser;
+  pParser = (yyParser *)malloc((size_t)sizeof(yyParser));
+  if (pParser) {
+    pParser->yyidx = -1;
+#ifdef YYTRACKMAXSTACKDEPTH
+    pParser->yyidxMax = 0;
+#endif
+#if YYSTACKDEPTH <= 0
+    pParser->yystack = NULL;
+    pParser->yystksz = 0;
+    yyGrowStack(pParser);
+#endif
+#if YY_CONFLICT_COUNT > 0
+    pParser->yyheads.a = pParser->yywork.a = pParser->yynext.a = pParser->yymade.a = NULL;
+    pParser->yyheads.n = pParser->yywork.n = pParser->yynext.n = pParser->yymade.n = 0;
+    pParser->yyheads.nAlloc = pParser->yywork.nAlloc = pParser->yynext.nAlloc = pParser->yymade.nAlloc = 0;
+    pParser->yyfree = NULL;
+#endif
+  }
+  return pParser;
+}
+
+/* The following function deletes the value associated with a
+ * symbol.  The symbol can be either a terminal or nonterminal.
+ * "yymajor" is the symbol code, and "yypminor" is a pointer to
+ * the value.
+ */
+static void
+yy_destructor(yyParser *yypParser,  // The parser
+              YYCODETYPE yymajor,   // Type code for object to destroy
+              YYMINORTYPE *yypminor // The object to be destroyed
+              ) {
+  ParseARG_FETCH;
+  switch (yymajor) {
+    /* Here is inserted the actions which take place when a
+     * terminal or non-terminal is destroyed.  This can happen
+     * when the symbol is popped from the stack during a
+     * reduce or during error processing or when a parser is
+     * being destroyed before it is finished parsing.
+     *
+     * Note: during a reduce, the only symbols destroyed are those
+     * which appear on the RHS of the rule, but which are not used
+     * inside the C code.
+     */
+// clang-format off
+%%
+// clang-format on
+    default : break; // If no destructor action specified: do nothing
+  }
+}
+
+/* Pop the parser's stack once.
+ *
+ * If there is a destructor routine associated with the token which
+ * is popped from the stack, then call it.
+ *
+ * Return the major token number for the symbol popped.
+ */
+static int
+yy_pop_parser_stack(yyParser *pParser) {
+  YYCODETYPE yymajor;
+  yyStackEntry *yytos = &pParser->yystack[pParser->yyidx];
+
+  if (pParser->yyidx < 0)
+    return 0;
+#ifndef NDEBUG
+  if (yyTraceFILE && pParser->yyidx >= 0) {
+    fprintf(yyTraceFILE, "%sPopping %s\n", yyTracePrompt, yyTokenName[yytos->major]);
+  }
+#endif
+  yymajor = yytos->major;
+  yy_destructor(pParser, yymajor, &yytos->minor);
+  pParser->yyidx--;
+  return yymajor;
+}
+
+/* Return the peak depth of the stack for a parser. */
+#ifdef YYTRACKMAXSTACKDEPTH
+int
+ParseStackPeak(void *p) {
+  yyParser *pParser = (yyParser *)p;
+  return pParser->yyidxMax;
+}
+#endif
+
+/* Write the codes of up to nToken of the terminals that the parser
+ * expects next to aToken[], in increasing order, and return how many
+ * it expects in all.  While the parser is split, these are the tokens
+ * of the state at the top of the stack it shares, where the split began.
+ */
+int
+ParseExpectedTokens(void *p, int *aToken, int nToken) {
+  yyParser *pParser = (yyParser *)p;
+  const unsigned int *aWord;
+  unsigned int w;
+  int stateno, i, j, n;
+
+  stateno = pParser->yyidx >= 0 ? pParser->yystack[pParser->yyidx].stateno : 0;
+  aWord = &yy_expected[yy_expected_row[stateno] * YY_EXPECTED_WORDS];
+  n = 0;
+  for (i = 0; i < YY_EXPECTED_WORDS; i++) {
+    for (w = aWord[i], j = 0; w; w >>= 1, j++) {
+      if (w & 1) {
+        if (n < nToken)
+          aToken[n] = i * 32 + j;
+        n++;
+      }
+    }
+  }
+  return n;
+}
+
+/* Find the appropriate action for a parser in state "stateno" given
+ * the terminal look-ahead token iLookAhead, or rather its class in
+ * yy_token_class[].
+ *
+ * If the look-ahead token is YYNOCODE, then check to see if the action is
+ * independent of the look-ahead.  If it is, return the action, otherwise
+ * return YY_NO_ACTION.
+ */
+static int
+yy_find_shift_action(int stateno,          // Current state number
+                     YYCODETYPE iLookAhead // The look-ahead token
+                     ) {
+  int i;
+
+  if (stateno > YY_SHIFT_COUNT || (i = yy_shift_ofst[stateno]) == YY_SHIFT_USE_DFLT) {
+    return yy_default[stateno];
+  }
+  assert(iLookAhead != YYNOCODE);
+  i += iLookAhead;
+  if (i < 0 || i >= YY_ACTTAB_COUNT || yy_lookahead[i] != iLookAhead) {
+    if (iLookAhead > 0) {
+#ifdef YYFALLBACK
+      YYCODETYPE iFallback; // Fallback token
+      if (iLookAhead < sizeof(yyFallback) / sizeof(yyFallback[0]) && (iFallback = yyFallback[iLookAhead]) != 0) {
+#ifndef NDEBUG
+        if (yyTraceFILE) {
+          fprintf(yyTraceFILE, "%sFALLBACK %s => %s\n", yyTracePrompt, yyTokenName[iLookAhead], yyTokenName[iFallback]);
+        }
+#endif
+        return yy_find_shift_action(stateno, iFallback);
+      }
+#endif
+#ifdef YYWILDCARD
+      {
+        int j = i - iLookAhead + YYWILDCARD;
+        if (
+#if YY_SHIFT_MIN + YYWILDCARD < 0
+            j >= 0 &&
+#endif
+#if YY_SHIFT_MAX + YYWILDCARD >= YY_ACTTAB_COUNT
+            j < YY_ACTTAB_COUNT &&
+#endif
+            yy_lookahead[j] == YYWILDCARD) {
+#ifndef NDEBUG
+          if (yyTraceFILE) {
+            fprintf(yyTraceFILE, "%sWILDCARD %s => %s\n", yyTracePrompt, yyTokenName[iLookAhead],
+                    yyTokenName[YYWILDCARD]);
+          }
+#endif /* NDEBUG */
+          return yy_action[j];
+        }
+      }
+#endif /* YYWILDCARD */
+    }
+    return yy_default[stateno];
+  } else {
+    return yy_action[i];
+  }
+}
+
+/* Find the appropriate action for a parser given the non-terminal
+ * look-ahead token iLookAhead.
+ *
+ * If the look-ahead token is YYNOCODE, then check to see if the action is
+ * independent of the look-ahead.  If it is, return the action, otherwise
+ * return YY_NO_ACTION.  A goto that yy_action[] leaves out is the default
+ * of its non-terminal.
+ */
+static int
+yy_find_reduce_action(int stateno,          // Current state number
+                      YYCODETYPE iLookAhead // The look-ahead token
+                      ) {
+  int i;
+  assert(iLookAhead != YYNOCODE);
+  if (stateno <= YY_REDUCE_COUNT && yy_reduce_ofst[stateno] != YY_REDUCE_USE_DFLT) {
+    i = yy_reduce_ofst[stateno] + iLookAhead;
+    if (i >= 0 && i < YY_ACTTAB_COUNT && yy_lookahead[i] == iLookAhead) {
+      return yy_action[i];
+    }
+  }
+#ifdef YYERRORSYMBOL
+  if (iLookAhead == YYERRORSYMBOL) {
+    return yy_default[stateno];
+  }
+#endif
+  assert(iLookAhead >= YYNTOKEN);
+  return yy_goto_default[iLookAhead - YYNTOKEN];
+}
+
+/* The following routine is called if the stack overflows. */
+static void
+yyStackOverflow(yyParser *yypParser, YYMINORTYPE *yypMinor) {
+  ParseARG_FETCH;
+  yypParser->yyidx--;
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sStack Overflow!\n", yyTracePrompt);
+  }
+#endif
+  while (yypParser->yyidx >= 0)
+    yy_pop_parser_stack(yypParser);
+  /* Here code is inserted which will execute if the parser
+   * stack every overflows */
+// clang-format off
+%%
+// clang-format on
+  ParseARG_STORE; // Suppress warning about unused %extra_argument var
+}
+
+/* Perform a shift action. */
+static void
+yy_shift(yyParser *yypParser,  // The parser to be shifted
+         int yyNewState,       // The new state to shift in
+         int yyMajor,          // The major token to shift in
+         YYMINORTYPE *yypMinor // Pointer to the minor token to shift in
+         ) {
+  yyStackEntry *yytos;
+  yypParser->yyidx++;
+#ifdef YYTRACKMAXSTACKDEPTH
+  if (yypParser->yyidx > yypParser->yyidxMax) {
+    yypParser->yyidxMax = yypParser->yyidx;
+  }
+#endif
+#if YYSTACKDEPTH > 0
+  if (yypParser->yyidx >= YYSTACKDEPTH) {
+    yyStackOverflow(yypParser, yypMinor);
+    return;
+  }
+#else
+  if (yypParser->yyidx >= yypParser->yystksz) {
+    yyGrowStack(yypParser);
+    if (yypParser->yyidx >= yypParser->yystksz) {
+      yyStackOverflow(yypParser, yypMinor);
+      return;
+    }
+  }
+#endif
+  yytos = &yypParser->yystack[yypParser->yyidx];
+  yytos->stateno = (YYACTIONTYPE)yyNewState;
+  yytos->major = (YYCODETYPE)yyMajor;
+  yytos->minor = *yypMinor;
+#ifndef NDEBUG
+  if (yyTraceFILE && yypParser->yyidx > 0) {
+    int i;
+    fprintf(yyTraceFILE, "%sShift %d\n", yyTracePrompt, yyNewState);
+    fprintf(yyTraceFILE, "%sStack:", yyTracePrompt);
+    for (i = 1; i <= yypParser->yyidx; i++)
+      fprintf(yyTraceFILE, " %s", yyTokenName[yypParser->yystack[i].major]);
+    fprintf(yyTraceFILE, "\n");
+  }
+#endif
+}
+
+/* The following table contains information about every rule that
+ * is used during the reduce.
+ */
+static const struct {
+  YYCODETYPE lhs;     // Symbol on the left-hand side of the rule
+  unsigned char nrhs; // Number of right-hand side symbols in the rule
+} yyRuleInfo[] = {
+// clang-format off
+%%
+// clang-format on
+};
+
+static void yy_accept(yyParser *); // Forward Declaration
+
+/* Run the reduce action of rule "yyruleno" on the right-hand side
+ * whose last entry is "yymsp", and return the value of the left-hand
+ * side.
+ */
+static YYMINORTYPE
+yy_reduce_action(yyParser *yypParser, // The parser
+                 int yyruleno,        // Number of the rule by which to reduce
+                 yyStackEntry *yymsp  // The last entry of the right-hand side
+                 ) {
+  YYMINORTYPE yygotominor; // The LHS of the rule reduced
+  ParseARG_FETCH;
+#ifndef NDEBUG
+  if (yyTraceFILE && yyruleno >= 0 && yyruleno < (int)(sizeof(yyRuleName) / sizeof(yyRuleName[0]))) {
+    fprintf(yyTraceFILE, "%sReduce [%s].\n", yyTracePrompt, yyRuleName[yyruleno]);
+  }
+#endif /* NDEBUG */
+
+  /* See the comment in yy_reduce() of lempar.c */
+  yygotominor = yyzerominor;
+
+  switch (yyruleno) {
+    /* Beginning here are the reduction cases.  A typical example
+     * follows:
+     *   case 0:
+     *  #line <lineno> <grammarfile>
+     *     { ... }           // User supplied code
+     *  #line <lineno> <thisfile>
+     *     break;
+     */
+// clang-format off
+%%
+// clang-format on
+  };
+  return yygotominor;
+}
+
+/* Perform a reduce action and the shift that must immediately
+ * follow the reduce.
+ */
+static void
+yy_reduce(yyParser *yypParser, // The parser
+          int yyruleno         // Number of the rule by which to reduce
+          ) {
+  int yygoto;              // The next state
+  int yyact;               // The next action
+  YYMINORTYPE yygotominor; // The LHS of the rule reduced
+  yyStackEntry *yymsp;     // The top of the parser's stack
+  int yysize;              // Amount to pop the stack
+  yymsp = &yypParser->yystack[yypParser->yyidx];
+  yygotominor = yy_reduce_action(yypParser, yyruleno, yymsp);
+  yygoto = yyRuleInfo[yyruleno].lhs;
+  yysize = yyRuleInfo[yyruleno].nrhs;
+  yypParser->yyidx -= yysize;
+  yyact = yy_find_reduce_action(yymsp[-yysize].stateno, (YYCODETYPE)yygoto);
+  if (yyact < YYNSTATE) {
+#ifdef NDEBUG
+    /* If we are not debugging and the reduce action popped at least
+     * one element off the stack, then we can push the new element back
+     * onto the stack here, and skip the stack overflow test in yy_shift().
+     * That gives a significant speed improvement.
+     */
+    if (yysize) {
+      yypParser->yyidx++;
+      yymsp -= yysize - 1;
+      yymsp->stateno = (YYACTIONTYPE)yyact;
+      yymsp->major = (YYCODETYPE)yygoto;
+      yymsp->minor = yygotominor;
+    } else
+#endif
+    {
+      yy_shift(yypParser, yyact, yygoto, &yygotominor);
+    }
+  } else {
+    assert(yyact == YYNSTATE + YYNRULE + 1);
+    yy_accept(yypParser);
+  }
+}
+
+#if YY_CONFLICT_COUNT > 0
+/* Return a position on the trunk */
+static yyGlrPos
+yy_glr_trunk(int iTrunk) {
+  yyGlrPos pos;
+  pos.pNode = NULL;
+  pos.iTrunk = iTrunk;
+  return pos;
+}
+
+/* Return the position of a node */
+static yyGlrPos
+yy_glr_pos(yyGlrNode *pNode) {
+  yyGlrPos pos;
+  pos.pNode = pNode;
+  pos.iTrunk = 0;
+  return pos;
+}
+
+/* Return the stack entry at a position */
+static yyStackEntry *
+yy_glr_entry(yyParser *p, yyGlrPos pos) {
+  return pos.pNode ? &pos.pNode->e : &p->yystack[pos.iTrunk];
+}
+
+/* Return the position under a position */
+static yyGlrPos
+yy_glr_below(yyGlrPos pos) {
+  return pos.pNode ? pos.pNode->below : yy_glr_trunk(pos.iTrunk - 1);
+}
+
+/* Return a new node with one reference on top of "below", taking over a
+ * reference to "below".  Return NULL if out of memory.
+ */
+static yyGlrNode *
+yy_glr_node(yyParser *p, yyGlrPos below, int stateno, int major) {
+  yyGlrNode *pNode = p->yyfree;
+  if (pNode) {
+    p->yyfree = pNode->below.pNode;
+  } else {
+    pNode = (yyGlrNode *)malloc(sizeof(*pNode));
+    if (pNode == 0)
+      return 0;
+  }
+  pNode->below = below;
+  pNode->iRule = -1;
+  pNode->nRef = 1;
+  pNode->e.stateno = (YYACTIONTYPE)stateno;
+  pNode->e.major = (YYCODETYPE)major;
+  pNode->e.minor = yyzerominor;
+  return pNode;
+}
+
+/* Add a reference to a position */
+static void
+yy_glr_ref(yyGlrPos pos) {
+  if (pos.pNode)
+    pos.pNode->nRef++;
+}
+
+/* Drop a reference to a position.  Nodes nobody refers to any longer
+ * are recycled without calling destructors.
+ */
+static void
+yy_glr_unref(yyParser *p, yyGlrPos pos) {
+  yyGlrNode *pNode;
+  while ((pNode = pos.pNode) != 0 && --pNode->nRef == 0) {
+    if (pNode->iRule >= 0 && yyRuleInfo[pNode->iRule].nrhs > 0)
+      yy_glr_unref(p, pNode->rhs);
+    pos = pNode->below;
+    pNode->below.pNode = p->yyfree;
+    p->yyfree = pNode;
+  }
+}
+
+/* Append a head to a list, taking over a reference to "pos".  Return
+ * zero and drop the reference if out of memory.
+ */
+static int
+yy_glr_push(yyParser *p, yyGlrList *pList, yyGlrPos pos, int act) {
+  if (pList->n >= pList->nAlloc) {
+    int nNew = pList->nAlloc * 2 + 8;
+    void *aNew = realloc(pList->a, nNew * sizeof(pList->a[0]));
+    if (aNew == 0) {
+      yy_glr_unref(p, pos);
+      return 0;
+    }
+    pList->a = aNew;
+    pList->nAlloc = nNew;
+  }
+  pList->a[pList->n].pos = pos;
+  pList->a[pList->n].act = act;
+  pList->n++;
+  return 1;
+}
+
+/* Drop all heads of a list */
+static void
+yy_glr_clear(yyParser *p, yyGlrList *pList) {
+  while (pList->n > 0)
+    yy_glr_unref(p, pList->a[--pList->n].pos);
+}
+
+/* Return true if the list holds a node with the same state and symbol
+ * as "pNode" on top of the same entry.
+ */
+static int
+yy_glr_find(yyGlrList *pList, yyGlrNode *pNode) {
+  int i;
+  for (i = 0; i < pList->n; i++) {
+    yyGlrNode *pOther = pList->a[i].pos.pNode;
+    if (pOther->e.stateno == pNode->e.stateno && pOther->e.major == pNode->e.major &&
+        pOther->below.pNode == pNode->below.pNode &&
+        (pNode->below.pNode || pOther->below.iTrunk == pNode->below.iTrunk)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void yy_glr_resolve(yyParser *, yyGlrNode *); // Forward Declaration
+
+/* Run the deferred reduce actions of the "n" entries at and under "pos",
+ * bottom first.
+ */
+static void
+yy_glr_resolve_rhs(yyParser *p, yyGlrPos pos, int n) {
+  if (n == 0)
+    return;
+  yy_glr_resolve_rhs(p, yy_glr_below(pos), n - 1);
+  if (pos.pNode)
+    yy_glr_resolve(p, pos.pNode);
+}
+
+/* Run the deferred reduce action of a node, if any.  The right-hand side
+ * is consumed by the action, so its nodes are recycled without calling
+ * destructors.
+ */
+static void
+yy_glr_resolve(yyParser *p, yyGlrNode *pNode) {
+  yyGlrNode *pRhs;
+  yyGlrPos pos;
+  int i, yysize;
+
+  if (pNode->iRule < 0)
+    return;
+  yysize = yyRuleInfo[pNode->iRule].nrhs;
+  yy_glr_resolve_rhs(p, pNode->rhs, yysize);
+  for (i = yysize, pos = pNode->rhs; i > 0; i--, pos = yy_glr_below(pos)) {
+    p->yyrhs[i] = *yy_glr_entry(p, pos);
+  }
+  pNode->e.minor = yy_reduce_action(p, pNode->iRule, &p->yyrhs[yysize]);
+  pNode->iRule = -1;
+  for (pos = pNode->rhs; yysize > 0 && (pRhs = pos.pNode) != 0; yysize--) {
+    if (--pRhs->nRef > 0)
+      return;
+    pos = pRhs->below;
+    pRhs->below.pNode = p->yyfree;
+    p->yyfree = pRhs;
+    if (yysize == 1)
+      yy_glr_unref(p, pos);
+  }
+}
+
+/* Call the destructors of all values held by a node, including those of
+ * the right-hand side of a deferred reduce.
+ */
+static void
+yy_glr_destroy(yyParser *p, yyGlrNode *pNode) {
+  yyGlrPos pos;
+  int i;
+  if (pNode->iRule < 0) {
+    yy_destructor(p, pNode->e.major, &pNode->e.minor);
+    return;
+  }
+  for (i = yyRuleInfo[pNode->iRule].nrhs, pos = pNode->rhs; i > 0; i--, pos = yy_glr_below(pos)) {
+    if (pos.pNode) {
+      yy_glr_destroy(p, pos.pNode);
+    } else {
+      yy_destructor(p, p->yystack[pos.iTrunk].major, &p->yystack[pos.iTrunk].minor);
+    }
+  }
+}
+
+/* Give up on a split parse: destroy the values held by the first branch,
+ * drop all branches and leave the trunk under them.
+ */
+static void
+yy_glr_discard(yyParser *p) {
+  yyGlrPos pos;
+  if (p->yyheads.n == 0)
+    return;
+  for (pos = p->yyheads.a[0].pos; pos.pNode; pos = pos.pNode->below) {
+    yy_glr_destroy(p, pos.pNode);
+  }
+  p->yyidx = pos.iTrunk;
+  yy_glr_clear(p, &p->yyheads);
+}
+
+/* Run the deferred reduce actions of the branch ending at "pos" and move
+ * its entries onto the trunk, bottom first.
+ */
+static void
+yy_glr_flatten(yyParser *p, yyGlrPos pos) {
+  yyGlrNode *pNode = pos.pNode;
+  if (pNode == 0) {
+    p->yyidx = pos.iTrunk;
+    return;
+  }
+  yy_glr_flatten(p, pNode->below);
+  if (p->yyidx < 0) {
+    /* The stack overflowed below this entry */
+    yy_glr_destroy(p, pNode);
+    return;
+  }
+  yy_glr_resolve(p, pNode);
+  yy_shift(p, pNode->e.stateno, pNode->e.major, &pNode->e.minor);
+}
+
+/* Only one branch is left.  Make it the trunk of a deterministic parse. */
+static void
+yy_glr_join(yyParser *p) {
+  yyGlrPos pos = p->yyheads.a[0].pos;
+  p->yyheads.n = 0;
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sJoin\n", yyTracePrompt);
+  }
+#endif
+  yy_glr_flatten(p, pos);
+  yy_glr_unref(p, pos);
+}
+
+/* A branch accepts by reducing with "pNode".  All other branches are
+ * dropped.
+ */
+static void
+yy_glr_accept(yyParser *p, yyGlrNode *pNode) {
+  yy_glr_clear(p, &p->yywork);
+  yy_glr_clear(p, &p->yynext);
+  yy_glr_clear(p, &p->yymade);
+  yy_glr_clear(p, &p->yyheads);
+  yy_glr_resolve(p, pNode);
+  assert(pNode->below.pNode == 0);
+  p->yyidx = pNode->below.iTrunk;
+  yy_glr_unref(p, yy_glr_pos(pNode));
+  yy_accept(p);
+}
+
+/* Feed one token, of class "yyclass", to all branches of a split parse.
+ * Return zero if no branch can take it, which leaves the branches as
+ * they were.
+ */
+static int
+yy_glr_token(yyParser *p, int yymajor, int yyclass, YYMINORTYPE *yypMinor) {
+  yyGlrList *pWork = &p->yywork;
+  yyGlrList *pNext = &p->yynext;
+  yyGlrList *pMade = &p->yymade;
+  yyGlrList tmp;
+  yyGlrNode *pNode;
+  yyGlrPos pos, base;
+  int i, n, yyact, yyruleno, yysize;
+
+  for (i = p->yyheads.n - 1; i >= 0; i--) {
+    yy_glr_ref(p->yyheads.a[i].pos);
+    yy_glr_push(p, pWork, p->yyheads.a[i].pos, -1);
+  }
+  while (pWork->n > 0) {
+    pWork->n--;
+    pos = pWork->a[pWork->n].pos;
+    yyact = pWork->a[pWork->n].act;
+    if (yyact < 0)
+      yyact = yy_find_shift_action(yy_glr_entry(p, pos)->stateno, (YYCODETYPE)yyclass);
+    if (yyact >= YY_CONFLICT_ACTION) {
+      const YYACTIONTYPE *aAlt = &yy_conflict[yyact - YY_CONFLICT_ACTION];
+      for (n = 0; aAlt[n] != YY_NO_ACTION; n++)
+        ;
+#ifndef NDEBUG
+      if (yyTraceFILE) {
+        fprintf(yyTraceFILE, "%sSplit %d ways on %s\n", yyTracePrompt, n, yyTokenName[yymajor]);
+      }
+#endif
+      for (i = n - 1; i >= 0; i--) {
+        yy_glr_ref(pos);
+        yy_glr_push(p, pWork, pos, aAlt[i]);
+      }
+      yy_glr_unref(p, pos);
+    } else if (yyact < YYNSTATE) {
+      assert(yymajor != 0); // Impossible to shift the $ token
+      pNode = yy_glr_node(p, pos, yyact, yymajor);
+      if (pNode == 0) {
+        yy_glr_unref(p, pos);
+        continue;
+      }
+      pNode->e.minor = *yypMinor;
+      if (yy_glr_find(pNext, pNode)) {
+        yy_glr_unref(p, yy_glr_pos(pNode));
+        continue;
+      }
+      yy_glr_push(p, pNext, yy_glr_pos(pNode), -1);
+    } else if (yyact < YYNSTATE + YYNRULE) {
+      yyruleno = yyact - YYNSTATE;
+      yysize = yyRuleInfo[yyruleno].nrhs;
+      for (base = pos, i = 0; i < yysize; i++)
+        base = yy_glr_below(base);
+      yy_glr_ref(base);
+      pNode = yy_glr_node(p, base, yy_find_reduce_action(yy_glr_entry(p, base)->stateno, yyRuleInfo[yyruleno].lhs),
+                          yyRuleInfo[yyruleno].lhs);
+      if (pNode == 0) {
+        yy_glr_unref(p, base);
+        yy_glr_unref(p, pos);
+        continue;
+      }
+      pNode->iRule = yyruleno;
+      pNode->rhs = pos;
+      if (yysize == 0)
+        yy_glr_unref(p, pos);
+#ifndef NDEBUG
+      if (yyTraceFILE) {
+        fprintf(yyTraceFILE, "%sDefer [%s]\n", yyTracePrompt, yyRuleName[yyruleno]);
+      }
+#endif
+      if (pNode->e.stateno == YY_ACCEPT_ACTION) {
+        yy_glr_accept(p, pNode);
+        return 1;
+      }
+      if (yy_glr_find(pMade, pNode)) {
+#ifndef NDEBUG
+        if (yyTraceFILE) {
+          fprintf(yyTraceFILE, "%sMerge ambiguous %s\n", yyTracePrompt, yyTokenName[pNode->e.major]);
+        }
+#endif
+        yy_glr_unref(p, yy_glr_pos(pNode));
+        continue;
+      }
+      yy_glr_ref(yy_glr_pos(pNode));
+      yy_glr_push(p, pMade, yy_glr_pos(pNode), -1);
+      yy_glr_push(p, pWork, yy_glr_pos(pNode), -1);
+    } else {
+#ifndef NDEBUG
+      if (yyTraceFILE) {
+        fprintf(yyTraceFILE, "%sBranch in state %d dies\n", yyTracePrompt, yy_glr_entry(p, pos)->stateno);
+      }
+#endif
+      yy_glr_unref(p, pos);
+    }
+  }
+  yy_glr_clear(p, pMade);
+  if (pNext->n == 0)
+    return 0;
+  yy_glr_clear(p, &p->yyheads);
+  tmp = p->yyheads;
+  p->yyheads = *pNext;
+  *pNext = tmp;
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sShift %s on %d branches\n", yyTracePrompt, yyTokenName[yymajor], p->yyheads.n);
+  }
+#endif
+  if (p->yyheads.n == 1)
+    yy_glr_join(p);
+  return 1;
+}
+#endif /* YY_CONFLICT_COUNT */
+
+/* Deallocate and destroy a parser.  Destructors are all called for
+ * all stack elements before shutting the parser down.
+ *
+ * Inputs:
+ * <ul>
+ * <li>  A pointer to the parser.  This should be a pointer
+ *       obtained from ParseAlloc.
+ * <li>  A pointer to a function used to reclaim memory obtained
+ *       from malloc.
+ * </ul>
+ */
+void
+ParseFree(void *p) {
+  yyParser *pParser = (yyParser *)p;
+  if (pParser == 0)
+    return;
+#if YY_CONFLICT_COUNT > 0
+  yy_glr_discard(pParser);
+  while (pParser->yyfree) {
+    yyGlrNode *pNode = pParser->yyfree;
+    pParser->yyfree = pNode->below.pNode;
+    free(pNode);
+  }
+  free(pParser->yyheads.a);
+  free(pParser->yywork.a);
+  free(pParser->yynext.a);
+  free(pParser->yymade.a);
+#endif
+  while (pParser->yyidx >= 0)
+    yy_pop_parser_stack(pParser);
+#if YYSTACKDEPTH <= 0
+  free(pParser->yystack);
+#endif
+  free((void *)pParser);
+}
+
+/* The following code executes when the parse fails */
+#ifndef YYNOERRORRECOVERY
+static void
+yy_parse_failed(yyParser *yypParser // The parser
+                ) {
+  ParseARG_FETCH;
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sFail!\n", yyTracePrompt);
+  }
+#endif
+#if YY_CONFLICT_COUNT > 0
+  yy_glr_discard(yypParser);
+#endif
+  while (yypParser->yyidx >= 0)
+    yy_pop_parser_stack(yypParser);
+  /* Here code is inserted which will be executed whenever the
+   * parser fails
+   */
+// clang-format off
+%%
+// clang-format on
+  ParseARG_STORE; // Suppress warning about unused %extra_argument variable
+}
+#endif /* YYNOERRORRECOVERY */
+
+/* The following code executes when a syntax error first occurs. */
+static void
+yy_syntax_error(yyParser *yypParser, // The parser
+                int yymajor,         // The major type of the error token
+                YYMINORTYPE yyminor  // The minor type of the error token
+                ) {
+  ParseARG_FETCH;
+#define TOKEN (yyminor.yy0)
+// clang-format off
+%%
+// clang-format on
+  ParseARG_STORE; // Suppress warning about unused %extra_argument variable
+}
+
+/* The following is executed when the parser accepts */
+static void
+yy_accept(yyParser *yypParser // The parser
+          ) {
+  ParseARG_FETCH;
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sAccept!\n", yyTracePrompt);
+  }
+#endif
+  while (yypParser->yyidx >= 0)
+    yy_pop_parser_stack(yypParser);
+  /* Here code is inserted which will be executed whenever the
+   * parser accepts
+   */
+// clang-format off
+%%
+// clang-format on
+  ParseARG_STORE; // Suppress warning about unused %extra_argument variable
+}
+
+/* The main parser program.
+ * The first argument is a pointer to a structure obtained from
+ * "ParseAlloc" which describes the current state of the parser.
+ * The second argument is the major token number.  The third is
+ * the minor token.  The fourth optional argument is whatever the
+ * user wants (and specified in the grammar) and is available for
+ * use by the action routines.
+ *
+ * While the parser is split, a syntax error only discards the token
+ * that no branch could take, whether or not the grammar has an error
+ * symbol.
+ *
+ * Inputs:
+ * <ul>
+ * <li> A pointer to the parser (an opaque structure.)
+ * <li> The major token number.
+ * <li> The minor token number.
+ * <li> An option argument of a grammar-specified type.
+ * </ul>
+ *
+ * Outputs:
+ * None.
+ */
+void
+Parse(void *yyp,             // The parser
+      int yymajor,           // The major token code number
+      ParseTOKENTYPE yyminor // The value for the token
+      ParseARG_PDECL         // Optional %extra_argument parameter
+      ) {
+  YYMINORTYPE yyminorunion;
+  int yyact;        // The parser action.
+  int yyendofinput; // True if we are at the end of input
+  int yyclass;      // The column of yymajor in the action table
+#ifdef YYERRORSYMBOL
+  int yyerrorhit = 0; // True if yymajor has invoked an error
+#endif
+  yyParser *yypParser; // The parser
+
+  /* (re)initialize the parser, if necessary */
+  yypParser = (yyParser *)yyp;
+  if (yypParser->yyidx < 0) {
+#if YYSTACKDEPTH <= 0
+    if (yypParser->yystksz <= 0) {
+      yyminorunion = yyzerominor;
+      yyStackOverflow(yypParser, &yyminorunion);
+      return;
+    }
+#endif
+    yypParser->yyidx = 0;
+    yypParser->yyerrcnt = -1;
+    yypParser->yystack[0].stateno = 0;
+    yypParser->yystack[0].major = 0;
+  }
+  yyminorunion.yy0 = yyminor;
+  yyendofinput = (yymajor == 0);
+#ifdef YYTOKENCLASS
+  yyclass = yy_token_class[yymajor];
+#else
+  yyclass = yymajor;
+#endif
+  ParseARG_STORE;
+
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sInput %s\n", yyTracePrompt, yyTokenName[yymajor]);
+  }
+#endif
+
+  do {
+#if YY_CONFLICT_COUNT > 0
+    if (yypParser->yyheads.n > 0) {
+      if (yy_glr_token(yypParser, yymajor, yyclass, &yyminorunion)) {
+        yypParser->yyerrcnt--;
+      } else {
+#ifndef NDEBUG
+        if (yyTraceFILE) {
+          fprintf(yyTraceFILE, "%sSyntax Error!\n", yyTracePrompt);
+        }
+#endif
+        if (yypParser->yyerrcnt <= 0) {
+          yy_syntax_error(yypParser, yymajor, yyminorunion);
+        }
+        yypParser->yyerrcnt = 3;
+        yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+#ifndef YYNOERRORRECOVERY
+        if (yyendofinput) {
+          yy_parse_failed(yypParser);
+        }
+#endif
+      }
+      yymajor = YYNOCODE;
+      continue;
+    }
+#endif
+    yyact = yy_find_shift_action(yypParser->yystack[yypParser->yyidx].stateno, (YYCODETYPE)yyclass);
+#if YY_CONFLICT_COUNT > 0
+    if (yyact >= YY_CONFLICT_ACTION) {
+      /* Split into branches.  Without the memory to do so, go on with
+       * the action LR would have taken.
+       */
+      if (yy_glr_push(yypParser, &yypParser->yyheads, yy_glr_trunk(yypParser->yyidx), -1))
+        continue;
+      yyact = yy_conflict[yyact - YY_CONFLICT_ACTION];
+    }
+#endif
+    if (yyact < YYNSTATE) {
+      assert(!yyendofinput); // Impossible to shift the $ token
+      yy_shift(yypParser, yyact, yymajor, &yyminorunion);
+      yypParser->yyerrcnt--;
+      yymajor = YYNOCODE;
+#if YY_MIN_AUTOREDUCE < YYNSTATE && !defined(YYNOEAGERREDUCE)
+      /* States from YY_MIN_AUTOREDUCE on reduce by their default rule
+       * whatever the next token is, so there is no need to wait for it.
+       * This lets the actions of a complete statement run before the
+       * tokenizer delivers another token.
+       */
+      while (yypParser->yyidx >= 0 && yypParser->yystack[yypParser->yyidx].stateno >= YY_MIN_AUTOREDUCE) {
+        yy_reduce(yypParser, yy_default[yypParser->yystack[yypParser->yyidx].stateno] - YYNSTATE);
+      }
+#endif
+    } else if (yyact < YYNSTATE + YYNRULE) {
+      yy_reduce(yypParser, yyact - YYNSTATE);
+    } else {
+      assert(yyact == YY_ERROR_ACTION);
+#ifdef YYERRORSYMBOL
+      int yymx;
+#endif
+#ifndef NDEBUG
+      if (yyTraceFILE) {
+        fprintf(yyTraceFILE, "%sSyntax Error!\n", yyTracePrompt);
+      }
+#endif
+#ifdef YYERRORSYMBOL
+      /* A syntax error has occurred.
+       * The response to an error depends upon whether or not the
+       * grammar defines an error token "ERROR".
+       *
+       * This is what we do if the grammar does define ERROR:
+       *
+       *  * Call the %syntax_error function.
+       *
+       *  * Begin popping the stack until we enter a state where
+       *    it is legal to shift the error symbol, then shift
+       *    the error symbol.
+       *
+       *  * Set the error count to three.
+       *
+       *  * Begin accepting and shifting new tokens.  No new error
+       *    processing will occur until three tokens have been
+       *    shifted successfully.
+       *
+       */
+      if (yypParser->yyerrcnt < 0) {
+        yy_syntax_error(yypParser, yymajor, yyminorunion);
+      }
+      yymx = yypParser->yystack[yypParser->yyidx].major;
+      if (yymx == YYERRORSYMBOL || yyerrorhit) {
+#ifndef NDEBUG
+        if (yyTraceFILE) {
+          fprintf(yyTraceFILE, "%sDiscard input token %s\n", yyTracePrompt, yyTokenName[yymajor]);
+        }
+#endif
+        yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+        yymajor = YYNOCODE;
+      } else {
+        while (yypParser->yyidx >= 0 && yymx != YYERRORSYMBOL &&
+               (yyact = yy_find_reduce_action(yypParser->yystack[yypParser->yyidx].stateno, YYERRORSYMBOL)) >=
+                   YYNSTATE) {
+          yy_pop_parser_stack(yypParser);
+        }
+        if (yypParser->yyidx < 0 || yymajor == 0) {
+          yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+          yy_parse_failed(yypParser);
+          yymajor = YYNOCODE;
+        } else if (yymx != YYERRORSYMBOL) {
+          YYMINORTYPE u2;
+          u2.YYERRSYMDT = 0;
+          yy_shift(yypParser, yyact, YYERRORSYMBOL, &u2);
+        }
+      }
+      yypParser->yyerrcnt = 3;
+      yyerrorhit = 1;
+#elif defined(YYNOERRORRECOVERY)
+      /* If the YYNOERRORRECOVERY macro is defined, then do not attempt to
+       * do any kind of error recovery.  Instead, simply invoke the syntax
+       * error routine and continue going as if nothing had happened.
+       *
+       * Applications can set this macro (for example inside %include) if
+       * they intend to abandon the parse upon the first syntax error seen.
+       */
+      yy_syntax_error(yypParser, yymajor, yyminorunion);
+      yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+      yymajor = YYNOCODE;
+
+#else // YYERRORSYMBOL is not defined
+      /* This is what we do if the grammar does not define ERROR:
+       *
+       *  * Report an error message, and throw away the input token.
+       *
+       *  * If the input token is $, then fail the parse.
+       *
+       * As before, subsequent error messages are suppressed until
+       * three input tokens have been successfully shifted.
+       */
+      if (yypParser->yyerrcnt <= 0) {
+        yy_syntax_error(yypParser, yymajor, yyminorunion);
+      }
+      yypParser->yyerrcnt = 3;
+      yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+      if (yyendofinput) {
+        yy_parse_failed(yypParser);
+      }
+      yymajor = YYNOCODE;
+#endif
+    }
+  } while (yymajor != YYNOCODE && yypParser->yyidx >= 0);
+  return;
+}
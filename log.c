@@ -1,9 +1,18 @@
+#ifndef __WIN32__
+#define _POSIX_C_SOURCE 200112L // For flockfile() under -std=c99
+#include <unistd.h>
+#endif
 #include "log.h"
 
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+/* flockfile() is only there where POSIX stdio can be locked */
+#if defined(_POSIX_THREAD_SAFE_FUNCTIONS) && _POSIX_THREAD_SAFE_FUNCTIONS > 0
+#define LOG_LOCK 1
+#endif
+
 static LogMask _log_mask = ALL_LOG;
 
 static char const *levels[] = {
@@ -33,11 +42,18 @@ lprintf(LogLevel level, char const *restrict format, ...) {
     return;
   if ((_log_mask & (1 << lvl)) == 0)
     return;
+  /* Keep the message in one piece when several grammars are built at once */
+#ifdef LOG_LOCK
+  flockfile(stderr);
+#endif
   fprintf(stderr, "%s:", levels[lvl]);
   va_start(ap, format);
   vfprintf(stderr, format, ap);
   va_end(ap);
   fputs("\n", stderr);
+#ifdef LOG_LOCK
+  funlockfile(stderr);
+#endif
   if (lvl == 0)
     exit(EXIT_FAILURE);
 }
\ No newline at end of file
@@ -1,7 +1,11 @@
 #include "arg.h"
 #include "error.h"
 
+#include "acttab.h"
 #include "build.h"
+#include "cache.h"
+#include "context.h"
+#include "grammar.h"
 #include "parse.h"
 #include "report.h"
 #include "set.h"
@@ -14,39 +18,92 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifndef __WIN32__
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* One grammar to build, as named by an argument on the command line */
+struct job {
+  char *zArg;      // The command-line argument
+  char *zLabel;    // Prefix for messages about the whole run
+  char *filename;  // The grammar file
+  char *variant;   // Appended to the names of the output files, or NULL
+  char *zCache;    // The cache file, if any
+  int nDefine;     // Number of macros defined for this grammar
+  char **azDefine; // Names of those macros
+  int exitcode;    // 0 if the parser was built, 1 if not
+};
+
+/* The jobs of an invocation, handed out to the threads one at a time */
+struct batch {
+  struct job *aJob; // All of the jobs
+  int nJob;         // Number of jobs
+  int iNext;        // The next job to hand out
+#ifndef __WIN32__
+  pthread_mutex_t mutex; // Guards iNext
+#endif
+};
 
 /* forward declaration */
+static int build(struct job *);
 static int compare_symbol(void const *left, void const *right);
+static void add_define(int *, char ***, const char *, size_t);
 static void handle_D_option(char *);
 static void handle_T_option(char *);
+static void handle_job(struct job *, char *, int);
+static int default_threads(void);
+static void *worker(void *);
+static void run_jobs(struct job *, int, int);
 static void usage();
 
 char *argv0;
 
-int nDefine = 0;     // Number of -D options on the command line
-char **azDefine = 0; // Name of the -D macros
+static int nDefine = 0;     // Number of -D options on the command line
+static char **azDefine = 0; // Name of the -D macros
 bool showPrecedenceConflict = false;
 char *user_templatename = NULL;
 
+/* Options, the same for every grammar built */
+static bool rpflag = false;
+static bool compress = false;
+static bool quiet = false;
+static bool statistics = false;
+static bool noResort = false;
+static bool minimize = false;
+static bool glr = false;
+static bool cplusplus = false;
+static bool tablefile = false;
+static bool jsonreport = false;
+static int packmsec = 0;
+static char *cachename = NULL;
+// TODO: remove this flag
+static bool mhflag = true;
+
 /* The main program.  Parse the command line and do it... */
 int
 main(int argc, char **argv) {
-  static bool rpflag = false;
-  static bool compress = false;
-  static bool quiet = false;
-  static bool statistics = false;
-  static bool noResort = false;
-  // TODO: remove this flag
-  static bool mhflag = true;
-
-  unsigned int i;
+  struct job *aJob;
+  int nJob, nThread = 0;
+  int i;
   int exitcode;
-  struct lemon lem;
 
   ARGBEGIN {
   case 'D':
     handle_D_option(ARGF());
     break;
+  case 'G':
+    glr = true;
+    break;
+  case 'J':
+    jsonreport = true;
+    break;
+  case 'M':
+    minimize = true;
+    break;
+  case 'b':
+    tablefile = true;
+    break;
   case 'T':
     handle_T_option(ARGF());
     break;
@@ -56,6 +113,12 @@ main(int argc, char **argv) {
   case 'g':
     rpflag = true;
     break;
+  case 'j':
+    nThread = atoi(EARGF(usage()));
+    break;
+  case 'k':
+    cachename = ARGF();
+    break;
   case 'p':
     showPrecedenceConflict = true;
     break;
@@ -68,6 +131,9 @@ main(int argc, char **argv) {
   case 's':
     statistics = true;
     break;
+  case 't':
+    packmsec = atoi(EARGF(usage()));
+    break;
   case 'V':
     lprintf(LINFO, "Lemon version 1.0");
     exit(EXIT_SUCCESS);
@@ -77,29 +143,83 @@ main(int argc, char **argv) {
     usage();
   }
   ARGEND;
-  if (argc != 1) {
-    lprintf(LFATAL, "Exactly one filename argument is required.");
+  if (argc < 1) {
+    lprintf(LFATAL, "At least one filename argument is required.");
+  }
+  if (user_templatename) {
+    char *cp = strrchr(user_templatename, '.');
+    cplusplus = cp && strcmp(cp, ".hpp") == 0;
+  }
+  if (glr && cplusplus) {
+    lprintf(LFATAL, "The C++ template has no GLR driver.");
+  }
+  if (tablefile && (glr || cplusplus)) {
+    lprintf(LFATAL, "Only the C template can read its tables from a file.");
+  }
+
+  /* Every argument is a grammar to build */
+  nJob = argc;
+  aJob = (struct job *)calloc((size_t)nJob, sizeof(aJob[0]));
+  MemoryCheck(aJob);
+  for (i = 0; i < nJob; i++)
+    handle_job(&aJob[i], argv[i], nJob > 1);
+  if (nThread <= 0)
+    nThread = default_threads();
+  run_jobs(aJob, nJob, nThread);
+
+  /* return 0 on success, 1 on failure. */
+  exitcode = 0;
+  for (i = 0; i < nJob; i++) {
+    if (aJob[i].exitcode)
+      exitcode = 1;
   }
+  return (exitcode);
+}
+
+/* Build the parser for one grammar.  Return 0 on success and 1 on
+ * failure.  Everything the run needs is reached from its own struct
+ * lemon, so several of these can run at the same time.
+ */
+static int
+build(struct job *job) {
+  unsigned int i;
+  int exitcode;
+  struct lemon lem;
+  unsigned long long cachekey = 0;
+  int cached = 0;
+
   memset(&lem, 0, sizeof(lem));
 
   /* Initialize the machine */
+  lem.ctx = context_new();
   lem.argv0 = argv0;
-  lem.filename = argv[0];
-  make_symbol("$");
-  lem.errsym = make_symbol("error");
+  lem.filename = job->filename;
+  lem.variant = job->variant;
+  lem.nDefine = job->nDefine;
+  lem.azDefine = job->azDefine;
+  lem.glr = glr;
+  lem.cplusplus = cplusplus;
+  lem.tablefile = tablefile;
+  lem.packmsec = packmsec;
+  make_symbol(&lem, "$");
+  lem.errsym = make_symbol(&lem, "error");
   lem.errsym->useCnt = 0;
 
   /* Parse the input file */
   Parse(&lem);
-  if (lem.errorcnt)
-    exit(EXIT_FAILURE);
+  if (lem.errorcnt) {
+    context_free(lem.ctx);
+    return 1;
+  }
   if (lem.nrule == 0) {
-    lprintf(LFATAL, "Empty grammar.");
+    lprintf(LERROR, "%sEmpty grammar.", job->zLabel);
+    context_free(lem.ctx);
+    return 1;
   }
 
   /* Count and index the symbols of the grammar */
-  make_symbol("{default}");
-  lem.symbols = array_of_symbol(&lem.nsymbol);
+  make_symbol(&lem, "{default}");
+  lem.symbols = array_of_symbol(&lem, &lem.nsymbol);
   for (i = 0; i < lem.nsymbol; i++)
     lem.symbols[i]->index = i;
   qsort(lem.symbols, (size_t)lem.nsymbol, sizeof(struct symbol *), compare_symbol);
@@ -119,8 +239,14 @@ main(int argc, char **argv) {
     Reprint(&lem);
   } else {
     /* Initialize the size for all follow and first sets */
-    SetSize(lem.nterminal + 1);
+    SetSize(&lem, lem.nterminal + 1);
 
+    /* Lay the rules and symbols out in flat arrays for the analysis */
+    FreezeGrammar(&lem);
+
+    /* Hash the grammar skeleton before the analysis adds to it */
+    if (job->zCache)
+      cachekey = CacheKey(&lem, compress | noResort << 1 | showPrecedenceConflict << 2 | minimize << 3);
     /* Find the precedence for every production rule (that has one) */
     FindRulePrecedences(&lem);
 
@@ -129,40 +255,59 @@ main(int argc, char **argv) {
      */
     FindFirstSets(&lem);
 
-    /* Compute all LR(0) states.  Also record follow-set propagation
-     * links so that the follow-set can be computed later
-     */
-    lem.nstate = 0;
-    FindStates(&lem);
-    lem.sorted = array_of_state(NULL);
+    /* Reuse the automaton of an earlier run on the same grammar skeleton */
+    if (job->zCache)
+      cached = CacheLoad(&lem, job->zCache, cachekey);
+    if (!cached) {
+      /* Compute all LR(0) states.  Also record follow-set propagation
+       * links so that the follow-set can be computed later
+       */
+      lem.nstate = 0;
+      FindStates(&lem);
+      lem.sorted = array_of_state(&lem, NULL);
 
-    /* Tie up loose ends on the propagation links */
-    FindLinks(&lem);
+      /* Tie up loose ends on the propagation links */
+      FindLinks(&lem);
 
-    /* Compute the follow set of every reducible configuration */
-    FindFollowSets(&lem);
+      /* Compute the follow set of every reducible configuration */
+      FindFollowSets(&lem);
 
-    /* Compute the action tables */
-    FindActions(&lem);
+      /* Compute the action tables */
+      FindActions(&lem);
 
-    /* Compress the action tables */
-    if (compress == 0)
-      CompressTables(&lem);
+      /* Compress the action tables */
+      if (compress == 0)
+        CompressTables(&lem);
 
-    /* Reorder and renumber the states so that states with fewer choices
-     * occur at the end.  This is an optimization that helps make the
-     * generated parser tables smaller.
-     */
-    if (noResort == 0)
-      ResortStates(&lem);
+      /* Let the gotos skip the reductions that only rename a nonterminal */
+      BypassUnitRules(&lem);
+
+      /* Merge the states that act alike */
+      if (minimize)
+        MinimizeStates(&lem);
 
-    /* Generate a report of the parser generated.  (the "y.output" file) */
-    if (!quiet)
-      ReportOutput(&lem);
+      /* Reorder and renumber the states so that states with fewer choices
+       * occur at the end.  This is an optimization that helps make the
+       * generated parser tables smaller.
+       */
+      if (noResort == 0)
+        ResortStates(&lem);
+    }
 
     /* Generate the source code for the parser */
     ReportTable(&lem, mhflag);
 
+    /* Generate a report of the parser generated (the "y.output" file)
+     * and the JSON report, which gives the offsets of the states into
+     * the tables just made.
+     */
+    if (!quiet || jsonreport)
+      ReportOutput(&lem, !quiet, jsonreport);
+
+    /* Keep the automaton and its packed tables for the next run */
+    if (job->zCache && !cached && lem.errorcnt == 0)
+      CacheSave(&lem, job->zCache, cachekey);
+
     /* Produce a header file for use by the scanner.  (This step is
      * omitted if the "-m" option is used because makeheaders will
      * generate the file for us.)
@@ -172,17 +317,28 @@ main(int argc, char **argv) {
   }
   if (statistics) {
     lprintf(LINFO,
-            "Parser statistics: %d terminals, %d nonterminals, %d rules\n"
+            "%sParser statistics: %d terminals, %d nonterminals, %d rules\n"
             "\t%d states, %d parser table entries, %d conflicts\n",
-            lem.nterminal, lem.nsymbol - lem.nterminal, lem.nrule, lem.nstate, lem.tablesize, lem.nconflict);
+            job->zLabel, lem.nterminal, lem.nsymbol - lem.nterminal, lem.nrule, lem.nstate, lem.tablesize,
+            lem.nconflict);
   }
-  if (lem.nconflict > 0) {
-    lprintf(LERROR, "%d parsing conflicts.\n", lem.nconflict);
+  if (lem.nconflict > 0 && lem.glr) {
+    lprintf(LINFO, "%s%d parsing conflicts left to the GLR driver.\n", job->zLabel, lem.nconflict);
+  } else if (lem.nconflict > 0) {
+    lprintf(LERROR, "%s%d parsing conflicts.\n", job->zLabel, lem.nconflict);
   }
 
-  /* return 0 on success, 1 on failure. */
-  exitcode = ((lem.errorcnt > 0) || (lem.nconflict > 0)) ? 1 : 0;
-  return (exitcode);
+  exitcode = ((lem.errorcnt > 0) || (lem.nconflict > 0 && !lem.glr)) ? 1 : 0;
+
+  /* Release the run */
+  free(lem.outname);
+  free(lem.symbols);
+  free(lem.sorted);
+  if (lem.acttab)
+    acttab_free(lem.acttab);
+  grammar_free(lem.grammar);
+  context_free(lem.ctx);
+  return exitcode;
 }
 
 /* Compare two symbols for sorting purposes.  Return negative,
@@ -213,17 +369,27 @@ compare_symbol(void const *left, void const *right) {
  */
 static void
 handle_D_option(char *z) {
+  add_define(&nDefine, &azDefine, z, strlen(z));
+}
+
+/* Add the first n bytes of z, up to any "=", as a macro name to the
+ * array *pazDefine of *pnDefine names
+ */
+static void
+add_define(int *pnDefine, char ***pazDefine, const char *z, size_t n) {
   char **paz;
-  nDefine++;
-  azDefine = (char **)realloc(azDefine, sizeof(azDefine[0]) * nDefine);
-  MemoryCheck(azDefine);
-  paz = &azDefine[nDefine - 1];
-  *paz = (char *)malloc(strlen(z) + 1);
+  char *cp;
+  (*pnDefine)++;
+  *pazDefine = (char **)realloc(*pazDefine, sizeof((*pazDefine)[0]) * *pnDefine);
+  MemoryCheck(*pazDefine);
+  paz = &(*pazDefine)[*pnDefine - 1];
+  *paz = (char *)malloc(n + 1);
   MemoryCheck(*paz);
-  strcpy(*paz, z);
-  for (z = *paz; *z && *z != '='; z++) {
+  memcpy(*paz, z, n);
+  (*paz)[n] = 0;
+  for (cp = *paz; *cp && *cp != '='; cp++) {
   }
-  *z = 0;
+  *cp = 0;
 }
 
 static void
@@ -233,19 +399,168 @@ handle_T_option(char *z) {
   strcpy(user_templatename, z);
 }
 
+/* Set up the job for one grammar argument.  The argument names a
+ * grammar file, optionally followed by a colon and a comma-separated
+ * list of macros to define for this grammar only, in addition to
+ * those of -D.  The macros are also appended to the names of the output
+ * files, so that variants of one grammar can be built side by side:
+ * "sql.y:OMIT_X,OMIT_Y" makes sql_OMIT_X_OMIT_Y.c and so on.
+ *
+ * When there are several jobs, the argument of -k is a suffix, and
+ * each grammar keeps its cache beside its output files.
+ */
+static void
+handle_job(struct job *job, char *zArg, int batch) {
+  char *zBase, *zList, *z, *cp;
+  size_t n;
+  int i;
+
+  job->zArg = zArg;
+  job->zLabel = "";
+  if (batch) {
+    job->zLabel = (char *)malloc(strlen(zArg) + 3);
+    MemoryCheck(job->zLabel);
+    sprintf(job->zLabel, "%s: ", zArg);
+  }
+
+  /* The colon is looked for after the last directory separator only */
+  for (zBase = z = zArg; *z; z++) {
+    if (*z == '/' || *z == '\\')
+      zBase = z + 1;
+  }
+  zList = strchr(zBase, ':');
+  if (zList == 0) {
+    job->filename = zArg;
+  } else {
+    job->filename = (char *)malloc((size_t)(zList - zArg) + 1);
+    MemoryCheck(job->filename);
+    memcpy(job->filename, zArg, (size_t)(zList - zArg));
+    job->filename[zList - zArg] = 0;
+    zList++;
+  }
+
+  for (i = 0; i < nDefine; i++)
+    add_define(&job->nDefine, &job->azDefine, azDefine[i], strlen(azDefine[i]));
+  n = 1;
+  for (z = zList; z && *z; z += *z == ',') {
+    cp = z;
+    while (*z && *z != ',')
+      z++;
+    if (z == cp)
+      continue;
+    add_define(&job->nDefine, &job->azDefine, cp, (size_t)(z - cp));
+    n += strlen(job->azDefine[job->nDefine - 1]) + 1;
+  }
+  if (job->nDefine > nDefine) {
+    job->variant = (char *)malloc(n);
+    MemoryCheck(job->variant);
+    job->variant[0] = 0;
+    for (i = nDefine; i < job->nDefine; i++) {
+      strcat(job->variant, "_");
+      strcat(job->variant, job->azDefine[i]);
+    }
+  }
+
+  if (cachename && !batch) {
+    job->zCache = cachename;
+  } else if (cachename) {
+    n = strlen(job->filename) + (job->variant ? strlen(job->variant) : 0) + strlen(cachename) + 1;
+    job->zCache = (char *)malloc(n);
+    MemoryCheck(job->zCache);
+    strcpy(job->zCache, job->filename);
+    cp = strrchr(job->zCache, '.');
+    if (cp)
+      *cp = 0;
+    if (job->variant)
+      strcat(job->zCache, job->variant);
+    strcat(job->zCache, cachename);
+  }
+}
+
+/* The number of grammars to build at once, unless -j says otherwise */
+static int
+default_threads(void) {
+#ifndef __WIN32__
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  if (n > 1)
+    return (int)n;
+#endif
+  return 1;
+}
+
+/* Build jobs of the batch until none are left */
+static void *
+worker(void *arg) {
+  struct batch *p = (struct batch *)arg;
+  struct job *job;
+  for (;;) {
+#ifndef __WIN32__
+    pthread_mutex_lock(&p->mutex);
+#endif
+    job = p->iNext < p->nJob ? &p->aJob[p->iNext++] : 0;
+#ifndef __WIN32__
+    pthread_mutex_unlock(&p->mutex);
+#endif
+    if (job == 0)
+      return 0;
+    job->exitcode = build(job);
+  }
+}
+
+/* Build all jobs, running up to nThread of them at once.  The main
+ * thread takes part, so nThread-1 threads are started at most.
+ */
+static void
+run_jobs(struct job *aJob, int nJob, int nThread) {
+  struct batch b;
+#ifndef __WIN32__
+  pthread_t *aThread;
+  int i, n;
+#endif
+
+  b.aJob = aJob;
+  b.nJob = nJob;
+  b.iNext = 0;
+#ifndef __WIN32__
+  pthread_mutex_init(&b.mutex, 0);
+  n = nThread < nJob ? nThread : nJob;
+  aThread = (pthread_t *)malloc(sizeof(aThread[0]) * (size_t)n);
+  MemoryCheck(aThread);
+  for (i = 1; i < n && pthread_create(&aThread[i], 0, worker, &b) == 0; i++) {
+  }
+  n = i;
+  worker(&b);
+  for (i = 1; i < n; i++)
+    pthread_join(aThread[i], 0);
+  free(aThread);
+  pthread_mutex_destroy(&b.mutex);
+#else
+  worker(&b);
+#endif
+}
+
 static void
 usage() {
   fprintf(stderr,
           "usage: %s -h\n"
           "usage: %s -V\n"
-          "usage: %s [-cgpqrs] [-D define] [-T template] grammar\n"
+          "usage: %s [-bcGgJMpqrs] [-D define] [-j threads] [-k cache] [-t msec] [-T template]\n"
+          "          grammar[:define,...] ...\n"
+          "\t-b\tWrite the parse tables to a .tbl file that the parser loads at run time.\n"
           "\t-c\tDon't compress the action table.\n"
+          "\t-G\tGenerate a GLR parser that splits on conflicts.\n"
           "\t-g\tPrint grammar without actions.\n"
+          "\t-J\tWrite the automaton and its table offsets to a .json file.\n"
+          "\t-M\tMerge the states that act alike.\n"
+          "\t-j\tBuild up to this many grammars at once.  The default is one per processor.\n"
+          "\t-k\tKeep the automaton in a cache file, for reuse while only code changes.\n"
+          "\t  \tWith several grammars, a suffix for the cache file of each.\n"
           "\t-p\tShow conflicts resolved by precedence rules\n"
           "\t-q\t(Quiet) Don't print the report file.\n"
           "\t-r\tDo not sort or renumber states\n"
           "\t-s\tPrint parser stats to standard output.\n"
-          "\t-T\tSpecify a template file.\n"
+          "\t-t\tSearch this many milliseconds for a smaller action table.\n"
+          "\t-T\tSpecify a template file.  A .hpp template makes a C++ parser.\n"
           "\t-D\tDefine an %%ifdef macro.\n"
           "\t-h\tPrint usage infirmation.\n"
           "\t-V\tPrint the version number.\n",
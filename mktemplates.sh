@@ -0,0 +1,25 @@
+#!/bin/sh
+# Write template_data.c, the default driver templates compiled into the
+# LEMON parser generator, to standard output.  Run it in the source
+# directory whenever lempar.c or lempar_glr.c changes:
+#
+#   sh mktemplates.sh > template_data.c
+#
+# Each template becomes an array of strings, one for each of the
+# segments between its "%%" lines, ended by a NULL.
+
+echo "/* The default driver templates, lempar.c and lempar_glr.c, split into"
+echo " * the segments between their \"%%\" lines.  Generated by mktemplates.sh;"
+echo " * do not edit."
+echo " */"
+echo "#include \"template.h\""
+for f in lempar.c lempar_glr.c; do
+  echo
+  echo "const char *const template_$(echo "$f" | tr . _)[] = {"
+  sed -e 's/\\/\\\\/g' -e 's/"/\\"/g' "$f" | awk '
+    function flush(sep) { print "  " (held == "" ? "\"\"" : held) sep; held = "" }
+    /^%%/ { flush(","); next }
+    { if (held != "") print "  " held; held = "\"" $0 "\\n\"" }
+    END { flush(","); print "  0" }'
+  echo "};"
+done
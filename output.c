@@ -0,0 +1,166 @@
+#include "output.h"
+#include "error.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Make room for at least n more bytes */
+static void
+output_reserve(struct output *p, size_t n) {
+  if (p->n + n <= p->nAlloc)
+    return;
+  p->nAlloc = p->nAlloc * 2 + n + 65536;
+  p->z = (char *)realloc(p->z, p->nAlloc);
+  MemoryCheck(p->z);
+}
+
+/* Start an empty file */
+void
+output_init(struct output *p) {
+  memset(p, 0, sizeof(*p));
+}
+
+/* Empty the buffer but keep its space, to build up another text */
+void
+output_reset(struct output *p) {
+  p->n = 0;
+  p->nCounted = 0;
+  p->nLine = 0;
+}
+
+/* Append one character */
+void
+output_putc(struct output *p, int c) {
+  output_reserve(p, 1);
+  p->z[p->n++] = (char)c;
+}
+
+/* Append n bytes of z */
+void
+output_write(struct output *p, const char *z, size_t n) {
+  output_reserve(p, n);
+  memcpy(&p->z[p->n], z, n);
+  p->n += n;
+}
+
+/* Append a string */
+void
+output_puts(struct output *p, const char *z) {
+  output_write(p, z, strlen(z));
+}
+
+/* Append text formatted as by fprintf() */
+void
+output_printf(struct output *p, const char *zFormat, ...) {
+  va_list ap;
+  int n;
+
+  output_reserve(p, 256);
+  va_start(ap, zFormat);
+  n = vsnprintf(&p->z[p->n], p->nAlloc - p->n, zFormat, ap);
+  va_end(ap);
+  if (n >= 0 && (size_t)n >= p->nAlloc - p->n) {
+    output_reserve(p, (size_t)n + 1);
+    va_start(ap, zFormat);
+    n = vsnprintf(&p->z[p->n], p->nAlloc - p->n, zFormat, ap);
+    va_end(ap);
+  }
+  if (n > 0)
+    p->n += n;
+}
+
+/* Append the decimal value of v, right-aligned in a field of the given
+ * width, as fprintf() does for "%*d".  This is what the tables of a
+ * parser are made of, so it avoids the overhead of the general routine.
+ */
+void
+output_int(struct output *p, int v, int width) {
+  char zBuf[24];
+  unsigned int u;
+  int i;
+
+  u = v < 0 ? 0u - (unsigned int)v : (unsigned int)v;
+  i = sizeof(zBuf);
+  do {
+    zBuf[--i] = (char)('0' + u % 10);
+    u /= 10;
+  } while (u);
+  if (v < 0)
+    zBuf[--i] = '-';
+  output_reserve(p, (size_t)width + sizeof(zBuf));
+  while (width-- > (int)sizeof(zBuf) - i)
+    p->z[p->n++] = ' ';
+  output_write(p, &zBuf[i], sizeof(zBuf) - i);
+}
+
+/* Return the number of the line being written, counting from 1 */
+int
+output_lineno(struct output *p) {
+  for (; p->nCounted < p->n; p->nCounted++) {
+    if (p->z[p->nCounted] == '\n')
+      p->nLine++;
+  }
+  return p->nLine + 1;
+}
+
+/* Return true if the file zFilename already holds the text of the buffer */
+static int
+output_same(struct output *p, const char *zFilename) {
+  char zBuf[65536];
+  size_t i, n;
+  FILE *in;
+  int same;
+
+  in = fopen(zFilename, "rb");
+  if (in == 0)
+    return 0;
+  i = 0;
+  while ((n = fread(zBuf, 1, sizeof(zBuf), in)) > 0) {
+    if (n > p->n - i || memcmp(&p->z[i], zBuf, n) != 0)
+      break;
+    i += n;
+  }
+  same = n == 0 && i == p->n && !ferror(in);
+  fclose(in);
+  return same;
+}
+
+/* Save the buffer as the file zFilename and free it.  A file that
+ * already holds the same text is left alone, so that its time stamp
+ * does not trigger a rebuild.  Otherwise the text goes to a temporary
+ * file that is then renamed over zFilename, so that a reader never
+ * sees a partial file.  Return non-zero if the file could not be
+ * written.
+ */
+int
+output_save(struct output *p, const char *zFilename) {
+  char *zTemp;
+  FILE *fp;
+  int rc = 0;
+
+  if (!output_same(p, zFilename)) {
+    zTemp = (char *)malloc(strlen(zFilename) + 5);
+    MemoryCheck(zTemp);
+    sprintf(zTemp, "%s.tmp", zFilename);
+    fp = fopen(zTemp, "wb");
+    rc = fp == 0;
+    if (fp) {
+      rc = p->n > 0 && fwrite(p->z, 1, p->n, fp) != p->n;
+      rc |= fclose(fp) != 0;
+    }
+#ifdef __WIN32__
+    if (rc == 0)
+      remove(zFilename);
+#endif
+    if (rc == 0)
+      rc = rename(zTemp, zFilename) != 0;
+    if (rc)
+      remove(zTemp);
+    free(zTemp);
+  }
+  free(p->z);
+  output_init(p);
+  return rc;
+}
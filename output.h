@@ -0,0 +1,30 @@
+#ifndef _LEMON_OUTPUT_H_
+#define _LEMON_OUTPUT_H_
+
+#include <stddef.h>
+
+/*
+ * Buffered writing of the files generated by the LEMON parser generator.
+ * A file is assembled in memory and written out with a single fwrite(),
+ * and only if its text has changed.
+ */
+
+struct output {
+  char *z;         // Text of the file so far
+  size_t n;        // Number of bytes used in z[]
+  size_t nAlloc;   // Number of bytes allocated for z[]
+  size_t nCounted; // Number of bytes of z[] whose newlines are in nLine
+  int nLine;       // Number of newlines in the first nCounted bytes
+};
+
+void output_init(struct output *);                        // Start an empty file
+void output_reset(struct output *);                       // Empty it, keeping the space
+void output_putc(struct output *, int);                   // Append a character
+void output_write(struct output *, const char *, size_t); // Append N bytes
+void output_puts(struct output *, const char *);          // Append a string
+void output_printf(struct output *, const char *, ...);   // Append like fprintf()
+void output_int(struct output *, int, int);               // Append like "%*d"
+int output_lineno(struct output *);                       // Number of the line being written
+int output_save(struct output *, const char *);           // Write to a file if changed
+
+#endif //_LEMON_OUTPUT_H_
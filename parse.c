@@ -9,6 +9,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 /* The state of the parser */
 enum e_state {
@@ -32,14 +39,16 @@ enum e_state {
   WAITING_FOR_DATATYPE_SYMBOL,
   WAITING_FOR_FALLBACK_ID,
   WAITING_FOR_WILDCARD_ID,
+  WAITING_FOR_SYNC_ID,
   WAITING_FOR_CLASS_ID,
-  WAITING_FOR_CLASS_TOKEN
+  WAITING_FOR_CLASS_TOKEN,
+  WAITING_FOR_BOXED_SYMBOL
 };
 struct pstate {
   char *filename;             // Name of the input file
   int tokenlineno;            // Linenumber at which current token starts
   int errorcnt;               // Number of errors so far
-  char *tokenstart;           // Text of current token
+  char *tokenstart;           // Text of current token, valid only while it is parsed
   struct lemon *lemp;           // Global state vector
   enum e_state state;         // The state of the parser
   struct symbol *fallback;    // The fallback token
@@ -60,13 +69,11 @@ struct pstate {
   struct rule *lastrule;      // Pointer to the most recently parsed rule
 };
 
-// TODO: move
-extern int nDefine;
-extern char **azDefine;
-
 /* forward declarations */
 static void parseonetoken(struct pstate *);
-static void preprocess_input(char *);
+static void preprocess_input(struct pstate *, char *);
+static char *load_input(struct pstate *, size_t *);
+static void unload_input(char *, size_t);
 
 /* In spite of its name, this function is really a scanner.  It read
  * in the entire input file (all at once) then tokenizes it.  Each
@@ -76,9 +83,8 @@ static void preprocess_input(char *);
 void
 Parse(struct lemon *lemp) {
   struct pstate ps;
-  FILE *fp;
   char *filebuf;
-  long filesize;
+  size_t nmap;
   int lineno;
   int c;
   char *cp, *nextcp;
@@ -90,32 +96,20 @@ Parse(struct lemon *lemp) {
   ps.errorcnt = 0;
   ps.state = INITIALIZE;
 
-  /* Begin by reading the input file */
-  fp = fopen(ps.filename, "rb");
-  if (fp == 0) {
-    ErrorMsg(lemp, 0, "Can't open this file for reading.");
-    return;
-  }
-  fseek(fp, 0, 2);
-  filesize = ftell(fp);
-  rewind(fp);
-  filebuf = (char *)malloc((size_t)(filesize + 1));
-  if (filesize > 100000000 || filebuf == 0) {
-    ErrorMsg(lemp, 0, "Input file too large.");
-    fclose(fp);
+  /* Begin by bringing in the input file */
+  filebuf = load_input(&ps, &nmap);
+  if (filebuf == 0) {
+    lemp->errorcnt = ps.errorcnt;
     return;
   }
-  if (fread(filebuf, 1, (size_t)filesize, fp) != filesize) {
-    ErrorMsg(lemp, 0, "Can't read in all %d bytes of this file.", filesize);
-    free(filebuf);
-    fclose(fp);
-    return;
-  }
-  fclose(fp);
-  filebuf[filesize] = 0;
 
   /* Make an initial pass through the file to handle %ifdef and %ifndef */
-  preprocess_input(filebuf);
+  preprocess_input(&ps, filebuf);
+  if (ps.errorcnt) {
+    unload_input(filebuf, nmap);
+    lemp->errorcnt = ps.errorcnt;
+    return;
+  }
 
   /* Now scan the text of the input file */
   lineno = 1;
@@ -227,8 +221,8 @@ Parse(struct lemon *lemp) {
     *cp = (char)c;      // Restore the buffer
     cp = nextcp;
   }
-  free(filebuf); // Release the buffer after parsing
-  lemp->rules = ps.rules;
+  unload_input(filebuf, nmap); // Release the buffer after parsing
+  lemp->rules = rule_list_reverse(ps.rules); // The rules were inserted last first
   lemp->errorcnt = ps.errorcnt;
 }
 
@@ -236,7 +230,7 @@ Parse(struct lemon *lemp) {
 static void
 parseonetoken(struct pstate *psp) {
   const char *x;
-  x = make_string(psp->tokenstart); // Save the token permanently
+  x = psp->tokenstart; // Interned only where the token outlives this call
   switch (psp->state) {
   case INITIALIZE:
     psp->prevrule = 0;
@@ -248,7 +242,7 @@ parseonetoken(struct pstate *psp) {
     if (x[0] == '%') {
       psp->state = WAITING_FOR_DECL_KEYWORD;
     } else if (islower(x[0])) {
-      psp->lhs = make_symbol(x);
+      psp->lhs = make_symbol(psp->lemp, x);
       psp->nrhs = 0;
       psp->lhsalias = 0;
       psp->state = WAITING_FOR_ARROW;
@@ -263,7 +257,7 @@ parseonetoken(struct pstate *psp) {
                             to follow the previous rule.");
       } else {
         psp->prevrule->line = psp->tokenlineno;
-        psp->prevrule->code = &x[1];
+        psp->prevrule->code = &make_string(psp->lemp, x)[1];
       }
     } else if (x[0] == '[') {
       psp->state = PRECEDENCE_MARK_1;
@@ -281,7 +275,7 @@ parseonetoken(struct pstate *psp) {
                "Precedence mark on this line is not the first \
                         to follow the previous rule.");
     } else {
-      psp->prevrule->precsym = make_symbol(x);
+      psp->prevrule->precsym = make_symbol(psp->lemp, x);
     }
     psp->state = PRECEDENCE_MARK_2;
     break;
@@ -304,7 +298,7 @@ parseonetoken(struct pstate *psp) {
     break;
   case LHS_ALIAS_1:
     if (isalpha(x[0])) {
-      psp->lhsalias = x;
+      psp->lhsalias = make_string(psp->lemp, x);
       psp->state = LHS_ALIAS_2;
     } else {
       ErrorMsg(psp, psp->tokenlineno, "\"%s\" is not a valid alias for the LHS \"%s\"\n", x, psp->lhs->name);
@@ -362,7 +356,7 @@ parseonetoken(struct pstate *psp) {
         psp->errorcnt++;
         psp->state = RESYNC_AFTER_RULE_ERROR;
       } else {
-        psp->rhs[psp->nrhs] = make_symbol(x);
+        psp->rhs[psp->nrhs] = make_symbol(psp->lemp, x);
         psp->alias[psp->nrhs] = 0;
         psp->nrhs++;
       }
@@ -381,7 +375,7 @@ parseonetoken(struct pstate *psp) {
       }
       msp->nsubsym++;
       msp->subsym = (struct symbol **)realloc(msp->subsym, sizeof(struct symbol *) * msp->nsubsym);
-      msp->subsym[msp->nsubsym - 1] = make_symbol(&x[1]);
+      msp->subsym[msp->nsubsym - 1] = make_symbol(psp->lemp, &x[1]);
       if (islower(x[1]) || islower(msp->subsym[0]->name[0])) {
         ErrorMsg(psp, psp->tokenlineno, "Cannot form a compound containing a non-terminal");
         psp->errorcnt++;
@@ -395,7 +389,7 @@ parseonetoken(struct pstate *psp) {
     break;
   case RHS_ALIAS_1:
     if (isalpha(x[0])) {
-      psp->alias[psp->nrhs - 1] = x;
+      psp->alias[psp->nrhs - 1] = make_string(psp->lemp, x);
       psp->state = RHS_ALIAS_2;
     } else {
       ErrorMsg(psp, psp->tokenlineno, "\"%s\" is not a valid alias for the RHS symbol \"%s\"\n", x,
@@ -413,7 +407,7 @@ parseonetoken(struct pstate *psp) {
     break;
   case WAITING_FOR_DECL_KEYWORD:
     if (isalpha(x[0])) {
-      psp->declkeyword = x;
+      psp->declkeyword = make_string(psp->lemp, x);
       psp->declargslot = 0;
       psp->decllinenoslot = 0;
       psp->insertLineMacro = 1;
@@ -476,8 +470,15 @@ parseonetoken(struct pstate *psp) {
         psp->state = WAITING_FOR_FALLBACK_ID;
       } else if (strcmp(x, "wildcard") == 0) {
         psp->state = WAITING_FOR_WILDCARD_ID;
+      } else if (strcmp(x, "sync_token") == 0) {
+        psp->state = WAITING_FOR_SYNC_ID;
       } else if (strcmp(x, "token_class") == 0) {
         psp->state = WAITING_FOR_CLASS_ID;
+      } else if (strcmp(x, "boxed") == 0) {
+        if (psp->lemp->glr || psp->lemp->cplusplus) {
+          ErrorMsg(psp, psp->tokenlineno, "%%boxed is only supported by the C template of the LALR driver.");
+        }
+        psp->state = WAITING_FOR_BOXED_SYMBOL;
       } else {
         ErrorMsg(psp, psp->tokenlineno, "Unknown declaration keyword: \"%%%s\".", x);
         psp->errorcnt++;
@@ -493,7 +494,7 @@ parseonetoken(struct pstate *psp) {
       ErrorMsg(psp, psp->tokenlineno, "Symbol name missing after %%destructor keyword");
       psp->state = RESYNC_AFTER_DECL_ERROR;
     } else {
-      struct symbol *sp = make_symbol(x);
+      struct symbol *sp = make_symbol(psp->lemp, x);
       psp->declargslot = &sp->destructor;
       psp->decllinenoslot = &sp->destLineno;
       psp->insertLineMacro = 1;
@@ -505,14 +506,14 @@ parseonetoken(struct pstate *psp) {
       ErrorMsg(psp, psp->tokenlineno, "Symbol name missing after %%type keyword");
       psp->state = RESYNC_AFTER_DECL_ERROR;
     } else {
-      struct symbol *sp = lookup_symbol(x);
+      struct symbol *sp = lookup_symbol(psp->lemp, x);
       if ((sp) && (sp->datatype)) {
         ErrorMsg(psp, psp->tokenlineno, "Symbol %%type \"%s\" already defined", x);
         psp->errorcnt++;
         psp->state = RESYNC_AFTER_DECL_ERROR;
       } else {
         if (!sp) {
-          sp = make_symbol(x);
+          sp = make_symbol(psp->lemp, x);
         }
         psp->declargslot = &sp->datatype;
         psp->insertLineMacro = 0;
@@ -525,7 +526,7 @@ parseonetoken(struct pstate *psp) {
       psp->state = WAITING_FOR_DECL_OR_RULE;
     } else if (isupper(x[0])) {
       struct symbol *sp;
-      sp = make_symbol(x);
+      sp = make_symbol(psp->lemp, x);
       if (sp->prec >= 0) {
         ErrorMsg(psp, psp->tokenlineno, "Symbol \"%s\" has already be given a precedence.", x);
         psp->errorcnt++;
@@ -601,7 +602,7 @@ parseonetoken(struct pstate *psp) {
     } else if (!isupper(x[0])) {
       ErrorMsg(psp, psp->tokenlineno, "%%fallback argument \"%s\" should be a token", x);
     } else {
-      struct symbol *sp = make_symbol(x);
+      struct symbol *sp = make_symbol(psp->lemp, x);
       if (psp->fallback == 0) {
         psp->fallback = sp;
       } else if (sp->fallback) {
@@ -619,7 +620,7 @@ parseonetoken(struct pstate *psp) {
     } else if (!isupper(x[0])) {
       ErrorMsg(psp, psp->tokenlineno, "%%wildcard argument \"%s\" should be a token", x);
     } else {
-      struct symbol *sp = make_symbol(x);
+      struct symbol *sp = make_symbol(psp->lemp, x);
       if (psp->lemp->wildcard == 0) {
         psp->lemp->wildcard = sp;
       } else {
@@ -628,15 +629,30 @@ parseonetoken(struct pstate *psp) {
       }
     }
     break;
+  case WAITING_FOR_SYNC_ID:
+    if (x[0] == '.') {
+      psp->state = WAITING_FOR_DECL_OR_RULE;
+    } else if (!isupper(x[0])) {
+      ErrorMsg(psp, psp->tokenlineno, "%%sync_token argument \"%s\" should be a token", x);
+    } else {
+      struct symbol *sp = make_symbol(psp->lemp, x);
+      if (psp->lemp->synctoken == 0) {
+        psp->lemp->synctoken = sp;
+      } else {
+        ErrorMsg(psp, psp->tokenlineno, "Extra sync token: %s", x);
+        psp->errorcnt++;
+      }
+    }
+    break;
   case WAITING_FOR_CLASS_ID:
     if (!islower(x[0])) {
       ErrorMsg(psp, psp->tokenlineno, "%%token_class must be followed by an identifier: ", x);
       psp->state = RESYNC_AFTER_DECL_ERROR;
-    } else if (lookup_symbol(x)) {
+    } else if (lookup_symbol(psp->lemp, x)) {
       ErrorMsg(psp, psp->tokenlineno, "Symbol \"%s\" already used", x);
       psp->state = RESYNC_AFTER_DECL_ERROR;
     } else {
-      psp->tkclass = make_symbol(x);
+      psp->tkclass = make_symbol(psp->lemp, x);
       psp->tkclass->type = MULTITERMINAL;
       psp->state = WAITING_FOR_CLASS_TOKEN;
     }
@@ -650,12 +666,22 @@ parseonetoken(struct pstate *psp) {
       msp->subsym = (struct symbol **)realloc(msp->subsym, sizeof(struct symbol *) * msp->nsubsym);
       if (!isupper(x[0]))
         x++;
-      msp->subsym[msp->nsubsym - 1] = make_symbol(x);
+      msp->subsym[msp->nsubsym - 1] = make_symbol(psp->lemp, x);
     } else {
       ErrorMsg(psp, psp->tokenlineno, "%%token_class argument \"%s\" should be a token", x);
       psp->state = RESYNC_AFTER_DECL_ERROR;
     }
     break;
+  case WAITING_FOR_BOXED_SYMBOL:
+    if (x[0] == '.') {
+      psp->state = WAITING_FOR_DECL_OR_RULE;
+    } else if (!islower(x[0])) {
+      ErrorMsg(psp, psp->tokenlineno, "%%boxed argument \"%s\" should be a nonterminal", x);
+    } else {
+      struct symbol *sp = make_symbol(psp->lemp, x);
+      sp->boxed = true;
+    }
+    break;
   case RESYNC_AFTER_RULE_ERROR:
   case RESYNC_AFTER_DECL_ERROR:
     if (x[0] == '.')
@@ -666,13 +692,14 @@ parseonetoken(struct pstate *psp) {
   }
 }
 
-/* Run the preprocessor over the input file text.  The global variables
- * azDefine[0] through azDefine[nDefine-1] contains the names of all defined
- * macros.  This routine looks for "%ifdef" and "%ifndef" and "%endif" and
+/* Run the preprocessor over the input file text.  The fields
+ * azDefine[0] through azDefine[nDefine-1] of lemp contain the names of all
+ * defined macros.  This routine looks for "%ifdef" and "%ifndef" and "%endif" and
  * comments them out.  Text in between is also commented out as appropriate.
  */
 static void
-preprocess_input(char *z) {
+preprocess_input(struct pstate *psp, char *z) {
+  struct lemon *lemp = psp->lemp;
   int i, j, k;
   size_t n;
   int exclude = 0;
@@ -705,8 +732,8 @@ preprocess_input(char *z) {
         for (n = 0; z[j + n] && !isspace(z[j + n]); n++) {
         }
         exclude = 1;
-        for (k = 0; k < nDefine; k++) {
-          if (strncmp(azDefine[k], &z[j], n) == 0 && strlen(azDefine[k]) == n) {
+        for (k = 0; k < lemp->nDefine; k++) {
+          if (strncmp(lemp->azDefine[k], &z[j], n) == 0 && strlen(lemp->azDefine[k]) == n) {
             exclude = 0;
             break;
           }
@@ -723,6 +750,84 @@ preprocess_input(char *z) {
     }
   }
   if (exclude) {
-    lprintf(LFATAL, "unterminated %%ifdef starting on line %d", start_lineno);
+    ErrorMsg(psp, start_lineno, "unterminated %%ifdef starting on this line");
+  }
+}
+
+/* Bring the whole input file into memory as one NUL-terminated,
+ * writable buffer.  Where possible the file is mapped privately
+ * rather than copied: pages are only read as the scanner reaches
+ * them, and the in-place edits of the preprocessor and the scanner
+ * never reach the file.  *pnMap receives the size of the mapping,
+ * or 0 when the text had to be read into the heap instead.
+ */
+static char *
+load_input(struct pstate *psp, size_t *pnMap) {
+  FILE *fp;
+  char *buf;
+  size_t n;
+
+  *pnMap = 0;
+#ifndef __WIN32__
+  {
+    struct stat st;
+    int fd = open(psp->filename, O_RDONLY);
+    if (fd >= 0) {
+      buf = 0;
+      /* The zero-filled tail of the last page supplies the terminator,
+       * so a file that ends exactly on a page boundary is read instead. */
+      if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+          st.st_size % sysconf(_SC_PAGESIZE) != 0 && (uintmax_t)st.st_size < SIZE_MAX) {
+        n = (size_t)st.st_size;
+        buf = (char *)mmap(0, n, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (buf == MAP_FAILED)
+          buf = 0;
+        else
+          *pnMap = n;
+      }
+      close(fd);
+      if (buf)
+        return buf;
+    }
+  }
+#endif
+  fp = fopen(psp->filename, "rb");
+  if (fp == 0) {
+    ErrorMsg(psp, 0, "Can't open this file for reading.");
+    return 0;
+  }
+  if (fseek(fp, 0, SEEK_END) != 0 || ftell(fp) < 0) {
+    ErrorMsg(psp, 0, "Can't determine the size of this file.");
+    fclose(fp);
+    return 0;
+  }
+  n = (size_t)ftell(fp);
+  rewind(fp);
+  buf = (char *)malloc(n + 1);
+  if (buf == 0) {
+    ErrorMsg(psp, 0, "Input file too large.");
+    fclose(fp);
+    return 0;
+  }
+  if (fread(buf, 1, n, fp) != n) {
+    ErrorMsg(psp, 0, "Can't read in all %lu bytes of this file.", (unsigned long)n);
+    free(buf);
+    fclose(fp);
+    return 0;
+  }
+  fclose(fp);
+  buf[n] = 0;
+  return buf;
+}
+
+/* Release a buffer obtained from load_input() */
+static void
+unload_input(char *buf, size_t nMap) {
+#ifndef __WIN32__
+  if (nMap) {
+    munmap(buf, nMap);
+    return;
   }
+#endif
+  free(buf);
 }
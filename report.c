@@ -2,40 +2,33 @@
 #include "acttab.h"
 #include "config.h"
 #include "error.h"
+#include "grammar.h"
 #include "parse.h"
 #include "set.h"
 #include "lemon.h"
+#include "output.h"
 #include "rule.h"
 #include "state.h"
 #include "string.h"
 #include "symbol.h"
+#include "template.h"
 
 #include <assert.h>
 #include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-
-#ifdef __WIN32__
-#ifdef __cplusplus
-extern "C" {
-#endif
-extern int access(const char *path, int mode);
-#ifdef __cplusplus
-}
-#endif
-#else
-#include <unistd.h>
-#endif
+#include <time.h>
 
 #define LINESIZE 1000
 #define NO_OFFSET (-2147483647)
 
 // TODO: move
-extern int showPrecedenceConflict;
+extern bool showPrecedenceConflict;
 extern char *user_templatename;
 
-/* Generate a filename with the given suffix.  Space to hold the
+/* Generate a filename with the given suffix, and with the variant
+ * of the run (if any) ahead of the suffix.  Space to hold the
  * name comes from malloc() and must be freed by the calling
  * function.
  */
@@ -43,35 +36,39 @@ static char *
 file_makename(struct lemon *lemp, const char *suffix) {
   char *name;
   char *cp;
+  size_t nvariant = lemp->variant ? strlen(lemp->variant) : 0;
 
-  name = (char *)malloc(strlen(lemp->filename) + strlen(suffix) + 5);
+  name = (char *)malloc(strlen(lemp->filename) + nvariant + strlen(suffix) + 5);
   MemoryCheck(name);
   strcpy(name, lemp->filename);
   cp = strrchr(name, '.');
   if (cp)
     *cp = 0;
+  if (lemp->variant)
+    strcat(name, lemp->variant);
   strcat(name, suffix);
   return name;
 }
 
-/* Open a file with a name based on the name of the input file,
- * but with a different (specified) suffix, and return a pointer
- * to the stream
+/* Name the output file after the input file, but with a different
+ * (specified) suffix
  */
-static FILE *
-file_open(struct lemon *lemp, const char *suffix, const char *mode) {
-  FILE *fp;
-
+static void
+file_setname(struct lemon *lemp, const char *suffix) {
   if (lemp->outname)
     free(lemp->outname);
   lemp->outname = file_makename(lemp, suffix);
-  fp = fopen(lemp->outname, mode);
-  if (fp == 0 && *mode == 'w') {
-    lprintf(LERROR, "Can't open file \"%s\".", lemp->outname);
+}
+
+/* Save the text of an output file under the name set by file_setname().
+ * A file which already holds that text is not rewritten.
+ */
+static void
+file_save(struct lemon *lemp, struct output *out) {
+  if (output_save(out, lemp->outname)) {
+    lprintf(LERROR, "Can't write file \"%s\".", lemp->outname);
     lemp->errorcnt++;
-    return 0;
   }
-  return fp;
 }
 
 /* Duplicate the input file without comments and without actions
@@ -125,65 +122,65 @@ Reprint(struct lemon *lemp) {
 }
 
 void
-ConfigPrint(FILE *fp, struct config *cfp) {
+ConfigPrint(struct output *out, struct config *cfp) {
   struct rule *rp;
   struct symbol *sp;
   int i, j;
   rp = cfp->rule;
-  fprintf(fp, "%s ::=", rp->lhs->name);
+  output_printf(out, "%s ::=", rp->lhs->name);
   for (i = 0; i <= rp->nrhs; i++) {
     if (i == cfp->position)
-      fprintf(fp, " *");
+      output_printf(out, " *");
     if (i == rp->nrhs)
       break;
     sp = rp->rhs[i];
     if (sp->type == MULTITERMINAL) {
-      fprintf(fp, " %s", sp->subsym[0]->name);
+      output_printf(out, " %s", sp->subsym[0]->name);
       for (j = 1; j < sp->nsubsym; j++) {
-        fprintf(fp, "|%s", sp->subsym[j]->name);
+        output_printf(out, "|%s", sp->subsym[j]->name);
       }
     } else {
-      fprintf(fp, " %s", sp->name);
+      output_printf(out, " %s", sp->name);
     }
   }
 }
 
-/* Print an action to the given file descriptor.  Return FALSE if
+/* Print an action to the given output buffer.  Return FALSE if
  * nothing was actually printed.
  */
 int
-PrintAction(struct action *ap, FILE *fp, int indent) {
+PrintAction(struct action *ap, struct output *out, int indent) {
   int result = 1;
   switch (ap->type) {
   case SHIFT:
-    fprintf(fp, "%*s shift  %d", indent, ap->sp->name, ap->x.stp->statenum);
+    output_printf(out, "%*s shift  %d", indent, ap->sp->name, ap->x.stp->statenum);
     break;
   case REDUCE:
-    fprintf(fp, "%*s reduce %d", indent, ap->sp->name, ap->x.rp->index);
+    output_printf(out, "%*s reduce %d", indent, ap->sp->name, ap->x.rp->index);
     break;
   case ACCEPT:
-    fprintf(fp, "%*s accept", indent, ap->sp->name);
+    output_printf(out, "%*s accept", indent, ap->sp->name);
     break;
   case ERROR:
-    fprintf(fp, "%*s error", indent, ap->sp->name);
+    output_printf(out, "%*s error", indent, ap->sp->name);
     break;
   case SRCONFLICT:
   case RRCONFLICT:
-    fprintf(fp, "%*s reduce %-3d ** Parsing conflict **", indent, ap->sp->name, ap->x.rp->index);
+    output_printf(out, "%*s reduce %-3d ** Parsing conflict **", indent, ap->sp->name, ap->x.rp->index);
     break;
   case SSCONFLICT:
-    fprintf(fp, "%*s shift  %-3d ** Parsing conflict **", indent, ap->sp->name, ap->x.stp->statenum);
+    output_printf(out, "%*s shift  %-3d ** Parsing conflict **", indent, ap->sp->name, ap->x.stp->statenum);
     break;
   case SH_RESOLVED:
     if (showPrecedenceConflict) {
-      fprintf(fp, "%*s shift  %-3d -- dropped by precedence", indent, ap->sp->name, ap->x.stp->statenum);
+      output_printf(out, "%*s shift  %-3d -- dropped by precedence", indent, ap->sp->name, ap->x.stp->statenum);
     } else {
       result = 0;
     }
     break;
   case RD_RESOLVED:
     if (showPrecedenceConflict) {
-      fprintf(fp, "%*s reduce %-3d -- dropped by precedence", indent, ap->sp->name, ap->x.rp->index);
+      output_printf(out, "%*s reduce %-3d -- dropped by precedence", indent, ap->sp->name, ap->x.rp->index);
     } else {
       result = 0;
     }
@@ -195,119 +192,231 @@ PrintAction(struct action *ap, FILE *fp, int indent) {
   return result;
 }
 
-/* Generate the "y.output" log file */
-void
-ReportOutput(struct lemon *lemp) {
+/* Return the symbol that state 0 accepts, or NULL if there is none */
+static struct symbol *
+start_symbol(struct lemon *lemp) {
+  struct state *stp = lemp->sorted[0];
   int i;
-  struct state *stp;
-  struct config_list *cfp;
-  struct action_list *ap;
-  FILE *fp;
+  for (i = 0; i < stp->nAction; i++) {
+    if (stp->actions[i].type == ACCEPT)
+      return stp->actions[i].sp;
+  }
+  return 0;
+}
 
-  fp = file_open(lemp, ".out", "wb");
-  if (fp == 0)
-    return;
-  for (i = 0; i < lemp->nstate; i++) {
-    stp = lemp->sorted[i];
-    fprintf(fp, "State %d:\n", stp->statenum);
-    cfp = stp->configs;
-    while (cfp) {
-      char buf[20];
-      if (cfp->item->position == cfp->item->rule->nrhs) {
-        sprintf(buf, "(%d)", cfp->item->rule->index);
-        fprintf(fp, "    %5s ", buf);
-      } else {
-        fprintf(fp, "          ");
+/* Write the configurations and actions of a state to the .out listing */
+static void
+report_state_text(struct output *out, struct state *stp) {
+  struct config *cfp;
+  struct action *ap;
+  int i;
+
+  output_printf(out, "State %d:\n", stp->statenum);
+  for (i = 0; i < stp->nConfig; i++) {
+    char buf[20];
+    cfp = stp->configs[i];
+    if (cfp->position == cfp->rule->nrhs) {
+      sprintf(buf, "(%d)", cfp->rule->index);
+      output_printf(out, "    %5s ", buf);
+    } else {
+      output_printf(out, "          ");
+    }
+    ConfigPrint(out, cfp);
+    output_printf(out, "\n");
+  }
+  output_printf(out, "\n");
+  for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+    if (PrintAction(ap, out, 30))
+      output_printf(out, "\n");
+  }
+  output_printf(out, "\n");
+}
+
+/* Write a string as a JSON string literal */
+static void
+json_string(struct output *out, const char *z) {
+  output_putc(out, '"');
+  for (; *z; z++) {
+    unsigned char c = (unsigned char)*z;
+    if (c == '"' || c == '\\') {
+      output_putc(out, '\\');
+      output_putc(out, c);
+    } else if (c < 0x20) {
+      output_printf(out, "\\u%04x", c);
+    } else {
+      output_putc(out, c);
+    }
+  }
+  output_putc(out, '"');
+}
+
+/* Write a yy_action[] offset as JSON, null if the state has none */
+static void
+json_offset(struct output *out, const char *zName, int iOfst) {
+  if (iOfst == NO_OFFSET)
+    output_printf(out, ",\"%s\":null", zName);
+  else
+    output_printf(out, ",\"%s\":%d", zName, iOfst);
+}
+
+/* Write the configurations of a state as JSON pairs of rule and dot,
+ * either those of the basis or those added by the closure.  The basis
+ * is told from the configurations themselves, as an automaton from
+ * the cache has no basis arrays: it holds those past their first symbol
+ * and, in state 0, the rules of the start symbol.
+ */
+static void
+json_configs(struct output *out, struct state *stp, struct symbol *start, int isBasis) {
+  int i, n = 0;
+  output_putc(out, '[');
+  for (i = 0; i < stp->nConfig; i++) {
+    struct config *c = stp->configs[i];
+    int inBasis = c->position > 0 || (stp->statenum == 0 && c->rule->lhs == start);
+    if (inBasis != isBasis)
+      continue;
+    output_printf(out, "%s[%d,%d]", n++ ? "," : "", c->rule->index, c->position);
+  }
+  output_putc(out, ']');
+}
+
+/* Write a state to the JSON report: its configurations, its actions by
+ * look-ahead symbol and its place in the parse tables.
+ */
+static void
+report_state_json(struct output *out, struct state *stp, struct symbol *start) {
+  static const char *const azType[] = {"shift", "accept", "reduce", "error", "ss-conflict",
+                                       "sr-conflict", "rr-conflict", "shift-resolved", "reduce-resolved"};
+  struct action *ap;
+  int n = 0;
+
+  output_printf(out, "{\"state\":%d,\"basis\":", stp->statenum);
+  json_configs(out, stp, start, 1);
+  output_printf(out, ",\"closure\":");
+  json_configs(out, stp, start, 0);
+  output_printf(out, ",\"actions\":[");
+  for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+    if (ap->type == NOT_USED)
+      continue;
+    output_printf(out, "%s{\"symbol\":%d,\"type\":\"%s\"", n++ ? "," : "", ap->sp->index, azType[ap->type]);
+    switch (ap->type) {
+    case SHIFT:
+    case SSCONFLICT:
+    case SH_RESOLVED:
+      output_printf(out, ",\"state\":%d}", ap->x.stp->statenum);
+      break;
+    case REDUCE:
+    case SRCONFLICT:
+    case RRCONFLICT:
+    case RD_RESOLVED:
+      output_printf(out, ",\"rule\":%d}", ap->x.rp->index);
+      break;
+    default:
+      output_putc(out, '}');
+      break;
+    }
+  }
+  output_printf(out, "],\"nTknAct\":%d,\"nNtAct\":%d", stp->nTknAct, stp->nNtAct);
+  json_offset(out, "iTknOfst", stp->iTknOfst);
+  json_offset(out, "iNtOfst", stp->iNtOfst);
+  output_printf(out, ",\"iDflt\":%d,\"autoReduce\":%s}", stp->iDflt, stp->autoReduce ? "true" : "false");
+}
+
+/* Write the symbols and rules of the grammar to the JSON report, ahead
+ * of the states
+ */
+static void
+report_grammar_json(struct output *out, struct lemon *lemp) {
+  struct rule_list *rp;
+  int i, j, n;
+
+  output_printf(out, "{\"grammar\":");
+  json_string(out, lemp->filename);
+  output_printf(out, ",\"nterminal\":%d,\"nsymbol\":%d,\"nrule\":%d,\"nstate\":%d,\"nconflict\":%d", lemp->nterminal,
+                lemp->nsymbol, lemp->nrule, lemp->nstate, lemp->nconflict);
+  output_printf(out, ",\"nAction\":%d,\n\"symbols\":[\n", lemp->acttab ? acttab_size(lemp->acttab) : 0);
+  for (i = 0; i < lemp->nsymbol; i++) {
+    struct symbol *sp = lemp->symbols[i];
+    output_printf(out, "{\"index\":%d,\"name\":", i);
+    json_string(out, sp->name);
+    if (sp->type == NONTERMINAL) {
+      output_printf(out, ",\"lambda\":%s,\"first\":[", lemp->grammar->aLambda[i] ? "true" : "false");
+      for (j = n = 0; j < lemp->nterminal; j++) {
+        if (lemp->grammar->aFirstset[i] && SetFind(lemp->grammar->aFirstset[i], j))
+          output_printf(out, "%s%d", n++ ? "," : "", j);
       }
-      ConfigPrint(fp, cfp->item);
-      fprintf(fp, "\n");
-      cfp = cfp->next;
+      output_putc(out, ']');
     }
-    fprintf(fp, "\n");
-    for (ap = stp->actions; ap; ap = ap->next) {
-      if (PrintAction(ap->item, fp, 30))
-        fprintf(fp, "\n");
+    output_printf(out, "}%s\n", i < lemp->nsymbol - 1 ? "," : "");
+  }
+  output_printf(out, "],\n\"rules\":[\n");
+  for (rp = lemp->rules; rp; rp = rp->next) {
+    struct rule *r = rp->item;
+    output_printf(out, "{\"index\":%d,\"line\":%d,\"lhs\":%d,\"rhs\":[", r->index, r->ruleline, r->lhs->index);
+    for (j = 0; j < r->nrhs; j++)
+      output_printf(out, "%s%d", j ? "," : "", r->rhs[j]->index);
+    output_printf(out, "]}%s\n", rp->next ? "," : "");
+  }
+  output_printf(out, "],\n\"states\":[\n");
+}
+
+/* Generate the "y.output" log file, if bText, and the same automaton
+ * as JSON in a ".json" file, if bJson.  Both are written as the states
+ * are visited, and after the tables are made, so that the JSON report
+ * can give the offsets of every state into yy_action[].
+ */
+void
+ReportOutput(struct lemon *lemp, int bText, int bJson) {
+  int i;
+  struct output text, json;
+  struct symbol *start = 0; // The symbol state 0 accepts
+
+  output_init(&text);
+  output_init(&json);
+  if (bJson) {
+    report_grammar_json(&json, lemp);
+    start = start_symbol(lemp);
+  }
+  for (i = 0; i < lemp->nstate; i++) {
+    if (bText)
+      report_state_text(&text, lemp->sorted[i]);
+    if (bJson) {
+      report_state_json(&json, lemp->sorted[i], start);
+      output_printf(&json, "%s\n", i < lemp->nstate - 1 ? "," : "");
     }
-    fprintf(fp, "\n");
   }
-  fprintf(fp, "----------------------------------------------------\n");
-  fprintf(fp, "Symbols:\n");
+  if (bJson) {
+    output_printf(&json, "]}\n");
+    file_setname(lemp, ".json");
+    file_save(lemp, &json);
+  }
+  if (!bText)
+    return;
+  output_printf(&text, "----------------------------------------------------\n");
+  output_printf(&text, "Symbols:\n");
   for (i = 0; i < lemp->nsymbol; i++) {
     int j;
     struct symbol *sp;
 
     sp = lemp->symbols[i];
-    fprintf(fp, "  %3d: %s", i, sp->name);
+    output_printf(&text, "  %3d: %s", i, sp->name);
     if (sp->type == NONTERMINAL) {
-      fprintf(fp, ":");
-      if (sp->lambda) {
-        fprintf(fp, " <lambda>");
+      output_printf(&text, ":");
+      if (lemp->grammar->aLambda[i]) {
+        output_printf(&text, " <lambda>");
       }
       for (j = 0; j < lemp->nterminal; j++) {
-        if (sp->firstset && SetFind(sp->firstset, j)) {
-          fprintf(fp, " %s", lemp->symbols[j]->name);
+        if (lemp->grammar->aFirstset[i] && SetFind(lemp->grammar->aFirstset[i], j)) {
+          output_printf(&text, " %s", lemp->symbols[j]->name);
         }
       }
     }
-    fprintf(fp, "\n");
+    output_printf(&text, "\n");
   }
-  fclose(fp);
+  file_setname(lemp, ".out");
+  file_save(lemp, &text);
   return;
 }
 
-/* Search for the file "name" which is in the same directory as
- * the exacutable
- */
-static char *
-pathsearch(char *argv0, char *name, int modemask) {
-  const char *pathlist;
-  char *pathbufptr;
-  char *pathbuf;
-  char *path, *cp;
-  char c;
-
-#ifdef __WIN32__
-  cp = strrchr(argv0, '\\');
-#else
-  cp = strrchr(argv0, '/');
-#endif
-  if (cp) {
-    c = *cp;
-    *cp = 0;
-    path = (char *)malloc(strlen(argv0) + strlen(name) + 2);
-    if (path)
-      sprintf(path, "%s/%s", argv0, name);
-    *cp = c;
-  } else {
-    pathlist = getenv("PATH");
-    if (pathlist == 0)
-      pathlist = ".:/bin:/usr/bin";
-    pathbuf = (char *)malloc(strlen(pathlist) + 1);
-    path = (char *)malloc(strlen(pathlist) + strlen(name) + 2);
-    if ((pathbuf != 0) && (path != 0)) {
-      pathbufptr = pathbuf;
-      strcpy(pathbuf, pathlist);
-      while (*pathbuf) {
-        cp = strchr(pathbuf, ':');
-        if (cp == 0)
-          cp = &pathbuf[strlen(pathbuf)];
-        c = *cp;
-        *cp = 0;
-        sprintf(path, "%s/%s", pathbuf, name);
-        *cp = c;
-        if (c == 0)
-          pathbuf[0] = 0;
-        else
-          pathbuf = &cp[1];
-        if (access(path, modemask) == 0)
-          break;
-      }
-      free(pathbufptr);
-    }
-  }
-  return path;
-}
-
 /* Given an action, compute the integer value for that action
  * which is to be put in the action table of the generated machine.
  * Return negative if no action should be generated.
@@ -335,168 +444,340 @@ compute_action(struct lemon *lemp, struct action *ap) {
   return act;
 }
 
-/* The next cluster of routines are for reading the template file
- * and writing the results to the generated parser
- * The first function transfers data from "in" to "out" until
- * a line is seen which begins with "%%".  The line number is
- * tracked.
- *
- * if name!=0, then any word that begin with "Parse" is changed to
- * begin with *name instead.
+/* A goto of some state on a nonterminal, while finding the defaults */
+struct goto_pair {
+  int iSym;    // The nonterminal, less nterminal
+  int iTarget; // The state the goto leads to
+};
+
+static int
+goto_pair_compare(const void *a, const void *b) {
+  const struct goto_pair *p1 = (const struct goto_pair *)a;
+  const struct goto_pair *p2 = (const struct goto_pair *)b;
+  if (p1->iSym != p2->iSym)
+    return p1->iSym - p2->iSym;
+  return p1->iTarget - p2->iTarget;
+}
+
+/* Find the default goto of every nonterminal, the state that most
+ * states go to on it, with ties going to the lowest state.  The result
+ * is indexed by the symbol less nterminal and holds the no-action code
+ * for a nonterminal without gotos.  The error symbol gets no default,
+ * since the parser looks it up in states that may not shift it.
  */
-static void
-tplt_xfer(char *name, FILE *in, FILE *out, int *lineno) {
-  int i, iStart;
-  char line[LINESIZE];
-  while (fgets(line, LINESIZE, in) && (line[0] != '%' || line[1] != '%')) {
-    (*lineno)++;
-    iStart = 0;
-    if (name) {
-      for (i = 0; line[i]; i++) {
-        if (line[i] == 'P' && strncmp(&line[i], "Parse", 5) == 0 && (i == 0 || !isalpha(line[i - 1]))) {
-          if (i > iStart)
-            fprintf(out, "%.*s", i - iStart, &line[iStart]);
-          fprintf(out, "%s", name);
-          i += 4;
-          iStart = i + 1;
-        }
+static int *
+goto_defaults(struct lemon *lemp) {
+  struct goto_pair *aPair;
+  struct action *ap;
+  int *aDflt;
+  int nNt, nPair, mxPair, i, j, best;
+
+  nNt = lemp->nsymbol - lemp->nterminal;
+  aDflt = (int *)malloc(sizeof(aDflt[0]) * (nNt > 0 ? nNt : 1));
+  MemoryCheck(aDflt);
+  for (i = 0; i < nNt; i++)
+    aDflt[i] = lemp->nstate + lemp->nrule + 2;
+  nPair = mxPair = 0;
+  aPair = 0;
+  for (i = 0; i < lemp->nstate; i++) {
+    for (ap = lemp->sorted[i]->actions; ap < lemp->sorted[i]->actions + lemp->sorted[i]->nAction; ap++) {
+      int action, iSym = ap->sp->index;
+      if (iSym < lemp->nterminal || iSym >= lemp->nsymbol || iSym == lemp->errsym->index)
+        continue;
+      action = compute_action(lemp, ap);
+      if (action < 0)
+        continue;
+      if (nPair >= mxPair) {
+        mxPair = mxPair * 2 + 64;
+        aPair = (struct goto_pair *)realloc(aPair, sizeof(aPair[0]) * mxPair);
+        MemoryCheck(aPair);
+      }
+      aPair[nPair].iSym = iSym - lemp->nterminal;
+      aPair[nPair].iTarget = action;
+      nPair++;
+    }
+  }
+  if (nPair > 0)
+    qsort(aPair, nPair, sizeof(aPair[0]), goto_pair_compare);
+  for (i = 0; i < nPair; i = j) {
+    best = 0;
+    for (j = i; j < nPair && aPair[j].iSym == aPair[i].iSym; j++) {
+      int k = j;
+      while (j + 1 < nPair && aPair[j + 1].iSym == aPair[k].iSym && aPair[j + 1].iTarget == aPair[k].iTarget)
+        j++;
+      if (j - k + 1 > best) {
+        best = j - k + 1;
+        aDflt[aPair[k].iSym] = aPair[k].iTarget;
       }
     }
-    fprintf(out, "%s", &line[iStart]);
   }
+  free(aPair);
+  return aDflt;
 }
 
-/* The next function finds the template file and opens it, returning
- * a pointer to the opened file.
+/* Return the entry of the nonterminal action "ap" in the goto rows of
+ * the action table, or negative if it has none, either because it is
+ * no action or because yy_goto_default[] already holds it.
  */
-static FILE *
-tplt_open(struct lemon *lemp) {
-  static char templatename[] = "lempar.c";
-  char buf[1000];
-  FILE *in;
-  char *tpltname;
-  char *cp;
+static int
+compute_goto(struct lemon *lemp, struct action *ap, int *aGotoDflt) {
+  int action;
+  if (ap->sp->index < lemp->nterminal || ap->sp->index >= lemp->nsymbol)
+    return -1;
+  action = compute_action(lemp, ap);
+  if (action >= 0 && action == aGotoDflt[ap->sp->index - lemp->nterminal])
+    return -1;
+  return action;
+}
 
-  /* first, see if user specified a template filename on the command line. */
-  if (user_templatename != 0) {
-    if (access(user_templatename, 004) == -1) {
-      lprintf(LERROR, "\"Can't find the parser driver template file \\\"%s\\\".", user_templatename);
-      lemp->errorcnt++;
-      return 0;
+/* Return true if the action "ap" is followed on its lookahead by
+ * unresolved conflicts, which a GLR parser keeps as alternatives.
+ * The actions of the state must be sorted.
+ */
+static int
+has_alternatives(struct state *stp, struct action *ap) {
+  struct action *nap;
+  for (nap = ap + 1; nap < stp->actions + stp->nAction && nap->sp == ap->sp; nap++) {
+    switch (nap->type) {
+    case SSCONFLICT:
+    case SRCONFLICT:
+    case RRCONFLICT:
+      return 1;
+    default:
+      break;
     }
-    in = fopen(user_templatename, "rb");
-    if (in == 0) {
-      lprintf(LERROR, "Can't open the template file \"%s\".", user_templatename);
-      lemp->errorcnt++;
-      return 0;
+  }
+  return 0;
+}
+
+/* The conflict lists of a GLR parser.  Every list holds the actions
+ * a parser branch may take on one lookahead in one state, the one LR
+ * would have taken first, and ends with the no-action code.
+ */
+struct glrtab {
+  int *aEntry; // All lists, one after another
+  int nEntry;  // Number of used slots in aEntry[]
+  int nAlloc;  // Number of available slots in aEntry[]
+};
+
+/* Append one action code to the GLR conflict lists */
+static void
+glrtab_append(struct glrtab *p, int action) {
+  if (p->nEntry >= p->nAlloc) {
+    p->nAlloc = p->nAlloc * 2 + 16;
+    p->aEntry = (int *)realloc(p->aEntry, sizeof(p->aEntry[0]) * p->nAlloc);
+    MemoryCheck(p->aEntry);
+  }
+  p->aEntry[p->nEntry++] = action;
+}
+
+/* Like compute_action(), but for a lookahead with unresolved conflicts
+ * return a code past the accept and no-action codes which selects the
+ * list of all its actions in the GLR conflict table.  Identical lists
+ * are shared between states.
+ */
+static int
+compute_glr_action(struct lemon *lemp, struct glrtab *p, struct state *stp, struct action *ap) {
+  struct action *nap;
+  int act, iStart, n, i;
+
+  act = compute_action(lemp, ap);
+  if (act < 0 || !has_alternatives(stp, ap))
+    return act;
+  iStart = p->nEntry;
+  glrtab_append(p, act);
+  for (nap = ap + 1; nap < stp->actions + stp->nAction && nap->sp == ap->sp; nap++) {
+    if (nap->type == SSCONFLICT) {
+      glrtab_append(p, nap->x.stp->statenum);
+    } else if (nap->type == SRCONFLICT || nap->type == RRCONFLICT) {
+      glrtab_append(p, nap->x.rp->index + lemp->nstate);
+    }
+  }
+  glrtab_append(p, lemp->nstate + lemp->nrule + 2);
+  n = p->nEntry - iStart;
+  for (i = 0; i + n <= iStart;) {
+    if (memcmp(&p->aEntry[i], &p->aEntry[iStart], sizeof(p->aEntry[0]) * n) == 0) {
+      p->nEntry = iStart;
+      iStart = i;
+      break;
     }
-    return in;
+    while (p->aEntry[i++] != lemp->nstate + lemp->nrule + 2)
+      ;
   }
+  return lemp->nstate + lemp->nrule + 3 + iStart;
+}
 
-  cp = strrchr(lemp->filename, '.');
-  if (cp) {
-    sprintf(buf, "%.*s.lt", (int)(cp - lemp->filename), lemp->filename);
-  } else {
-    sprintf(buf, "%s.lt", lemp->filename);
+/* Terminals that take the same action in every state can share one
+ * column of the action table.  Fill aClass[] with the first terminal of
+ * the same column as each terminal and return the number of terminals
+ * merged into another.  The end-of-input token, the wildcard and the
+ * tokens of a %fallback keep a column of their own, as the parser looks
+ * those up by their own code.
+ */
+static int
+compute_token_classes(struct lemon *lemp, struct glrtab *glr, int *aClass) {
+  int nterm = lemp->nterminal;
+  int nstate = lemp->nstate;
+  int *aCol;       // The action of every terminal in every state, by terminal
+  unsigned *aHash; // Hash of the column of every terminal
+  char *aOwn;      // True for terminals that keep their own column
+  struct action *ap;
+  int i, j, n;
+
+  aCol = (int *)malloc(sizeof(aCol[0]) * (size_t)nterm * nstate);
+  aHash = (unsigned *)calloc(nterm, sizeof(aHash[0]));
+  aOwn = (char *)calloc(nterm, sizeof(aOwn[0]));
+  MemoryCheck(aCol);
+  MemoryCheck(aHash);
+  MemoryCheck(aOwn);
+  for (i = 0; i < nterm * nstate; i++)
+    aCol[i] = -1;
+  for (i = 0; i < nstate; i++) {
+    for (ap = lemp->sorted[i]->actions; ap < lemp->sorted[i]->actions + lemp->sorted[i]->nAction; ap++) {
+      int *pAct;
+      if (ap->sp->index >= nterm)
+        continue;
+      pAct = &aCol[ap->sp->index * nstate + i];
+      if (*pAct < 0)
+        *pAct = lemp->glr ? compute_glr_action(lemp, glr, lemp->sorted[i], ap) : compute_action(lemp, ap);
+    }
   }
-  if (access(buf, 004) == 0) {
-    tpltname = buf;
-  } else if (access(templatename, 004) == 0) {
-    tpltname = templatename;
-  } else {
-    tpltname = pathsearch(lemp->argv0, templatename, 0);
+  for (i = 0; i < nterm; i++) {
+    for (j = 0; j < nstate; j++)
+      aHash[i] = aHash[i] * 31 + (unsigned)aCol[i * nstate + j];
   }
-  if (tpltname == 0) {
-    lprintf(LERROR, "Can't find the parser driver template file \"%s\".", templatename);
-    lemp->errorcnt++;
-    return 0;
+  aOwn[0] = 1;
+  if (lemp->wildcard)
+    aOwn[lemp->wildcard->index] = 1;
+  for (i = 0; i < nterm; i++) {
+    struct symbol *sp = lemp->symbols[i];
+    if (sp->fallback) {
+      aOwn[i] = 1;
+      aOwn[sp->fallback->index] = 1;
+    }
+  }
+
+  n = 0;
+  for (i = 0; i < nterm; i++) {
+    aClass[i] = i;
+    if (aOwn[i])
+      continue;
+    for (j = 1; j < i; j++) {
+      if (aOwn[j] || aClass[j] != j || aHash[j] != aHash[i])
+        continue;
+      if (memcmp(&aCol[j * nstate], &aCol[i * nstate], sizeof(aCol[0]) * nstate) == 0) {
+        aClass[i] = j;
+        n++;
+        break;
+      }
+    }
   }
-  in = fopen(tpltname, "rb");
-  if (in == 0) {
-    lprintf(LERROR, "Can't open the template file \"%s\".", templatename);
+  free(aCol);
+  free(aHash);
+  free(aOwn);
+  return n;
+}
+
+/* The next cluster of routines are for writing the template and the
+ * code of the grammar to the generated parser.
+ *
+ * The first function returns the template named with -T, or else the
+ * compiled-in one.
+ */
+static struct template *
+tplt_open(struct lemon *lemp) {
+  struct template *tp;
+
+  if (user_templatename == 0)
+    return template_default(lemp->glr);
+  tp = template_read(user_templatename);
+  if (tp == 0) {
+    lprintf(LERROR, "Can't open the template file \"%s\".", user_templatename);
     lemp->errorcnt++;
-    return 0;
   }
-  return in;
+  return tp;
 }
 
 /* Print a #line directive line to the output file. */
 static void
-tplt_linedir(FILE *out, int lineno, char *filename) {
-  fprintf(out, "#line %d \"", lineno);
+tplt_linedir(struct output *out, int lineno, char *filename) {
+  output_printf(out, "#line %d \"", lineno);
   while (*filename) {
     if (*filename == '\\')
-      putc('\\', out);
-    putc(*filename, out);
+      output_putc(out, '\\');
+    output_putc(out, *filename);
     filename++;
   }
-  fprintf(out, "\"\n");
+  output_printf(out, "\"\n");
 }
 
-/* Print a string to the file and keep the linenumber up to date */
+/* Print a string to the file and point #line back at the file */
 static void
-tplt_print(FILE *out, struct lemon *lemp, char *str, int *lineno) {
+tplt_print(struct output *out, struct lemon *lemp, char *str) {
   if (str == 0)
     return;
   while (*str) {
-    putc(*str, out);
-    if (*str == '\n')
-      (*lineno)++;
+    output_putc(out, *str);
     str++;
   }
-  if (str[-1] != '\n') {
-    putc('\n', out);
-    (*lineno)++;
-  }
-  (*lineno)++;
-  tplt_linedir(out, *lineno, lemp->outname);
+  if (str[-1] != '\n')
+    output_putc(out, '\n');
+  tplt_linedir(out, output_lineno(out) + 1, lemp->outname);
   return;
 }
 
+/* Write the member of YYMINORTYPE that holds the value of symbol sp,
+ * after the separator zSep from the union.  A boxed value is reached
+ * through the pointer to its box.
+ */
+static void
+write_member(struct output *text, struct lemon *lemp, struct symbol *sp, const char *zSep) {
+  output_puts(text, zSep);
+  if (sp->boxed)
+    output_puts(text, "yybox->");
+  output_puts(text, "yy");
+  output_int(text, sp->dtnum, 0);
+  if (lemp->cplusplus)
+    output_puts(text, "()");
+}
+
 /* The following routine emits code for the destructor for the
  * symbol sp
  */
 void
-emit_destructor_code(FILE *out, struct symbol *sp, struct lemon *lemp, int *lineno) {
+emit_destructor_code(struct output *out, struct symbol *sp, struct lemon *lemp) {
   char *cp = 0;
 
   if (sp->type == TERMINAL) {
     cp = lemp->tokendest;
     if (cp == 0)
       return;
-    fprintf(out, "{\n");
-    (*lineno)++;
+    output_printf(out, "{\n");
   } else if (sp->destructor) {
     cp = sp->destructor;
-    fprintf(out, "{\n");
-    (*lineno)++;
-    (*lineno)++;
+    output_printf(out, "{\n");
     tplt_linedir(out, sp->destLineno, lemp->filename);
   } else if (lemp->vardest) {
     cp = lemp->vardest;
     if (cp == 0)
       return;
-    fprintf(out, "{\n");
-    (*lineno)++;
+    output_printf(out, "{\n");
   } else {
     assert(0); // Cannot happen
   }
   for (; *cp; cp++) {
     if (*cp == '$' && cp[1] == '$') {
-      fprintf(out, "(yypminor->yy%d)", sp->dtnum);
+      output_puts(out, "(yypminor");
+      write_member(out, lemp, sp, "->");
+      output_putc(out, ')');
       cp++;
       continue;
     }
-    if (*cp == '\n')
-      (*lineno)++;
-    fputc(*cp, out);
+    output_putc(out, *cp);
   }
-  fprintf(out, "\n");
-  (*lineno)++;
-  (*lineno)++;
-  tplt_linedir(out, *lineno, lemp->outname);
-  fprintf(out, "}\n");
-  (*lineno)++;
+  output_printf(out, "\n");
+  tplt_linedir(out, output_lineno(out) + 1, lemp->outname);
+  output_printf(out, "}\n");
   return;
 }
 
@@ -512,122 +793,169 @@ has_destructor(struct symbol *sp, struct lemon *lemp) {
   return ret;
 }
 
-/* Append text to a dynamically allocated string.  If zText is 0 then
- * reset the string to be empty again.  Always return the complete text
- * of the string (which is overwritten with each call).
- *
- * n bytes of zText are stored.  If n==0 then all of zText up to the first
- * \000 terminator is stored.  zText can contain up to two instances of
- * %d.  The values of p1 and p2 are written into the first and second
- * %d.
- *
- * If n==-1, then the previous character is overwritten.
+/* The labels of a rule, in an open-addressed hash table for the lookup
+ * of every identifier of its code.  A slot holds the index of the RHS
+ * symbol with that label, nrhs for the label of the LHS, or -1 if empty.
  */
-static char *
-append_str(const char *zText, int n, int p1, int p2) {
-  static char empty[1] = {0};
-  static char *z = 0;
-  static size_t alloced = 0;
-  static int used = 0;
-  int c;
-  char zInt[40];
-  if (zText == 0) {
-    used = 0;
-    return z;
-  }
-  if (n <= 0) {
-    if (n < 0) {
-      used += n;
-      assert(used >= 0);
-    }
-    n = (int)strlen(zText);
-  }
-  if ((int)(n + sizeof(zInt) * 2 + used) >= alloced) {
-    alloced = n + sizeof(zInt) * 2 + used + 200;
-    z = (char *)realloc(z, alloced);
-  }
-  if (z == 0)
-    return empty;
-  while (n-- > 0) {
-    c = *(zText++);
-    if (c == '%' && n > 0 && zText[0] == 'd') {
-      sprintf(zInt, "%d", p1);
-      p1 = p2;
-      strcpy(&z[used], zInt);
-      used += strlen(&z[used]);
-      zText++;
-      n--;
-    } else {
-      z[used++] = (char)c;
+#define ALIAS_SLOTS 2048 // A power of two, over twice MAXRHS+1
+
+/* Hash n characters of an identifier */
+static unsigned int
+alias_hash(const char *z, size_t n) {
+  unsigned int h = 0;
+  while (n-- > 0)
+    h = (h << 3) ^ h ^ (unsigned char)*(z++);
+  return h;
+}
+
+/* Return the label of slot value i of the table of rule rp */
+static const char *
+alias_label(struct rule *rp, int i) {
+  return i == rp->nrhs ? rp->lhsalias : rp->rhsalias[i];
+}
+
+/* Return the slot of aSlot[] that holds the label z[0..n-1], or else
+ * the empty slot where it belongs
+ */
+static int
+alias_slot(struct rule *rp, int *aSlot, int mask, const char *z, size_t n) {
+  int h = (int)(alias_hash(z, n) & (unsigned int)mask);
+  while (aSlot[h] >= 0) {
+    const char *zLabel = alias_label(rp, aSlot[h]);
+    if (strncmp(zLabel, z, n) == 0 && zLabel[n] == 0)
+      break;
+    h = (h + 1) & mask;
+  }
+  return h;
+}
+
+/* Fill aSlot[] with the labels of rule rp and return the mask of the
+ * table.  A label given twice keeps its first symbol, the LHS before
+ * any on the RHS.
+ */
+static int
+alias_init(struct rule *rp, int *aSlot) {
+  int mask, i, h;
+  for (mask = 3; mask < 2 * (rp->nrhs + 1); mask = mask * 2 + 1)
+    ;
+  for (i = 0; i <= mask; i++)
+    aSlot[i] = -1;
+  for (i = -1; i < rp->nrhs; i++) {
+    int k = i < 0 ? rp->nrhs : i; // The LHS goes in first
+    const char *zLabel = alias_label(rp, k);
+    if (zLabel) {
+      h = alias_slot(rp, aSlot, mask, zLabel, strlen(zLabel));
+      if (aSlot[h] < 0)
+        aSlot[h] = k;
     }
   }
-  z[used] = 0;
-  return z;
+  return mask;
+}
+
+/* Return the data type of the values of a nonterminal, or NULL for the
+ * token type
+ */
+static const char *
+nonterminal_type(struct lemon *lemp, struct symbol *sp) {
+  return sp->datatype ? sp->datatype : lemp->vartype;
+}
+
+/* Return true if the rule only renames one nonterminal as another: a
+ * rule without code whose right-hand side is a single nonterminal of
+ * the data type of its left-hand side, neither of them with a
+ * destructor.  Reducing by it passes the value on unchanged.
+ */
+static int
+is_unit_rule(struct lemon *lemp, struct rule *rp) {
+  const char *zLhs, *zRhs;
+  if (rp->code || rp->nrhs != 1)
+    return 0;
+  if (rp->rhs[0]->type != NONTERMINAL || rp->rhs[0] == lemp->errsym || rp->rhs[0] == rp->lhs)
+    return 0;
+  if (has_destructor(rp->lhs, lemp) || has_destructor(rp->rhs[0], lemp))
+    return 0;
+  zLhs = nonterminal_type(lemp, rp->lhs);
+  zRhs = nonterminal_type(lemp, rp->rhs[0]);
+  return zLhs == zRhs || (zLhs && zRhs && strcmp(zLhs, zRhs) == 0);
 }
 
 /* zCode is a string that is the action associated with a rule.  Expand
  * the symbols in this string so that the refer to elements of the parser
- * stack.
+ * stack.  The text is built up in the buffer "text", which the caller
+ * keeps from one rule to the next.
  */
 static void
-translate_code(struct lemon *lemp, struct rule *rp) {
-  char *cp, *xp;
-  int i;
+translate_code(struct lemon *lemp, struct rule *rp, struct output *text) {
+  const char *cp, *xp, *zStart;
+  int i, mask;
   char lhsused = 0;  // True if the LHS element has been used
   char used[MAXRHS]; // True for each RHS element which is used
+  int aSlot[ALIAS_SLOTS];
 
   for (i = 0; i < rp->nrhs; i++)
     used[i] = 0;
   lhsused = 0;
 
-  if (rp->code == 0) {
+  if (rp->code == 0 && is_unit_rule(lemp, rp)) {
+    /* A unit rule passes the value of its right-hand side on */
+    output_reset(text);
+    write_member(text, lemp, rp->lhs, " yygotominor.");
+    output_puts(text, lemp->cplusplus ? " = std::move(" : " = ");
+    write_member(text, lemp, rp->rhs[0], "yymsp[0].minor.");
+    output_puts(text, lemp->cplusplus ? "); " : "; ");
+    output_putc(text, 0);
+    rp->code = make_string(lemp, text->z);
+    rp->line = rp->ruleline;
+  } else if (rp->code == 0) {
     static char newlinestr[2] = {'\n', '\0'};
     rp->code = newlinestr;
     rp->line = rp->ruleline;
   }
 
-  append_str(0, 0, 0, 0);
-
-  /* This const cast is wrong but harmless, if we're careful. */
-  for (cp = (char *)rp->code; *cp; cp++) {
-    if (isalpha(*cp) && (cp == rp->code || (!isalnum(cp[-1]) && cp[-1] != '_'))) {
-      char saved;
-      for (xp = &cp[1]; isalnum(*xp) || *xp == '_'; xp++)
-        ;
-      saved = *xp;
-      *xp = 0;
-      if (rp->lhsalias && strcmp(cp, rp->lhsalias) == 0) {
-        append_str("yygotominor.yy%d", 0, rp->lhs->dtnum, 0);
-        cp = xp;
-        lhsused = 1;
-      } else {
-        for (i = 0; i < rp->nrhs; i++) {
-          if (rp->rhsalias[i] && strcmp(cp, rp->rhsalias[i]) == 0) {
-            if (cp != rp->code && cp[-1] == '@') {
-              /* If the argument is of the form @X then substituted
-               * the token number of X, not the value of X
-               */
-              append_str("yymsp[%d].major", -1, i - rp->nrhs + 1, 0);
-            } else {
-              struct symbol *sp = rp->rhs[i];
-              int dtnum;
-              if (sp->type == MULTITERMINAL) {
-                dtnum = sp->subsym[0]->dtnum;
-              } else {
-                dtnum = sp->dtnum;
-              }
-              append_str("yymsp[%d].minor.yy%d", 0, i - rp->nrhs + 1, dtnum);
-            }
-            cp = xp;
-            used[i] = 1;
-            break;
-          }
-        }
-      }
-      *xp = saved;
+  /* Copy the code, a run of text at a time, up to each identifier that
+   * is the label of a symbol of the rule
+   */
+  output_reset(text);
+  mask = alias_init(rp, aSlot);
+  zStart = rp->code;
+  for (cp = rp->code; *cp;) {
+    if (!isalpha((unsigned char)*cp) || (cp != rp->code && (isalnum((unsigned char)cp[-1]) || cp[-1] == '_'))) {
+      cp++;
+      continue;
+    }
+    for (xp = &cp[1]; isalnum((unsigned char)*xp) || *xp == '_'; xp++)
+      ;
+    i = aSlot[alias_slot(rp, aSlot, mask, cp, (size_t)(xp - cp))];
+    if (i < 0) {
+      cp = xp;
+      continue;
+    }
+    if (i == rp->nrhs) {
+      output_write(text, zStart, (size_t)(cp - zStart));
+      output_puts(text, "yygotominor");
+      write_member(text, lemp, rp->lhs, ".");
+      lhsused = 1;
+    } else if (cp != rp->code && cp[-1] == '@') {
+      /* If the argument is of the form @X then substituted
+       * the token number of X, not the value of X
+       */
+      output_write(text, zStart, (size_t)(cp - 1 - zStart));
+      output_puts(text, "yymsp[");
+      output_int(text, i - rp->nrhs + 1, 0);
+      output_puts(text, "].major");
+      used[i] = 1;
+    } else {
+      struct symbol *sp = rp->rhs[i];
+      output_write(text, zStart, (size_t)(cp - zStart));
+      output_puts(text, "yymsp[");
+      output_int(text, i - rp->nrhs + 1, 0);
+      output_puts(text, "].minor");
+      write_member(text, lemp, sp->type == MULTITERMINAL ? sp->subsym[0] : sp, ".");
+      used[i] = 1;
     }
-    append_str(cp, 1, 0, 0);
+    cp = zStart = xp;
   }
+  output_write(text, zStart, (size_t)(cp - zStart));
 
   /* Check to make sure the LHS has been used */
   if (rp->lhsalias && !lhsused) {
@@ -644,38 +972,52 @@ translate_code(struct lemon *lemp, struct rule *rp) {
                rp->rhs[i]->name, rp->rhsalias[i]);
     } else if (rp->rhsalias[i] == 0) {
       if (has_destructor(rp->rhs[i], lemp)) {
-        append_str("  yy_destructor(yypParser,%d,&yymsp[%d].minor);\n", 0, rp->rhs[i]->index, i - rp->nrhs + 1);
+        output_puts(text, lemp->cplusplus ? "  yy_destructor(" : "  yy_destructor(yypParser,");
+        output_int(text, rp->rhs[i]->index, 0);
+        output_puts(text, ",&yymsp[");
+        output_int(text, i - rp->nrhs + 1, 0);
+        output_puts(text, "].minor);\n");
       } else {
         /* No destructor defined for this term */
       }
     }
   }
-  if (rp->code) {
-    cp = append_str(0, 0, 0, 0);
-    rp->code = make_string(cp ? cp : "");
+
+  /* A boxed LHS is built in the box above the top of the stack.  Move
+   * it down to the box of the stack entry it is about to take.
+   */
+  if (rp->lhs->boxed && rp->nrhs > 0) {
+    output_puts(text, "  yyBoxAt(yypParser, yypParser->yyidx");
+    if (rp->nrhs > 1) {
+      output_puts(text, " - ");
+      output_int(text, rp->nrhs - 1, 0);
+    }
+    output_puts(text, ")->yy");
+    output_int(text, rp->lhs->dtnum, 0);
+    output_puts(text, " = yygotominor.yybox->yy");
+    output_int(text, rp->lhs->dtnum, 0);
+    output_puts(text, ";\n  yygotominor.yybox = yyBoxAt(yypParser, yypParser->yyidx");
+    if (rp->nrhs > 1) {
+      output_puts(text, " - ");
+      output_int(text, rp->nrhs - 1, 0);
+    }
+    output_puts(text, ");\n");
   }
+  output_putc(text, 0);
+  rp->code = make_string(lemp, text->z);
 }
 
 /* Generate code which executes when the rule "rp" is reduced.  Write
- * the code to "out".  Make sure lineno stays up-to-date.
+ * the code to "out".
  */
 static void
-emit_code(FILE *out, struct rule *rp, struct lemon *lemp, int *lineno) {
-  const char *cp;
-
+emit_code(struct output *out, struct rule *rp, struct lemon *lemp) {
   /* Generate code to do the reduce action */
   if (rp->code) {
-    (*lineno)++;
     tplt_linedir(out, rp->line, lemp->filename);
-    fprintf(out, "{%s", rp->code);
-    for (cp = rp->code; *cp; cp++) {
-      if (*cp == '\n')
-        (*lineno)++;
-    }
-    fprintf(out, "}\n");
-    (*lineno)++;
-    (*lineno)++;
-    tplt_linedir(out, *lineno, lemp->outname);
+    output_printf(out, "{%s", rp->code);
+    output_printf(out, "}\n");
+    tplt_linedir(out, output_lineno(out) + 1, lemp->outname);
   }
 
   return;
@@ -688,19 +1030,19 @@ emit_code(FILE *out, struct rule *rp, struct lemon *lemp, int *lineno) {
  * symbol.
  */
 void
-print_stack_union(FILE *out,          // The output stream
-                  struct lemon *lemp, // The main info structure for this parser
-                  int *plineno,       // Pointer to the line number
-                  int mhflag          // True if generating makeheaders output
+print_stack_union(struct output *out, // The output buffer
+                  struct lemon *lemp,  // The main info structure for this parser
+                  int mhflag           // True if generating makeheaders output
                   ) {
-  int lineno = *plineno; // The line number of the output
-  char **types;          // A hash table of datatypes
-  size_t arraysize;      // Size of the "types" array
-  size_t maxdtlength;    // Maximum length of any ".datatype" field.
-  char *stddt;           // Standardized name for a datatype
-  int i, j;              // Loop counters
-  unsigned hash;         // For hashing the name of a type
-  const char *name;      // Name of the parser
+  char **types;       // A hash table of datatypes
+  size_t arraysize;   // Size of the "types" array
+  size_t maxdtlength; // Maximum length of any ".datatype" field.
+  char *stddt;        // Standardized name for a datatype
+  int i, j;           // Loop counters
+  unsigned hash;      // For hashing the name of a type
+  const char *name;   // Name of the parser
+  char *boxed;        // True for each type of types[] that is boxed
+  int nboxed;         // Number of boxed types
 
   /* Allocate and initialize types[] and allocate stddt[] */
   arraysize = (size_t)(lemp->nsymbol * 2);
@@ -778,41 +1120,101 @@ print_stack_union(FILE *out,          // The output stream
     }
   }
 
+  /* A type given to a %boxed symbol is boxed for every symbol that has
+   * it, as they all share one member of the union
+   */
+  boxed = (char *)calloc(arraysize, sizeof(char));
+  MemoryCheck(boxed);
+  nboxed = 0;
+  for (i = 0; i < lemp->nsymbol; i++) {
+    struct symbol *sp = lemp->symbols[i];
+    if (!sp->boxed)
+      continue;
+    if (sp->dtnum <= 0 || sp->dtnum > arraysize) {
+      lprintf(LWARN, "%s: the value of \"%s\" is not boxed, as it has no %%type of its own.", lemp->filename,
+              sp->name);
+      sp->boxed = false;
+    } else if (!boxed[sp->dtnum - 1]) {
+      boxed[sp->dtnum - 1] = 1;
+      nboxed++;
+    }
+  }
+  for (i = 0; i < lemp->nsymbol; i++) {
+    struct symbol *sp = lemp->symbols[i];
+    if (sp->type == NONTERMINAL && sp->dtnum > 0 && sp->dtnum <= arraysize)
+      sp->boxed = boxed[sp->dtnum - 1] != 0;
+  }
+
   /* Print out the definition of YYTOKENTYPE and YYMINORTYPE */
   name = lemp->name ? lemp->name : "Parse";
-  lineno = *plineno;
   if (mhflag) {
-    fprintf(out, "#if INTERFACE\n");
-    lineno++;
+    output_printf(out, "#if INTERFACE\n");
   }
-  fprintf(out, "#define %sTOKENTYPE %s\n", name, lemp->tokentype ? lemp->tokentype : "void*");
-  lineno++;
+  output_printf(out, "#define %sTOKENTYPE %s\n", name, lemp->tokentype ? lemp->tokentype : "void*");
   if (mhflag) {
-    fprintf(out, "#endif\n");
-    lineno++;
-  }
-  fprintf(out, "typedef union {\n");
-  lineno++;
-  fprintf(out, "  int yyinit;\n");
-  lineno++;
-  fprintf(out, "  %sTOKENTYPE yy0;\n", name);
-  lineno++;
+    output_printf(out, "#endif\n");
+  }
+  if (lemp->cplusplus) {
+    /* The C++ template builds a tagged YYMINORTYPE out of this list of
+     * member numbers and types, once the %include code has declared them.
+     */
+    output_printf(out, "#define YYMINORTYPES(X) X(0, %sTOKENTYPE)", name);
+    for (i = 0; i < arraysize; i++) {
+      if (types[i] == 0)
+        continue;
+      output_printf(out, " X(%d, %s)", i + 1, types[i]);
+      free(types[i]);
+    }
+    if (lemp->errsym->useCnt) {
+      output_printf(out, " X(%d, int)", lemp->errsym->dtnum);
+    }
+    output_printf(out, "\n");
+    free(stddt);
+    free(types);
+    free(boxed);
+    return;
+  }
+
+  /* A boxed type is left out of the union, which holds a pointer to
+   * its box instead.  The boxes are declared by the template, after the
+   * %include code, from the list in YYBOXTYPES.
+   */
+  output_printf(out, "typedef union {\n");
+  output_printf(out, "  int yyinit;\n");
+  output_printf(out, "  %sTOKENTYPE yy0;\n", name);
   for (i = 0; i < arraysize; i++) {
-    if (types[i] == 0)
-      continue;
-    fprintf(out, "  %s yy%d;\n", types[i], i + 1);
-    lineno++;
-    free(types[i]);
+    if (types[i] && !boxed[i])
+      output_printf(out, "  %s yy%d;\n", types[i], i + 1);
+  }
+  if (lemp->errsym->useCnt) {
+    output_printf(out, "  int yy%d;\n", lemp->errsym->dtnum);
+  }
+  if (nboxed > 0) {
+    output_printf(out, "  union yyBox *yybox;\n");
+  }
+  output_printf(out, "} YYMINORTYPE;\n");
+  output_printf(out, "#define YYMINORTYPES(X) X(0, %sTOKENTYPE)", name);
+  for (i = 0; i < arraysize; i++) {
+    if (types[i] && !boxed[i])
+      output_printf(out, " X(%d, %s)", i + 1, types[i]);
   }
   if (lemp->errsym->useCnt) {
-    fprintf(out, "  int yy%d;\n", lemp->errsym->dtnum);
-    lineno++;
+    output_printf(out, " X(%d, int)", lemp->errsym->dtnum);
+  }
+  output_printf(out, "\n");
+  if (nboxed > 0) {
+    output_printf(out, "#define YYBOXTYPES(X)");
+    for (i = 0; i < arraysize; i++) {
+      if (types[i] && boxed[i])
+        output_printf(out, " X(%d, %s)", i + 1, types[i]);
+    }
+    output_printf(out, "\n");
   }
+  for (i = 0; i < arraysize; i++)
+    free(types[i]);
   free(stddt);
   free(types);
-  fprintf(out, "} YYMINORTYPE;\n");
-  lineno++;
-  *plineno = lineno;
+  free(boxed);
 }
 
 /* Return the name of a C datatype able to represent values between
@@ -843,10 +1245,14 @@ minimum_size_type(int lwr, int upr) {
  * to order the creation of entries in the yy_action[] table.
  */
 struct axset {
-  struct state *stp; // A pointer to a state
-  int isTkn;         // True to use tokens.  False for non-terminals
-  int nAction;       // Number of actions
-  int iOrder;        // Original order of action sets
+  struct state *stp;               // A pointer to a state
+  int isTkn;                       // True to use tokens.  False for non-terminals
+  int nAction;                     // Number of actions
+  int iOrder;                      // Original order of action sets
+  struct lookahead_action *aEntry; // Its entries of the yy_action table
+  int nEntry;                      // Number of entries in aEntry[]
+  int nSpan;                       // From the smallest lookahead to the largest
+  int iOfst;                       // Offset in the table being packed
 };
 
 /* Compare to axset structures for sorting purposes */
@@ -863,34 +1269,500 @@ axset_compare(const void *a, const void *b) {
   return c;
 }
 
-/* Write text on "out" that describes the rule "rp". */
-static void
-writeRuleText(FILE *out, struct rule *rp) {
-  int j;
-  fprintf(out, "%s ::=", rp->lhs->name);
-  for (j = 0; j < rp->nrhs; j++) {
-    struct symbol *sp = rp->rhs[j];
-    if (sp->type != MULTITERMINAL) {
-      fprintf(out, " %s", sp->name);
-    } else {
-      int k;
-      fprintf(out, " %s", sp->subsym[0]->name);
-      for (k = 1; k < sp->nsubsym; k++) {
-        fprintf(out, "|%s", sp->subsym[k]->name);
-      }
-    }
-  }
-}
+/* Milliseconds on a clock that only goes forward.  Where there is no
+ * POSIX monotonic clock, the processor time of the program is used.
+ */
+static long long
+clock_msec(void) {
+#if !defined(__WIN32__) && defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#else
+  return (long long)clock() * 1000 / CLOCKS_PER_SEC;
+#endif
+}
+
+/* Pack the action sets ax[aOrder[0]], ax[aOrder[1]], ... into a new
+ * action table and leave the offset of each in its iOfst.  Give up and
+ * return NULL once the table reaches nLimit entries or the clock passes
+ * the deadline, if there is one.
+ */
+static struct acttab *
+pack_axsets(struct axset *ax, const int *aOrder, int n, int nLimit, long long deadline) {
+  struct acttab *pActtab = acttab_alloc();
+  int i, j;
+  for (i = 0; i < n; i++) {
+    struct axset *p = &ax[aOrder[i]];
+    for (j = 0; j < p->nEntry; j++)
+      acttab_action(pActtab, p->aEntry[j].lookahead, p->aEntry[j].action);
+    p->iOfst = acttab_insert(pActtab);
+    if (acttab_size(pActtab) >= nLimit || (deadline && (i & 15) == 0 && clock_msec() > deadline)) {
+      acttab_free(pActtab);
+      return 0;
+    }
+  }
+  return pActtab;
+}
+
+/* Orders of the action sets tried by search_axsets(), other than the
+ * greedy one it starts from
+ */
+struct axorder {
+  int key1, key2; // Sort keys, the larger first
+  int i;          // Index of the action set
+};
+
+static int
+axorder_compare(const void *a, const void *b) {
+  const struct axorder *p1 = (const struct axorder *)a;
+  const struct axorder *p2 = (const struct axorder *)b;
+  if (p1->key1 != p2->key1)
+    return p2->key1 - p1->key1;
+  if (p1->key2 != p2->key2)
+    return p2->key2 - p1->key2;
+  return p1->i - p2->i;
+}
+
+/* Pack the n action sets of ax[], which come sorted for the greedy
+ * packing, into the smallest action table found within msec
+ * milliseconds.  The greedy order is packed first, so the result is
+ * never larger than it.  Then come the sets by decreasing span, by
+ * count and then span, and after that random swaps of the best order
+ * so far.  Every order is packed first fit, and a trial stops as soon
+ * as it can no longer beat the best table.
+ */
+static struct acttab *
+search_axsets(struct axset *ax, int n, int msec) {
+  struct acttab *pBest, *pActtab;
+  struct axorder *aSort;
+  int *aOrder, *aBestOrder, *aBestOfst;
+  long long deadline;
+  unsigned int rnd = 0x9e3779b9;
+  int i, j, k, iTrial;
+
+  aOrder = (int *)malloc(sizeof(int) * (n + 1) * 3);
+  MemoryCheck(aOrder);
+  aBestOrder = &aOrder[n + 1];
+  aBestOfst = &aBestOrder[n + 1];
+  for (i = 0; i < n; i++)
+    aBestOrder[i] = i;
+  pBest = pack_axsets(ax, aBestOrder, n, 0x7fffffff, 0);
+  for (i = 0; i < n; i++)
+    aBestOfst[i] = ax[i].iOfst;
+  if (msec <= 0 || n < 2) {
+    free(aOrder);
+    return pBest;
+  }
+
+  aSort = (struct axorder *)malloc(sizeof(aSort[0]) * n);
+  MemoryCheck(aSort);
+  deadline = clock_msec() + msec;
+  for (iTrial = 1; clock_msec() < deadline; iTrial++) {
+    if (iTrial <= 2) {
+      for (i = 0; i < n; i++) {
+        aSort[i].key1 = iTrial == 1 ? ax[i].nSpan : ax[i].nEntry;
+        aSort[i].key2 = iTrial == 1 ? ax[i].nEntry : ax[i].nSpan;
+        aSort[i].i = i;
+      }
+      qsort(aSort, n, sizeof(aSort[0]), axorder_compare);
+      for (i = 0; i < n; i++)
+        aOrder[i] = aSort[i].i;
+    } else {
+      memcpy(aOrder, aBestOrder, sizeof(int) * n);
+      for (k = 1 + (iTrial & 3); k > 0; k--) {
+        rnd ^= rnd << 13;
+        rnd ^= rnd >> 17;
+        rnd ^= rnd << 5;
+        i = (int)(rnd % (unsigned)n);
+        j = aOrder[(rnd >> 16) % (unsigned)n];
+        aOrder[(rnd >> 16) % (unsigned)n] = aOrder[i];
+        aOrder[i] = j;
+      }
+    }
+    /* Ties are taken too in the random stage, to wander over plateaus */
+    pActtab = pack_axsets(ax, aOrder, n, acttab_size(pBest) + (iTrial > 2), deadline);
+    if (pActtab) {
+      acttab_free(pBest);
+      pBest = pActtab;
+      memcpy(aBestOrder, aOrder, sizeof(int) * n);
+      for (i = 0; i < n; i++)
+        aBestOfst[i] = ax[i].iOfst;
+    }
+  }
+  for (i = 0; i < n; i++)
+    ax[i].iOfst = aBestOfst[i];
+  free(aSort);
+  free(aOrder);
+  return pBest;
+}
+
+/* Write text on "out" that describes the rule "rp". */
+static void
+writeRuleText(struct output *out, struct rule *rp) {
+  int j;
+  output_printf(out, "%s ::=", rp->lhs->name);
+  for (j = 0; j < rp->nrhs; j++) {
+    struct symbol *sp = rp->rhs[j];
+    if (sp->type != MULTITERMINAL) {
+      output_printf(out, " %s", sp->name);
+    } else {
+      int k;
+      output_printf(out, " %s", sp->subsym[0]->name);
+      for (k = 1; k < sp->nsubsym; k++) {
+        output_printf(out, "|%s", sp->subsym[k]->name);
+      }
+    }
+  }
+}
+
+/* The bitmap of the terminals a state expects, while finding the
+ * states that share one
+ */
+struct expected_row {
+  const unsigned int *aWord; // Bit t%32 of aWord[t/32] is set for terminal t
+  int nWord;                 // Number of words in aWord[]
+  int iState;                // Number of the state
+};
+
+static int
+expected_row_compare(const void *a, const void *b) {
+  const struct expected_row *p1 = (const struct expected_row *)a;
+  const struct expected_row *p2 = (const struct expected_row *)b;
+  int c = memcmp(p1->aWord, p2->aWord, sizeof(p1->aWord[0]) * p1->nWord);
+  if (c == 0)
+    c = p1->iState - p2->iState;
+  return c;
+}
+
+/* Find the terminals each state expects, for ParseExpectedTokens(): the
+ * terminals it has an action on, counting those of the reduce actions
+ * that became its default, and those it takes through a fallback or the
+ * wildcard.  States with the same terminals share a bitmap of nWord
+ * words.  Return the distinct bitmaps, in the order of the first state
+ * with each, the number of them in *pnBitmap, and the bitmap of each
+ * state in aRow[].
+ */
+static unsigned int *
+expected_tokens(struct lemon *lemp, int nWord, int *aRow, int *pnBitmap) {
+  unsigned int *aAll, *aWord, *aBitmap;
+  struct expected_row *aOrder;
+  struct action *ap;
+  struct symbol *fp;
+  int i, j, t, n;
+
+#define EXPECTED(A, T) ((A)[(T) / 32] >> ((T) % 32) & 1)
+  aAll = (unsigned int *)calloc((size_t)lemp->nstate * nWord, sizeof(aAll[0]));
+  aOrder = (struct expected_row *)malloc(sizeof(aOrder[0]) * lemp->nstate);
+  MemoryCheck(aAll);
+  MemoryCheck(aOrder);
+  for (i = 0; i < lemp->nstate; i++) {
+    aWord = &aAll[(size_t)i * nWord];
+    for (ap = lemp->sorted[i]->actions; ap < lemp->sorted[i]->actions + lemp->sorted[i]->nAction; ap++) {
+      t = ap->sp->index;
+      if (t >= lemp->nterminal)
+        continue;
+      switch (ap->type) {
+      case SHIFT:
+      case ACCEPT:
+      case REDUCE:
+      case NOT_USED: // A reduce by the default rule
+      case SSCONFLICT:
+      case SRCONFLICT:
+      case RRCONFLICT:
+        aWord[t / 32] |= 1u << (t % 32);
+        break;
+      default:
+        break;
+      }
+    }
+    for (t = 1; t < lemp->nterminal; t++) {
+      if (EXPECTED(aWord, t))
+        continue;
+      for (fp = lemp->symbols[t]->fallback, n = 0; fp && n < lemp->nterminal; fp = fp->fallback, n++) {
+        if (EXPECTED(aWord, fp->index)) {
+          aWord[t / 32] |= 1u << (t % 32);
+          break;
+        }
+      }
+    }
+    if (lemp->wildcard && EXPECTED(aWord, lemp->wildcard->index)) {
+      for (t = 1; t < lemp->nterminal; t++)
+        aWord[t / 32] |= 1u << (t % 32);
+    }
+    aOrder[i].aWord = aWord;
+    aOrder[i].nWord = nWord;
+    aOrder[i].iState = i;
+  }
+#undef EXPECTED
+
+  /* Give the first state with each bitmap the next number, and the
+   * others the number of the first
+   */
+  qsort(aOrder, lemp->nstate, sizeof(aOrder[0]), expected_row_compare);
+  for (i = 0; i < lemp->nstate; i = j) {
+    for (j = i; j < lemp->nstate && memcmp(aOrder[i].aWord, aOrder[j].aWord, sizeof(aWord[0]) * nWord) == 0; j++)
+      aRow[aOrder[j].iState] = aOrder[i].iState;
+  }
+  aBitmap = (unsigned int *)malloc(sizeof(aBitmap[0]) * lemp->nstate * nWord);
+  MemoryCheck(aBitmap);
+  n = 0;
+  for (i = 0; i < lemp->nstate; i++) {
+    if (aRow[i] == i) {
+      memcpy(&aBitmap[(size_t)n * nWord], &aAll[(size_t)i * nWord], sizeof(aBitmap[0]) * nWord);
+      aRow[i] = n++;
+    } else {
+      aRow[i] = aRow[aRow[i]];
+    }
+  }
+  free(aOrder);
+  free(aAll);
+  *pnBitmap = n;
+  return aBitmap;
+}
+
+/* Write entry i of a table of n integers.  Entries go ten to a line,
+ * each line led by the index of its first entry.
+ */
+static void
+write_table_cell(struct output *out, int i, int n, int value) {
+  if (i % 10 == 0) {
+    output_puts(out, " /* ");
+    output_int(out, i, 5);
+    output_puts(out, " */ ");
+  }
+  output_putc(out, ' ');
+  output_int(out, value, 4);
+  output_putc(out, ',');
+  if (i % 10 == 9 || i == n - 1)
+    output_putc(out, '\n');
+}
+
+/* Words of the header of a table file, after its 8-byte magic.  The
+ * same layout is read by ParseLoadTables() in lempar.c.
+ */
+enum {
+  TBL_VERSION,        // Version of the layout, TBL_VERSION_NUMBER
+  TBL_BYTEORDER,      // 0x01020304, in the byte order of the file
+  TBL_SIGNATURE,      // table_signature() of the grammar
+  TBL_NOCODE,         // YYNOCODE
+  TBL_NRULE,          // YYNRULE
+  TBL_NSTATE,         // YYNSTATE
+  TBL_NACTION,        // Entries in yy_action[] and yy_lookahead[]
+  TBL_NSHIFT,         // Entries in yy_shift_ofst[]
+  TBL_NREDUCE,        // Entries in yy_reduce_ofst[]
+  TBL_SHIFT_DFLT,     // YY_SHIFT_USE_DFLT
+  TBL_REDUCE_DFLT,    // YY_REDUCE_USE_DFLT
+  TBL_MIN_AUTOREDUCE, // YY_MIN_AUTOREDUCE
+  TBL_NTOKEN,         // Entries in yy_token_class[]
+  TBL_NFALLBACK,      // Entries in yyFallback[]
+  TBL_NEXPECTED,      // Number of bitmaps in yy_expected[]
+  TBL_ACTION,         // Offset of yy_action[]
+  TBL_LOOKAHEAD,      // Offset of yy_lookahead[]
+  TBL_SHIFT_OFST,     // Offset of yy_shift_ofst[]
+  TBL_REDUCE_OFST,    // Offset of yy_reduce_ofst[]
+  TBL_DEFAULT,        // Offset of yy_default[]
+  TBL_GOTO_DEFAULT,   // Offset of yy_goto_default[]
+  TBL_EXPECTED,       // Offset of yy_expected[]
+  TBL_EXPECTED_ROW,   // Offset of yy_expected_row[]
+  TBL_TOKEN_CLASS,    // Offset of yy_token_class[]
+  TBL_FALLBACK,       // Offset of yyFallback[]
+  TBL_TOKEN_NAME,     // Offset of the offsets of the symbol names
+  TBL_SIZE,           // Size of the file in bytes, a multiple of 8
+  TBL_CHECKSUM,       // FNV-1a hash of all other words after the magic
+  TBL_NWORD
+};
+#define TBL_VERSION_NUMBER 4
+
+/* Return a hash of the symbols and rules of the grammar.  A parser
+ * loads only table files with its own signature, since the numbers of
+ * its symbols and rules are compiled into its code.  Precedences and
+ * everything else that changes no more than the tables are left out.
+ */
+static unsigned int
+table_signature(struct lemon *lemp) {
+  unsigned int h = 0x811c9dc5;
+  struct rule_list *rp;
+  const char *z;
+  int i;
+
+#define SIGNATURE_ADD(X) h = (h ^ (unsigned int)(X)) * 0x01000193
+  SIGNATURE_ADD(lemp->nsymbol);
+  SIGNATURE_ADD(lemp->nterminal);
+  for (i = 0; i < lemp->nsymbol; i++) {
+    for (z = lemp->symbols[i]->name; *z; z++)
+      SIGNATURE_ADD((unsigned char)*z);
+    SIGNATURE_ADD(0);
+  }
+  for (rp = lemp->rules; rp; rp = rp->next) {
+    SIGNATURE_ADD(rp->item->lhs->index);
+    SIGNATURE_ADD(rp->item->nrhs);
+    for (i = 0; i < rp->item->nrhs; i++)
+      SIGNATURE_ADD(rp->item->rhs[i]->index);
+  }
+  SIGNATURE_ADD(lemp->errsym->useCnt ? lemp->errsym->index : -1);
+  SIGNATURE_ADD(lemp->wildcard ? lemp->wildcard->index : -1);
+#undef SIGNATURE_ADD
+  return h;
+}
+
+/* Append a 32-bit word to a table file */
+static void
+tbl_word(struct output *out, int v) {
+  output_write(out, (const char *)&v, sizeof(v));
+}
+
+/* Pad a table file with zeros to a multiple of 8 bytes and return the
+ * offset of what comes next
+ */
+static unsigned int
+tbl_align(struct output *out) {
+  while (out->n % 8 != 0)
+    output_putc(out, 0);
+  return (unsigned int)out->n;
+}
+
+/* Write the parse tables to a binary file, named after the grammar
+ * with a ".tbl" suffix, for a parser generated with -b.
+ */
+static void
+write_table_file(struct lemon *lemp, struct acttab *pActtab, int mnTknOfst, int mnNtOfst, int *aClass,
+                 int *aGotoDflt) {
+  struct output tbl, *out;
+  unsigned int aHdr[TBL_NWORD];
+  struct state *stp;
+  char *name;
+  unsigned int *aBitmap;
+  int *aRow;
+  int i, n, mx, nBitmap, nWord;
+
+  out = &tbl;
+  output_init(out);
+  memset(aHdr, 0, sizeof(aHdr));
+  output_write(out, "LEMONTBL", 8);
+  output_write(out, (const char *)aHdr, sizeof(aHdr)); // Filled in at the end
+  aHdr[TBL_VERSION] = TBL_VERSION_NUMBER;
+  aHdr[TBL_BYTEORDER] = 0x01020304;
+  aHdr[TBL_SIGNATURE] = table_signature(lemp);
+  aHdr[TBL_NOCODE] = lemp->nsymbol + 1;
+  aHdr[TBL_NRULE] = lemp->nrule;
+  aHdr[TBL_NSTATE] = lemp->nstate;
+
+  /* The action table and its associates, as ReportTable() would write
+   * them into the parser.
+   */
+  n = acttab_size(pActtab);
+  aHdr[TBL_NACTION] = n;
+  aHdr[TBL_ACTION] = tbl_align(out);
+  for (i = 0; i < n; i++) {
+    int action = acttab_yyaction(pActtab, i);
+    tbl_word(out, action < 0 ? lemp->nstate + lemp->nrule + 2 : action);
+  }
+  aHdr[TBL_LOOKAHEAD] = tbl_align(out);
+  for (i = 0; i < n; i++) {
+    int la = acttab_yylookahead(pActtab, i);
+    tbl_word(out, la < 0 ? lemp->nsymbol : la);
+  }
+  n = lemp->nstate;
+  while (n > 0 && lemp->sorted[n - 1]->iTknOfst == NO_OFFSET)
+    n--;
+  aHdr[TBL_SHIFT_DFLT] = mnTknOfst - 1;
+  aHdr[TBL_NSHIFT] = n;
+  aHdr[TBL_SHIFT_OFST] = tbl_align(out);
+  for (i = 0; i < n; i++) {
+    stp = lemp->sorted[i];
+    tbl_word(out, stp->iTknOfst == NO_OFFSET ? mnTknOfst - 1 : stp->iTknOfst);
+  }
+  n = lemp->nstate;
+  while (n > 0 && lemp->sorted[n - 1]->iNtOfst == NO_OFFSET)
+    n--;
+  aHdr[TBL_REDUCE_DFLT] = mnNtOfst - 1;
+  aHdr[TBL_NREDUCE] = n;
+  aHdr[TBL_REDUCE_OFST] = tbl_align(out);
+  for (i = 0; i < n; i++) {
+    stp = lemp->sorted[i];
+    tbl_word(out, stp->iNtOfst == NO_OFFSET ? mnNtOfst - 1 : stp->iNtOfst);
+  }
+  aHdr[TBL_DEFAULT] = tbl_align(out);
+  for (i = 0; i < lemp->nstate; i++)
+    tbl_word(out, lemp->sorted[i]->iDflt);
+  aHdr[TBL_GOTO_DEFAULT] = tbl_align(out);
+  for (i = 0; i < lemp->nsymbol - lemp->nterminal; i++)
+    tbl_word(out, aGotoDflt[i]);
+  nWord = (lemp->nterminal + 31) / 32;
+  aRow = (int *)malloc(sizeof(aRow[0]) * lemp->nstate);
+  MemoryCheck(aRow);
+  aBitmap = expected_tokens(lemp, nWord, aRow, &nBitmap);
+  aHdr[TBL_NEXPECTED] = nBitmap;
+  aHdr[TBL_EXPECTED] = tbl_align(out);
+  for (i = 0; i < nBitmap * nWord; i++)
+    tbl_word(out, (int)aBitmap[i]);
+  aHdr[TBL_EXPECTED_ROW] = tbl_align(out);
+  for (i = 0; i < lemp->nstate; i++)
+    tbl_word(out, aRow[i]);
+  free(aBitmap);
+  free(aRow);
+  n = lemp->nstate;
+  while (n > 1 && lemp->sorted[n - 1]->autoReduce)
+    n--;
+  aHdr[TBL_MIN_AUTOREDUCE] = n;
+  aHdr[TBL_NTOKEN] = lemp->nterminal;
+  aHdr[TBL_TOKEN_CLASS] = tbl_align(out);
+  for (i = 0; i < lemp->nterminal; i++)
+    tbl_word(out, aClass[i]);
+
+  /* The fallback tokens and the names of the symbols */
+  mx = -1;
+  if (lemp->has_fallback) {
+    mx = lemp->nterminal - 1;
+    while (mx > 0 && lemp->symbols[mx]->fallback == 0)
+      mx--;
+  }
+  aHdr[TBL_NFALLBACK] = mx + 1;
+  aHdr[TBL_FALLBACK] = tbl_align(out);
+  for (i = 0; i <= mx; i++) {
+    struct symbol *p = lemp->symbols[i];
+    tbl_word(out, p->fallback ? p->fallback->index : 0);
+  }
+  aHdr[TBL_TOKEN_NAME] = tbl_align(out);
+  n = aHdr[TBL_TOKEN_NAME] + lemp->nsymbol * 4;
+  for (i = 0; i < lemp->nsymbol; i++) {
+    tbl_word(out, n);
+    n += strlen(lemp->symbols[i]->name) + 1;
+  }
+  for (i = 0; i < lemp->nsymbol; i++)
+    output_write(out, lemp->symbols[i]->name, strlen(lemp->symbols[i]->name) + 1);
+  aHdr[TBL_SIZE] = tbl_align(out);
+  memcpy(&out->z[8], aHdr, sizeof(aHdr)); // All but the checksum
+  aHdr[TBL_CHECKSUM] = 0x811c9dc5;
+  for (i = 8; i < (int)out->n; i += 4) {
+    unsigned int w;
+    if (i == 8 + TBL_CHECKSUM * 4)
+      continue;
+    memcpy(&w, &out->z[i], sizeof(w));
+    aHdr[TBL_CHECKSUM] = (aHdr[TBL_CHECKSUM] ^ w) * 0x01000193;
+  }
+  memcpy(&out->z[8], aHdr, sizeof(aHdr));
+
+  name = file_makename(lemp, ".tbl");
+  if (output_save(out, name)) {
+    lprintf(LERROR, "Can't write file \"%s\".", name);
+    lemp->errorcnt++;
+  }
+  free(name);
+}
 
 /* Generate C source code for the parser */
 void
 ReportTable(struct lemon *lemp, int mhflag // Output in makeheaders format if true
             ) {
-  FILE *out, *in;
+  struct template *tp;
+  int iSegment;
+  struct output buf, *out;
+  struct output code; // Space to translate the code of the rules
   char line[LINESIZE];
-  int lineno;
   struct state *stp;
-  struct action_list *ap;
+  struct action *ap;
   struct rule_list *rp;
   struct acttab *pActtab;
   int i, j, n;
@@ -898,62 +1770,85 @@ ReportTable(struct lemon *lemp, int mhflag // Output in makeheaders format if tr
   int mnTknOfst, mxTknOfst;
   int mnNtOfst, mxNtOfst;
   struct axset *ax;
-
-  in = tplt_open(lemp);
-  if (in == 0)
-    return;
-  out = file_open(lemp, ".c", "wb");
-  if (out == 0) {
-    fclose(in);
+  struct glrtab glr;
+  int *aClass; // The token class of every terminal
+  int nMerged; // Number of terminals sharing the column of another
+  int *aGotoDflt; // The default goto of every nonterminal
+  unsigned int *aBitmap; // The distinct bitmaps of expected tokens
+  int *aRow;             // The bitmap of each state
+  int nBitmap, nWord;    // Number of bitmaps, and of words in each
+  const char *tabledecl; // Storage of the tables, "static constexpr" in C++
+
+  tp = tplt_open(lemp);
+  if (tp == 0)
     return;
+  iSegment = 0;
+  file_setname(lemp, lemp->cplusplus ? ".hpp" : ".c");
+  out = &buf;
+  output_init(out);
+  tabledecl = lemp->cplusplus ? "static constexpr" : "static const";
+  template_xfer(out, tp, iSegment++, lemp->name);
+
+  /* Collect the conflict lists of a GLR parser up front, as the action
+   * codes that select them must fit in YYACTIONTYPE.
+   */
+  memset(&glr, 0, sizeof(glr));
+  if (lemp->glr) {
+    for (i = 0; i < lemp->nstate; i++) {
+      for (ap = lemp->sorted[i]->actions; ap < lemp->sorted[i]->actions + lemp->sorted[i]->nAction; ap++) {
+        if (ap->sp->index < lemp->nterminal)
+          (void)compute_glr_action(lemp, &glr, lemp->sorted[i], ap);
+      }
+    }
   }
-  lineno = 1;
-  tplt_xfer(lemp->name, in, out, &lineno);
+
+  /* Find the terminals that can share a column of the action table */
+  aClass = (int *)malloc(sizeof(aClass[0]) * lemp->nterminal);
+  MemoryCheck(aClass);
+  nMerged = compute_token_classes(lemp, &glr, aClass);
+
+  /* Find the gotos that the action table can leave out */
+  aGotoDflt = goto_defaults(lemp);
 
   /* Generate #defines for all tokens */
   if (mhflag) {
     const char *prefix;
-    fprintf(out, "#if INTERFACE\n");
-    lineno++;
+    output_printf(out, "#if INTERFACE\n");
     if (lemp->tokenprefix)
       prefix = lemp->tokenprefix;
     else
       prefix = "";
     for (i = 1; i < lemp->nterminal; i++) {
-      fprintf(out, "#define %s%-30s %2d\n", prefix, lemp->symbols[i]->name, i);
-      lineno++;
+      output_printf(out, "#define %s%-30s %2d\n", prefix, lemp->symbols[i]->name, i);
     }
-    fprintf(out, "#endif\n");
-    lineno++;
+    output_printf(out, "#endif\n");
   }
-  tplt_xfer(lemp->name, in, out, &lineno);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate the defines */
-  fprintf(out, "#define YYCODETYPE %s\n", minimum_size_type(0, lemp->nsymbol + 1));
-  lineno++;
-  fprintf(out, "#define YYNOCODE %d\n", lemp->nsymbol + 1);
-  lineno++;
-  fprintf(out, "#define YYACTIONTYPE %s\n", minimum_size_type(0, lemp->nstate + lemp->nrule + 5));
-  lineno++;
+  output_printf(out, "#define YYCODETYPE %s\n", minimum_size_type(0, lemp->nsymbol + 1));
+  output_printf(out, "#define YYNOCODE %d\n", lemp->nsymbol + 1);
+  output_printf(out, "#define YYNTOKEN %d\n", lemp->nterminal);
+  if (lemp->tablefile) {
+    output_printf(out, "#define YYTABLEFILE 1\n");
+    output_printf(out, "#define YYTABLESIGNATURE 0x%08xU\n", table_signature(lemp));
+    output_printf(out, "#define YYACTIONTYPE int\n");
+  } else {
+    output_printf(out, "#define YYACTIONTYPE %s\n", minimum_size_type(0, lemp->nstate + lemp->nrule + 5 + glr.nEntry));
+  }
   if (lemp->wildcard) {
-    fprintf(out, "#define YYWILDCARD %d\n", lemp->wildcard->index);
-    lineno++;
+    output_printf(out, "#define YYWILDCARD %d\n", lemp->wildcard->index);
   }
-  print_stack_union(out, lemp, &lineno, mhflag);
-  fprintf(out, "#ifndef YYSTACKDEPTH\n");
-  lineno++;
+  print_stack_union(out, lemp, mhflag);
+  output_printf(out, "#ifndef YYSTACKDEPTH\n");
   if (lemp->stacksize) {
-    fprintf(out, "#define YYSTACKDEPTH %s\n", lemp->stacksize);
-    lineno++;
+    output_printf(out, "#define YYSTACKDEPTH %s\n", lemp->stacksize);
   } else {
-    fprintf(out, "#define YYSTACKDEPTH 100\n");
-    lineno++;
+    output_printf(out, "#define YYSTACKDEPTH 100\n");
   }
-  fprintf(out, "#endif\n");
-  lineno++;
+  output_printf(out, "#endif\n");
   if (mhflag) {
-    fprintf(out, "#if INTERFACE\n");
-    lineno++;
+    output_printf(out, "#if INTERFACE\n");
   }
   name = lemp->name ? lemp->name : "Parse";
   if (lemp->arg && lemp->arg[0]) {
@@ -963,53 +1858,50 @@ ReportTable(struct lemon *lemp, int mhflag // Output in makeheaders format if tr
       i--;
     while (i >= 1 && (isalnum(lemp->arg[i - 1]) || lemp->arg[i - 1] == '_'))
       i--;
-    fprintf(out, "#define %sARG_SDECL %s;\n", name, lemp->arg);
-    lineno++;
-    fprintf(out, "#define %sARG_PDECL ,%s\n", name, lemp->arg);
-    lineno++;
-    fprintf(out, "#define %sARG_FETCH %s = yypParser->%s\n", name, lemp->arg, &lemp->arg[i]);
-    lineno++;
-    fprintf(out, "#define %sARG_STORE yypParser->%s = %s\n", name, &lemp->arg[i], &lemp->arg[i]);
-    lineno++;
+    output_printf(out, "#define %sARG_SDECL %s;\n", name, lemp->arg);
+    output_printf(out, "#define %sARG_PDECL ,%s\n", name, lemp->arg);
+    output_printf(out, "#define %sARG_FETCH %s = yypParser->%s\n", name, lemp->arg, &lemp->arg[i]);
+    output_printf(out, "#define %sARG_STORE yypParser->%s = %s\n", name, &lemp->arg[i], &lemp->arg[i]);
+    output_printf(out, "#define %sARG_PARAM(X) ,X\n", name);
   } else {
-    fprintf(out, "#define %sARG_SDECL\n", name);
-    lineno++;
-    fprintf(out, "#define %sARG_PDECL\n", name);
-    lineno++;
-    fprintf(out, "#define %sARG_FETCH\n", name);
-    lineno++;
-    fprintf(out, "#define %sARG_STORE\n", name);
-    lineno++;
+    output_printf(out, "#define %sARG_SDECL\n", name);
+    output_printf(out, "#define %sARG_PDECL\n", name);
+    output_printf(out, "#define %sARG_FETCH\n", name);
+    output_printf(out, "#define %sARG_STORE\n", name);
+    output_printf(out, "#define %sARG_PARAM(X)\n", name);
   }
   if (mhflag) {
-    fprintf(out, "#endif\n");
-    lineno++;
+    output_printf(out, "#endif\n");
   }
-  fprintf(out, "#define YYNSTATE %d\n", lemp->nstate);
-  lineno++;
-  fprintf(out, "#define YYNRULE %d\n", lemp->nrule);
-  lineno++;
+  if (lemp->tablefile) {
+    output_printf(out, "#define YYNSTATE (yyTables.nState)\n");
+  } else {
+    output_printf(out, "#define YYNSTATE %d\n", lemp->nstate);
+  }
+  output_printf(out, "#define YYNRULE %d\n", lemp->nrule);
   if (lemp->errsym->useCnt) {
-    fprintf(out, "#define YYERRORSYMBOL %d\n", lemp->errsym->index);
-    lineno++;
-    fprintf(out, "#define YYERRSYMDT yy%d\n", lemp->errsym->dtnum);
-    lineno++;
+    output_printf(out, "#define YYERRORSYMBOL %d\n", lemp->errsym->index);
+    output_printf(out, "#define YYERRSYMDT yy%d\n", lemp->errsym->dtnum);
   }
-  if (lemp->has_fallback) {
-    fprintf(out, "#define YYFALLBACK 1\n");
-    lineno++;
+  if (lemp->has_fallback || lemp->tablefile) {
+    output_printf(out, "#define YYFALLBACK 1\n");
+  }
+  if (lemp->synctoken) {
+    output_printf(out, "#define YYSYNCTOKEN %d\n", lemp->synctoken->index);
+  }
+  if (nMerged > 0 || lemp->tablefile) {
+    output_printf(out, "#define YYTOKENCLASS 1\n");
   }
-  tplt_xfer(lemp->name, in, out, &lineno);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate the include code, if any */
-  tplt_print(out, lemp, lemp->include, &lineno);
-  if (mhflag) {
+  tplt_print(out, lemp, lemp->include);
+  if (mhflag && !lemp->cplusplus) {
     char *nm = file_makename(lemp, ".h");
-    fprintf(out, "#include \"%s\"\n", nm);
-    lineno++;
+    output_printf(out, "#include \"%s\"\n", nm);
     free(nm);
   }
-  tplt_xfer(lemp->name, in, out, &lineno);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate the action table and its associates:
    *
@@ -1021,205 +1913,238 @@ ReportTable(struct lemon *lemp, int mhflag // Output in makeheaders format if tr
    *  yy_reduce_ofst[]   For each state, the offset into yy_action for
    *                     shifting non-terminals after a reduce.
    *  yy_default[]       Default action for each state.
+   *  yy_goto_default[]  For each non-terminal, the state that most gotos on
+   *                     it lead to.  yy_action holds only the others.
+   *  yy_token_class[]   For each terminal, the terminal whose column of
+   *                     yy_action it shares.
    */
 
-  /* Compute the actions on all states and count them up */
-  ax = (struct axset *)calloc(lemp->nstate * 2, sizeof(ax[0]));
-  MemoryCheck(ax);
-  for (i = 0; i < lemp->nstate; i++) {
-    stp = lemp->sorted[i];
-    ax[i * 2].stp = stp;
-    ax[i * 2].isTkn = 1;
-    ax[i * 2].nAction = stp->nTknAct;
-    ax[i * 2 + 1].stp = stp;
-    ax[i * 2 + 1].isTkn = 0;
-    ax[i * 2 + 1].nAction = stp->nNtAct;
-  }
-  mxTknOfst = mnTknOfst = 0;
-  mxNtOfst = mnNtOfst = 0;
-
-  /* Compute the action table.  In order to try to keep the size of the
-   * action table to a minimum, the heuristic of placing the largest action
-   * sets first is used.
+  /* Compute the action table, unless it came with the states from the
+   * cache.  In order to try to keep the size of the action table to a
+   * minimum, the heuristic of placing the largest action sets first is
+   * used.
    */
-  for (i = 0; i < lemp->nstate * 2; i++)
-    ax[i].iOrder = i;
-  qsort(ax, lemp->nstate * 2, sizeof(ax[0]), axset_compare);
-  pActtab = acttab_alloc();
-  for (i = 0; i < lemp->nstate * 2 && ax[i].nAction > 0; i++) {
-    stp = ax[i].stp;
-    if (ax[i].isTkn) {
-      for (ap = stp->actions; ap; ap = ap->next) {
-        int action;
-        if (ap->item->sp->index >= lemp->nterminal)
-          continue;
-        action = compute_action(lemp, ap->item);
-        if (action < 0)
-          continue;
-        acttab_action(pActtab, ap->item->sp->index, action);
+  if (lemp->acttab == 0) {
+    ax = (struct axset *)calloc(lemp->nstate * 2, sizeof(ax[0]));
+    MemoryCheck(ax);
+    for (i = 0; i < lemp->nstate; i++) {
+      stp = lemp->sorted[i];
+      ax[i * 2].stp = stp;
+      ax[i * 2].isTkn = 1;
+      ax[i * 2].nAction = stp->nTknAct;
+      ax[i * 2 + 1].stp = stp;
+      ax[i * 2 + 1].isTkn = 0;
+      ax[i * 2 + 1].nAction = 0;
+      for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+        if (compute_goto(lemp, ap, aGotoDflt) >= 0)
+          ax[i * 2 + 1].nAction++;
       }
-      stp->iTknOfst = acttab_insert(pActtab);
-      if (stp->iTknOfst < mnTknOfst)
-        mnTknOfst = stp->iTknOfst;
-      if (stp->iTknOfst > mxTknOfst)
-        mxTknOfst = stp->iTknOfst;
-    } else {
-      for (ap = stp->actions; ap; ap = ap->next) {
-        int action;
-        if (ap->item->sp->index < lemp->nterminal)
-          continue;
-        if (ap->item->sp->index == lemp->nsymbol)
-          continue;
-        action = compute_action(lemp, ap->item);
-        if (action < 0)
-          continue;
-        acttab_action(pActtab, ap->item->sp->index, action);
+    }
+    for (i = 0; i < lemp->nstate * 2; i++)
+      ax[i].iOrder = i;
+    qsort(ax, lemp->nstate * 2, sizeof(ax[0]), axset_compare);
+
+    /* Collect the entries of each action set, then pack the sets */
+    pActtab = acttab_alloc();
+    for (n = 0; n < lemp->nstate * 2 && ax[n].nAction > 0; n++)
+      ;
+    for (i = 0; i < n; i++) {
+      stp = ax[i].stp;
+      if (ax[i].isTkn) {
+        for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+          int action;
+          if (ap->sp->index >= lemp->nterminal)
+            continue;
+          if (aClass[ap->sp->index] != ap->sp->index)
+            continue;
+          if (lemp->glr)
+            action = compute_glr_action(lemp, &glr, stp, ap);
+          else
+            action = compute_action(lemp, ap);
+          if (action < 0)
+            continue;
+          acttab_action(pActtab, ap->sp->index, action);
+        }
+      } else {
+        for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+          int action = compute_goto(lemp, ap, aGotoDflt);
+          if (action < 0)
+            continue;
+          acttab_action(pActtab, ap->sp->index, action);
+        }
       }
-      stp->iNtOfst = acttab_insert(pActtab);
-      if (stp->iNtOfst < mnNtOfst)
-        mnNtOfst = stp->iNtOfst;
-      if (stp->iNtOfst > mxNtOfst)
-        mxNtOfst = stp->iNtOfst;
+      ax[i].nEntry = acttab_take(pActtab, &ax[i].aEntry, &ax[i].nSpan);
     }
+    acttab_free(pActtab);
+    pActtab = search_axsets(ax, n, lemp->packmsec);
+    for (i = 0; i < n; i++) {
+      if (ax[i].isTkn)
+        ax[i].stp->iTknOfst = ax[i].iOfst;
+      else
+        ax[i].stp->iNtOfst = ax[i].iOfst;
+      free(ax[i].aEntry);
+    }
+    free(ax);
+    lemp->acttab = pActtab;
   }
-  free(ax);
+  pActtab = lemp->acttab;
 
-  /* Output the yy_action table */
-  n = acttab_size(pActtab);
-  fprintf(out, "#define YY_ACTTAB_COUNT (%d)\n", n);
-  lineno++;
-  fprintf(out, "static const YYACTIONTYPE yy_action[] = {\n");
-  lineno++;
-  for (i = j = 0; i < n; i++) {
-    int action = acttab_yyaction(pActtab, i);
-    if (action < 0)
-      action = lemp->nstate + lemp->nrule + 2;
-    if (j == 0)
-      fprintf(out, " /* %5d */ ", i);
-    fprintf(out, " %4d,", action);
-    if (j == 9 || i == n - 1) {
-      fprintf(out, "\n");
-      lineno++;
-      j = 0;
-    } else {
-      j++;
+  /* Find the range of the offsets into the action table */
+  mxTknOfst = mnTknOfst = 0;
+  mxNtOfst = mnNtOfst = 0;
+  for (i = 0; i < lemp->nstate; i++) {
+    stp = lemp->sorted[i];
+    if (stp->iTknOfst != NO_OFFSET && stp->iTknOfst < mnTknOfst)
+      mnTknOfst = stp->iTknOfst;
+    if (stp->iTknOfst != NO_OFFSET && stp->iTknOfst > mxTknOfst)
+      mxTknOfst = stp->iTknOfst;
+    if (stp->iNtOfst != NO_OFFSET && stp->iNtOfst < mnNtOfst)
+      mnNtOfst = stp->iNtOfst;
+    if (stp->iNtOfst != NO_OFFSET && stp->iNtOfst > mxNtOfst)
+      mxNtOfst = stp->iNtOfst;
+  }
+
+  if (lemp->tablefile) {
+    write_table_file(lemp, pActtab, mnTknOfst, mnNtOfst, aClass, aGotoDflt);
+  } else {
+    /* Output the yy_action table */
+    n = acttab_size(pActtab);
+    output_printf(out, "#define YY_ACTTAB_COUNT (%d)\n", n);
+    output_printf(out, "%s YYACTIONTYPE yy_action[] = {\n", tabledecl);
+    for (i = 0; i < n; i++) {
+      int action = acttab_yyaction(pActtab, i);
+      if (action < 0)
+        action = lemp->nstate + lemp->nrule + 2;
+      write_table_cell(out, i, n, action);
     }
-  }
-  fprintf(out, "};\n");
-  lineno++;
+    output_printf(out, "};\n");
+
+    /* Output the yy_lookahead table */
+    output_printf(out, "%s YYCODETYPE yy_lookahead[] = {\n", tabledecl);
+    for (i = 0; i < n; i++) {
+      int la = acttab_yylookahead(pActtab, i);
+      if (la < 0)
+        la = lemp->nsymbol;
+      write_table_cell(out, i, n, la);
+    }
+    output_printf(out, "};\n");
 
-  /* Output the yy_lookahead table */
-  fprintf(out, "static const YYCODETYPE yy_lookahead[] = {\n");
-  lineno++;
-  for (i = j = 0; i < n; i++) {
-    int la = acttab_yylookahead(pActtab, i);
-    if (la < 0)
-      la = lemp->nsymbol;
-    if (j == 0)
-      fprintf(out, " /* %5d */ ", i);
-    fprintf(out, " %4d,", la);
-    if (j == 9 || i == n - 1) {
-      fprintf(out, "\n");
-      lineno++;
-      j = 0;
-    } else {
-      j++;
+    /* Output the yy_shift_ofst[] table */
+    output_printf(out, "#define YY_SHIFT_USE_DFLT (%d)\n", mnTknOfst - 1);
+    n = lemp->nstate;
+    while (n > 0 && lemp->sorted[n - 1]->iTknOfst == NO_OFFSET)
+      n--;
+    output_printf(out, "#define YY_SHIFT_COUNT (%d)\n", n - 1);
+    output_printf(out, "#define YY_SHIFT_MIN   (%d)\n", mnTknOfst);
+    output_printf(out, "#define YY_SHIFT_MAX   (%d)\n", mxTknOfst);
+    output_printf(out, "%s %s yy_shift_ofst[] = {\n", tabledecl, minimum_size_type(mnTknOfst - 1, mxTknOfst));
+    for (i = 0; i < n; i++) {
+      int ofst;
+      stp = lemp->sorted[i];
+      ofst = stp->iTknOfst;
+      if (ofst == NO_OFFSET)
+        ofst = mnTknOfst - 1;
+      write_table_cell(out, i, n, ofst);
     }
-  }
-  fprintf(out, "};\n");
-  lineno++;
+    output_printf(out, "};\n");
 
-  /* Output the yy_shift_ofst[] table */
-  fprintf(out, "#define YY_SHIFT_USE_DFLT (%d)\n", mnTknOfst - 1);
-  lineno++;
-  n = lemp->nstate;
-  while (n > 0 && lemp->sorted[n - 1]->iTknOfst == NO_OFFSET)
-    n--;
-  fprintf(out, "#define YY_SHIFT_COUNT (%d)\n", n - 1);
-  lineno++;
-  fprintf(out, "#define YY_SHIFT_MIN   (%d)\n", mnTknOfst);
-  lineno++;
-  fprintf(out, "#define YY_SHIFT_MAX   (%d)\n", mxTknOfst);
-  lineno++;
-  fprintf(out, "static const %s yy_shift_ofst[] = {\n", minimum_size_type(mnTknOfst - 1, mxTknOfst));
-  lineno++;
-  for (i = j = 0; i < n; i++) {
-    int ofst;
-    stp = lemp->sorted[i];
-    ofst = stp->iTknOfst;
-    if (ofst == NO_OFFSET)
-      ofst = mnTknOfst - 1;
-    if (j == 0)
-      fprintf(out, " /* %5d */ ", i);
-    fprintf(out, " %4d,", ofst);
-    if (j == 9 || i == n - 1) {
-      fprintf(out, "\n");
-      lineno++;
-      j = 0;
-    } else {
-      j++;
+    /* Output the yy_reduce_ofst[] table */
+    output_printf(out, "#define YY_REDUCE_USE_DFLT (%d)\n", mnNtOfst - 1);
+    n = lemp->nstate;
+    while (n > 0 && lemp->sorted[n - 1]->iNtOfst == NO_OFFSET)
+      n--;
+    output_printf(out, "#define YY_REDUCE_COUNT (%d)\n", n - 1);
+    output_printf(out, "#define YY_REDUCE_MIN   (%d)\n", mnNtOfst);
+    output_printf(out, "#define YY_REDUCE_MAX   (%d)\n", mxNtOfst);
+    output_printf(out, "%s %s yy_reduce_ofst[] = {\n", tabledecl, minimum_size_type(mnNtOfst - 1, mxNtOfst));
+    for (i = 0; i < n; i++) {
+      int ofst;
+      stp = lemp->sorted[i];
+      ofst = stp->iNtOfst;
+      if (ofst == NO_OFFSET)
+        ofst = mnNtOfst - 1;
+      write_table_cell(out, i, n, ofst);
     }
-  }
-  fprintf(out, "};\n");
-  lineno++;
+    output_printf(out, "};\n");
+
+    /* Output the default action table */
+    output_printf(out, "%s YYACTIONTYPE yy_default[] = {\n", tabledecl);
+    n = lemp->nstate;
+    for (i = 0; i < n; i++) {
+      stp = lemp->sorted[i];
+      write_table_cell(out, i, n, stp->iDflt);
+    }
+    output_printf(out, "};\n");
 
-  /* Output the yy_reduce_ofst[] table */
-  fprintf(out, "#define YY_REDUCE_USE_DFLT (%d)\n", mnNtOfst - 1);
-  lineno++;
-  n = lemp->nstate;
-  while (n > 0 && lemp->sorted[n - 1]->iNtOfst == NO_OFFSET)
-    n--;
-  fprintf(out, "#define YY_REDUCE_COUNT (%d)\n", n - 1);
-  lineno++;
-  fprintf(out, "#define YY_REDUCE_MIN   (%d)\n", mnNtOfst);
-  lineno++;
-  fprintf(out, "#define YY_REDUCE_MAX   (%d)\n", mxNtOfst);
-  lineno++;
-  fprintf(out, "static const %s yy_reduce_ofst[] = {\n", minimum_size_type(mnNtOfst - 1, mxNtOfst));
-  lineno++;
-  for (i = j = 0; i < n; i++) {
-    int ofst;
-    stp = lemp->sorted[i];
-    ofst = stp->iNtOfst;
-    if (ofst == NO_OFFSET)
-      ofst = mnNtOfst - 1;
-    if (j == 0)
-      fprintf(out, " /* %5d */ ", i);
-    fprintf(out, " %4d,", ofst);
-    if (j == 9 || i == n - 1) {
-      fprintf(out, "\n");
-      lineno++;
-      j = 0;
-    } else {
-      j++;
+    /* Output the yy_goto_default[] table */
+    output_printf(out, "%s YYACTIONTYPE yy_goto_default[] = {\n", tabledecl);
+    n = lemp->nsymbol - lemp->nterminal;
+    for (i = 0; i < n; i++) {
+      write_table_cell(out, i, n, aGotoDflt[i]);
     }
-  }
-  fprintf(out, "};\n");
-  lineno++;
+    output_printf(out, "};\n");
 
-  /* Output the default action table */
-  fprintf(out, "static const YYACTIONTYPE yy_default[] = {\n");
-  lineno++;
-  n = lemp->nstate;
-  for (i = j = 0; i < n; i++) {
-    stp = lemp->sorted[i];
-    if (j == 0)
-      fprintf(out, " /* %5d */ ", i);
-    fprintf(out, " %4d,", stp->iDflt);
-    if (j == 9 || i == n - 1) {
-      fprintf(out, "\n");
-      lineno++;
-      j = 0;
-    } else {
-      j++;
+    /* Output the yy_expected[] bitmaps and the yy_expected_row[] table
+     * that gives the bitmap of each state
+     */
+    nWord = (lemp->nterminal + 31) / 32;
+    aRow = (int *)malloc(sizeof(aRow[0]) * lemp->nstate);
+    MemoryCheck(aRow);
+    aBitmap = expected_tokens(lemp, nWord, aRow, &nBitmap);
+    output_printf(out, "#define YY_EXPECTED_WORDS (%d)\n", nWord);
+    output_printf(out, "%s unsigned int yy_expected[] = {\n", tabledecl);
+    n = nBitmap * nWord;
+    for (i = 0; i < n; i++) {
+      output_printf(out, " 0x%08x,", aBitmap[i]);
+      if (i % 6 == 5 || i == n - 1)
+        output_putc(out, '\n');
+    }
+    output_printf(out, "};\n");
+    output_printf(out, "%s %s yy_expected_row[] = {\n", tabledecl, minimum_size_type(0, nBitmap - 1));
+    n = lemp->nstate;
+    for (i = 0; i < n; i++) {
+      write_table_cell(out, i, n, aRow[i]);
+    }
+    output_printf(out, "};\n");
+    free(aBitmap);
+    free(aRow);
+
+    /* Output the first of the states that reduce without a look-ahead */
+    n = lemp->nstate;
+    while (n > 1 && lemp->sorted[n - 1]->autoReduce)
+      n--;
+    output_printf(out, "#define YY_MIN_AUTOREDUCE (%d)\n", n);
+
+    /* Output the yy_token_class[] table */
+    if (nMerged > 0) {
+      output_printf(out, "%s YYCODETYPE yy_token_class[] = {\n", tabledecl);
+      n = lemp->nterminal;
+      for (i = 0; i < n; i++) {
+        write_table_cell(out, i, n, aClass[i]);
+      }
+      output_printf(out, "};\n");
     }
   }
-  fprintf(out, "};\n");
-  lineno++;
-  tplt_xfer(lemp->name, in, out, &lineno);
+  free(aClass);
+  free(aGotoDflt);
+
+  /* Output the yy_conflict[] lists of a GLR parser */
+  if (lemp->glr) {
+    n = glr.nEntry;
+    output_printf(out, "#define YY_CONFLICT_COUNT (%d)\n", n);
+    if (n > 0) {
+      output_printf(out, "%s YYACTIONTYPE yy_conflict[] = {\n", tabledecl);
+      for (i = 0; i < n; i++) {
+        write_table_cell(out, i, n, glr.aEntry[i]);
+      }
+      output_printf(out, "};\n");
+    }
+  }
+  free(glr.aEntry);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate the table of fallback tokens. */
-  if (lemp->has_fallback) {
+  if (lemp->has_fallback && !lemp->tablefile) {
     int mx = lemp->nterminal - 1;
     while (mx > 0 && lemp->symbols[mx]->fallback == 0) {
       mx--;
@@ -1227,29 +2152,26 @@ ReportTable(struct lemon *lemp, int mhflag // Output in makeheaders format if tr
     for (i = 0; i <= mx; i++) {
       struct symbol *p = lemp->symbols[i];
       if (p->fallback == 0) {
-        fprintf(out, "    0,  /* %10s => nothing */\n", p->name);
+        output_printf(out, "    0,  /* %10s => nothing */\n", p->name);
       } else {
-        fprintf(out, "  %3d,  /* %10s => %s */\n", p->fallback->index, p->name, p->fallback->name);
+        output_printf(out, "  %3d,  /* %10s => %s */\n", p->fallback->index, p->name, p->fallback->name);
       }
-      lineno++;
     }
   }
-  tplt_xfer(lemp->name, in, out, &lineno);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate a table containing the symbolic name of every symbol */
-  for (i = 0; i < lemp->nsymbol; i++) {
+  for (i = 0; i < lemp->nsymbol && !lemp->tablefile; i++) {
     sprintf(line, "\"%s\",", lemp->symbols[i]->name);
-    fprintf(out, "  %-15s", line);
+    output_printf(out, "  %-15s", line);
     if ((i & 3) == 3) {
-      fprintf(out, "\n");
-      lineno++;
+      output_printf(out, "\n");
     }
   }
   if ((i & 3) != 0) {
-    fprintf(out, "\n");
-    lineno++;
+    output_printf(out, "\n");
   }
-  tplt_xfer(lemp->name, in, out, &lineno);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate a table containing a text string that describes every
    * rule in the rule set of the grammar.  This information is used
@@ -1257,12 +2179,11 @@ ReportTable(struct lemon *lemp, int mhflag // Output in makeheaders format if tr
    */
   for (i = 0, rp = lemp->rules; rp; rp = rp->next, i++) {
     assert(rp->item->index == i);
-    fprintf(out, " /* %3d */ \"", i);
+    output_printf(out, " /* %3d */ \"", i);
     writeRuleText(out, rp->item);
-    fprintf(out, "\",\n");
-    lineno++;
+    output_printf(out, "\",\n");
   }
-  tplt_xfer(lemp->name, in, out, &lineno);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate code which executes every time a symbol is popped from
    * the stack while processing errors or while destroying the parser.
@@ -1275,19 +2196,16 @@ ReportTable(struct lemon *lemp, int mhflag // Output in makeheaders format if tr
       if (sp == 0 || sp->type != TERMINAL)
         continue;
       if (once) {
-        fprintf(out, "      /* TERMINAL Destructor */\n");
-        lineno++;
+        output_printf(out, "      /* TERMINAL Destructor */\n");
         once = 0;
       }
-      fprintf(out, "    case %d: /* %s */\n", sp->index, sp->name);
-      lineno++;
+      output_printf(out, "    case %d: /* %s */\n", sp->index, sp->name);
     }
     for (i = 0; i < lemp->nsymbol && lemp->symbols[i]->type != TERMINAL; i++)
       ;
     if (i < lemp->nsymbol) {
-      emit_destructor_code(out, lemp->symbols[i], lemp, &lineno);
-      fprintf(out, "      break;\n");
-      lineno++;
+      emit_destructor_code(out, lemp->symbols[i], lemp);
+      output_printf(out, "      break;\n");
     }
   }
   if (lemp->vardest) {
@@ -1298,62 +2216,83 @@ ReportTable(struct lemon *lemp, int mhflag // Output in makeheaders format if tr
       if (sp == 0 || sp->type == TERMINAL || sp->index <= 0 || sp->destructor != 0)
         continue;
       if (once) {
-        fprintf(out, "      /* Default NON-TERMINAL Destructor */\n");
-        lineno++;
+        output_printf(out, "      /* Default NON-TERMINAL Destructor */\n");
         once = 0;
       }
-      fprintf(out, "    case %d: /* %s */\n", sp->index, sp->name);
-      lineno++;
+      output_printf(out, "    case %d: /* %s */\n", sp->index, sp->name);
       dflt_sp = sp;
     }
     if (dflt_sp != 0) {
-      emit_destructor_code(out, dflt_sp, lemp, &lineno);
+      emit_destructor_code(out, dflt_sp, lemp);
     }
-    fprintf(out, "      break;\n");
-    lineno++;
+    output_printf(out, "      break;\n");
   }
   for (i = 0; i < lemp->nsymbol; i++) {
     struct symbol *sp = lemp->symbols[i];
     if (sp == 0 || sp->type == TERMINAL || sp->destructor == 0)
       continue;
-    fprintf(out, "    case %d: /* %s */\n", sp->index, sp->name);
-    lineno++;
+    output_printf(out, "    case %d: /* %s */\n", sp->index, sp->name);
 
     /* Combine duplicate destructors into a single case */
     for (j = i + 1; j < lemp->nsymbol; j++) {
       struct symbol *sp2 = lemp->symbols[j];
       if (sp2 && sp2->type != TERMINAL && sp2->destructor && sp2->dtnum == sp->dtnum &&
           strcmp(sp->destructor, sp2->destructor) == 0) {
-        fprintf(out, "    case %d: /* %s */\n", sp2->index, sp2->name);
-        lineno++;
+        output_printf(out, "    case %d: /* %s */\n", sp2->index, sp2->name);
         sp2->destructor = 0;
       }
     }
 
-    emit_destructor_code(out, lemp->symbols[i], lemp, &lineno);
-    fprintf(out, "      break;\n");
-    lineno++;
+    emit_destructor_code(out, lemp->symbols[i], lemp);
+    output_printf(out, "      break;\n");
   }
-  tplt_xfer(lemp->name, in, out, &lineno);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate code which executes whenever the parser stack overflows */
-  tplt_print(out, lemp, lemp->overflow, &lineno);
-  tplt_xfer(lemp->name, in, out, &lineno);
+  tplt_print(out, lemp, lemp->overflow);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate the table of rule information
    *
    * Note: This code depends on the fact that rules are number
-   * sequentually beginning with 0.
+   * sequentually beginning with 0.  A parser that loads its tables from a
+   * file still compiles this one in, because its rule code depends on it.
    */
   for (rp = lemp->rules; rp; rp = rp->next) {
-    fprintf(out, "  { %d, %d },\n", rp->item->lhs->index, rp->item->nrhs);
-    lineno++;
+    output_printf(out, "  { %d, %d },\n", rp->item->lhs->index, rp->item->nrhs);
   }
-  tplt_xfer(lemp->name, in, out, &lineno);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate code which execution during each REDUCE action */
+  output_init(&code);
   for (rp = lemp->rules; rp; rp = rp->next) {
-    translate_code(lemp, rp->item);
+    translate_code(lemp, rp->item, &code);
+  }
+  free(code.z);
+  if (lemp->cplusplus) {
+    /* The C++ parser gets one member function for each distinct action,
+     * named after the first rule that uses it, and a switch that calls
+     * them.
+     */
+    for (rp = lemp->rules; rp; rp = rp->next) {
+      struct rule_list *rp2;
+      if (rp->item->code == 0)
+        continue;
+      if (rp->item->code[0] == '\n' && rp->item->code[1] == 0)
+        continue;
+      for (rp2 = lemp->rules; rp2 != rp && rp2->item->code != rp->item->code; rp2 = rp2->next)
+        ;
+      if (rp2 != rp)
+        continue;
+      output_printf(out, "  /* ");
+      writeRuleText(out, rp->item);
+      output_printf(out, " */\n");
+      output_printf(out, "  void yy_rule_%d(yyStackEntry *yymsp, YYMINORTYPE &yygotominor) {\n", rp->item->index);
+      emit_code(out, rp->item, lemp);
+      output_printf(out, "  }\n");
+    }
+    output_printf(out, "  void yy_reduce_action(int yyruleno, yyStackEntry *yymsp, YYMINORTYPE &yygotominor) {\n");
+    output_printf(out, "    switch (yyruleno) {\n");
   }
   /* First output rules other than the default: rule */
   for (rp = lemp->rules; rp; rp = rp->next) {
@@ -1362,97 +2301,80 @@ ReportTable(struct lemon *lemp, int mhflag // Output in makeheaders format if tr
       continue;
     if (rp->item->code[0] == '\n' && rp->item->code[1] == 0)
       continue; // Will be default:
-    fprintf(out, "      case %d: /* ", rp->item->index);
+    output_printf(out, "      case %d: /* ", rp->item->index);
     writeRuleText(out, rp->item);
-    fprintf(out, " */\n");
-    lineno++;
+    output_printf(out, " */\n");
     for (rp2 = rp->next; rp2; rp2 = rp2->next) {
       if (rp2->item->code == rp->item->code) {
-        fprintf(out, "      case %d: /* ", rp2->item->index);
+        output_printf(out, "      case %d: /* ", rp2->item->index);
         writeRuleText(out, rp2->item);
-        fprintf(out, " */ yytestcase(yyruleno==%d);\n", rp2->item->index);
-        lineno++;
+        output_printf(out, " */ yytestcase(yyruleno==%d);\n", rp2->item->index);
         rp2->item->code = 0;
       }
     }
-    emit_code(out, rp->item, lemp, &lineno);
-    fprintf(out, "        break;\n");
-    lineno++;
+    if (lemp->cplusplus) {
+      output_printf(out, "        yy_rule_%d(yymsp, yygotominor);\n", rp->item->index);
+    } else {
+      emit_code(out, rp->item, lemp);
+    }
+    output_printf(out, "        break;\n");
     rp->item->code = 0;
   }
   /* Finally, output the default: rule.  We choose as the default: all
    * empty actions.
    */
-  fprintf(out, "      default:\n");
-  lineno++;
+  output_printf(out, "      default:\n");
   for (rp = lemp->rules; rp; rp = rp->next) {
     if (rp->item->code == 0)
       continue;
     assert(rp->item->code[0] == '\n' && rp->item->code[1] == 0);
-    fprintf(out, "      /* (%d) ", rp->item->index);
+    output_printf(out, "      /* (%d) ", rp->item->index);
     writeRuleText(out, rp->item);
-    fprintf(out, " */ yytestcase(yyruleno==%d);\n", rp->item->index);
-    lineno++;
+    output_printf(out, " */ yytestcase(yyruleno==%d);\n", rp->item->index);
   }
-  fprintf(out, "        break;\n");
-  lineno++;
-  tplt_xfer(lemp->name, in, out, &lineno);
+  output_printf(out, "        break;\n");
+  if (lemp->cplusplus) {
+    output_printf(out, "    }\n  }\n");
+  }
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate code which executes if a parse fails */
-  tplt_print(out, lemp, lemp->failure, &lineno);
-  tplt_xfer(lemp->name, in, out, &lineno);
+  tplt_print(out, lemp, lemp->failure);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate code which executes when a syntax error occurs */
-  tplt_print(out, lemp, lemp->error, &lineno);
-  tplt_xfer(lemp->name, in, out, &lineno);
+  tplt_print(out, lemp, lemp->error);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Generate code which executes when the parser accepts its input */
-  tplt_print(out, lemp, lemp->accept, &lineno);
-  tplt_xfer(lemp->name, in, out, &lineno);
+  tplt_print(out, lemp, lemp->accept);
+  template_xfer(out, tp, iSegment++, lemp->name);
 
   /* Append any addition code the user desires */
-  tplt_print(out, lemp, lemp->extracode, &lineno);
+  tplt_print(out, lemp, lemp->extracode);
 
-  fclose(in);
-  fclose(out);
+  template_free(tp);
+  file_save(lemp, out);
   return;
 }
 
 /* Generate a header file for the parser */
 void
 ReportHeader(struct lemon *lemp) {
-  FILE *out, *in;
+  struct output out;
   const char *prefix;
-  char line[LINESIZE];
-  char pattern[LINESIZE];
   int i;
 
   if (lemp->tokenprefix)
     prefix = lemp->tokenprefix;
   else
     prefix = "";
-  in = file_open(lemp, ".h", "rb");
-  if (in) {
-    int nextChar;
-    for (i = 1; i < lemp->nterminal && fgets(line, LINESIZE, in); i++) {
-      sprintf(pattern, "#define %s%-30s %3d\n", prefix, lemp->symbols[i]->name, i);
-      if (strcmp(line, pattern))
-        break;
-    }
-    nextChar = fgetc(in);
-    fclose(in);
-    if (i == lemp->nterminal && nextChar == EOF) {
-      // No change in the file.  Don't rewrite it.
-      return;
-    }
-  }
-  out = file_open(lemp, ".h", "wb");
-  if (out) {
-    for (i = 1; i < lemp->nterminal; i++) {
-      fprintf(out, "#define %s%-30s %3d\n", prefix, lemp->symbols[i]->name, i);
-    }
-    fclose(out);
+  output_init(&out);
+  for (i = 1; i < lemp->nterminal; i++) {
+    output_printf(&out, "#define %s%-30s %3d\n", prefix, lemp->symbols[i]->name, i);
   }
+  file_setname(lemp, ".h");
+  file_save(lemp, &out);
   return;
 }
 
@@ -1466,7 +2388,7 @@ ReportHeader(struct lemon *lemp) {
 void
 CompressTables(struct lemon *lemp) {
   struct state *stp;
-  struct action_list *ap, *ap2;
+  struct action *ap, *ap2;
   struct rule *rp, *rp2, *rbest;
   int nbest, n;
   int i;
@@ -1478,22 +2400,26 @@ CompressTables(struct lemon *lemp) {
     rbest = 0;
     usesWildcard = 0;
 
-    for (ap = stp->actions; ap; ap = ap->next) {
-      if (ap->item->type == SHIFT && ap->item->sp == lemp->wildcard) {
+    for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+      if (ap->type == SHIFT && ap->sp == lemp->wildcard) {
         usesWildcard = 1;
       }
-      if (ap->item->type != REDUCE)
+      if (ap->type != REDUCE)
+        continue;
+      if (lemp->glr && has_alternatives(stp, ap))
         continue;
-      rp = ap->item->x.rp;
+      rp = ap->x.rp;
       if (rp->lhsStart)
         continue;
       if (rp == rbest)
         continue;
       n = 1;
-      for (ap2 = ap->next; ap2; ap2 = ap2->next) {
-        if (ap2->item->type != REDUCE)
+      for (ap2 = ap + 1; ap2 < stp->actions + stp->nAction; ap2++) {
+        if (ap2->type != REDUCE)
           continue;
-        rp2 = ap2->item->x.rp;
+        if (lemp->glr && has_alternatives(stp, ap2))
+          continue;
+        rp2 = ap2->x.rp;
         if (rp2 == rbest)
           continue;
         if (rp2 == rp)
@@ -1512,21 +2438,267 @@ CompressTables(struct lemon *lemp) {
     if (nbest < 1 || usesWildcard)
       continue;
 
-    /* Combine matching REDUCE actions into a single default */
-    for (ap = stp->actions; ap; ap = ap->next) {
-      if (ap->item->type == REDUCE && ap->item->x.rp == rbest)
-        break;
+    /* Combine matching REDUCE actions into a single default.  The actions
+     * it replaces stay behind as NOT_USED, so that their lookaheads still
+     * count as expected.  A GLR parser keeps the lookaheads with conflicts
+     * explicit, so that their conflict lists can be found.
+     */
+    for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+      if (ap->type == REDUCE && ap->x.rp == rbest && !(lemp->glr && has_alternatives(stp, ap)))
+        ap->type = NOT_USED;
     }
-    assert(ap);
-    ap->item->sp = make_symbol("{default}");
-    for (ap = ap->next; ap; ap = ap->next) {
-      if (ap->item->type == REDUCE && ap->item->x.rp == rbest)
-        ap->item->type = NOT_USED;
+    action_add(stp, make_symbol(lemp, "{default}"), REDUCE, rbest);
+    action_sort(stp);
+  }
+}
+
+/* Return the rule that the state reduces by whatever the look-ahead, if
+ * it has no other action and the rule is a unit rule.  Return NULL
+ * otherwise.
+ */
+static struct rule *
+unit_reduction(struct lemon *lemp, struct state *stp) {
+  struct action *ap;
+  struct rule *rp = 0;
+
+  for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+    switch (ap->type) {
+    case REDUCE:
+      if (rp && ap->x.rp != rp)
+        return 0;
+      rp = ap->x.rp;
+      break;
+    case SH_RESOLVED:
+    case RD_RESOLVED:
+    case NOT_USED:
+      break;
+    default:
+      return 0;
+    }
+  }
+  if (rp == 0 || rp->lhsStart || !is_unit_rule(lemp, rp))
+    return 0;
+  return rp;
+}
+
+/* Let the gotos of every state skip the states that do nothing but
+ * reduce by a unit rule, such as "expr ::= term." without code.  Such
+ * a goto leads straight to where the goto on the left-hand side of the
+ * rule would, so the parser never reduces by the rule there and the
+ * value of the right-hand side stays on the stack as it is, just as the
+ * reduce would have passed it on.  The rule stays in the grammar and is
+ * still reduced in states with other actions.
+ *
+ * A GLR parser reduces by every rule, since it merges the branches of
+ * a split only where they reach the same state on the same symbol.
+ */
+void
+BypassUnitRules(struct lemon *lemp) {
+  struct state *stp;
+  struct action *ap, *ap2;
+  struct rule *rp;
+  int i, n;
+
+  if (lemp->glr)
+    return;
+  for (i = 0; i < lemp->nstate; i++) {
+    stp = lemp->sorted[i];
+    for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+      if (ap->type != SHIFT || ap->sp->type != NONTERMINAL)
+        continue;
+
+      /* Follow a chain of unit rules to its end.  A cycle of them, which
+       * only an ambiguous grammar has, ends after a bounded number of steps.
+       */
+      for (n = 0; n < lemp->nstate; n++) {
+        rp = unit_reduction(lemp, ap->x.stp);
+        if (rp == 0)
+          break;
+        for (ap2 = stp->actions; ap2 < stp->actions + stp->nAction && ap2->sp != rp->lhs; ap2++)
+          ;
+        if (ap2 == stp->actions + stp->nAction || ap2->type != SHIFT)
+          break;
+        ap->x.stp = ap2->x.stp;
+      }
     }
-    action_list_sort(&stp->actions);
   }
 }
 
+/* The actions of a state as a row of integers, while merging states */
+struct state_key {
+  int *aKey;  // Integers that equivalent states have in common
+  int nKey;   // Number of integers in aKey[]
+  int iState; // Number of the state
+};
+
+static int
+state_key_equal(const struct state_key *p1, const struct state_key *p2) {
+  return p1->nKey == p2->nKey && memcmp(p1->aKey, p2->aKey, sizeof(p1->aKey[0]) * p1->nKey) == 0;
+}
+
+static int
+state_key_compare(const void *a, const void *b) {
+  const struct state_key *p1 = (const struct state_key *)a;
+  const struct state_key *p2 = (const struct state_key *)b;
+  int i;
+  if (p1->nKey != p2->nKey)
+    return p1->nKey - p2->nKey;
+  for (i = 0; i < p1->nKey; i++) {
+    if (p1->aKey[i] != p2->aKey[i])
+      return p1->aKey[i] < p2->aKey[i] ? -1 : 1;
+  }
+  return p1->iState - p2->iState;
+}
+
+/* Merge the states that act alike, and drop those that no action leads
+ * to any more, such as the states that the gotos bypass.  Two states
+ * act alike if they have the same actions on the same symbols, and the
+ * states they shift to act alike in turn.  Their basis items may
+ * differ, and the report shows the items of the first of them only.
+ *
+ * The classes of states that act alike are found by refining the
+ * partition of states by their actions until the states of every class
+ * also shift into the same classes.  The first state of each class is
+ * kept and takes the shifts into all of the others.
+ */
+void
+MinimizeStates(struct lemon *lemp) {
+  struct state_key *aOrder;
+  struct state *stp;
+  struct action *ap;
+  int *aClass, *aStack, *aBuf;
+  int nClass, nPrev, nLive, nStack, nBuf;
+  int i, j, n;
+
+  aClass = (int *)malloc(sizeof(aClass[0]) * lemp->nstate);
+  aStack = (int *)malloc(sizeof(aStack[0]) * lemp->nstate);
+  aOrder = (struct state_key *)malloc(sizeof(aOrder[0]) * lemp->nstate);
+  MemoryCheck(aClass);
+  MemoryCheck(aStack);
+  MemoryCheck(aOrder);
+
+  /* Find the states that can be reached from the first.  The targets of
+   * actions the tables leave out count too, so that every action still
+   * refers to a state that is kept.
+   */
+  for (i = 0; i < lemp->nstate; i++) {
+    assert(lemp->sorted[i]->statenum == i);
+    aClass[i] = -1;
+  }
+  aClass[0] = 0;
+  aStack[0] = 0;
+  nStack = 1;
+  while (nStack > 0) {
+    stp = lemp->sorted[aStack[--nStack]];
+    for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+      if (action_holds_state(ap->type) && aClass[ap->x.stp->statenum] < 0) {
+        aClass[ap->x.stp->statenum] = 0;
+        aStack[nStack++] = ap->x.stp->statenum;
+      }
+    }
+  }
+
+  /* Give every live state a row of integers long enough for its actions */
+  nBuf = 0;
+  for (i = 0; i < lemp->nstate; i++) {
+    if (aClass[i] < 0)
+      continue;
+    for (ap = lemp->sorted[i]->actions; ap < lemp->sorted[i]->actions + lemp->sorted[i]->nAction; ap++)
+      nBuf += 3;
+    nBuf++;
+  }
+  aBuf = (int *)malloc(sizeof(aBuf[0]) * (nBuf > 0 ? nBuf : 1));
+  MemoryCheck(aBuf);
+  nLive = 0;
+  n = 0;
+  for (i = 0; i < lemp->nstate; i++) {
+    if (aClass[i] < 0)
+      continue;
+    aOrder[nLive].aKey = &aBuf[n];
+    aOrder[nLive].iState = i;
+    for (ap = lemp->sorted[i]->actions; ap < lemp->sorted[i]->actions + lemp->sorted[i]->nAction; ap++)
+      n += 3;
+    n++;
+    nLive++;
+  }
+
+  /* Partition the live states by their actions, leaving out the targets
+   * of the shifts and the actions the tables leave out
+   */
+  for (i = 0; i < nLive; i++) {
+    int *aKey = aOrder[i].aKey;
+    stp = lemp->sorted[aOrder[i].iState];
+    n = 0;
+    for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+      if (ap->type == SH_RESOLVED || ap->type == RD_RESOLVED)
+        continue;
+      aKey[n++] = ap->sp->index;
+      aKey[n++] = ap->type;
+      aKey[n++] = action_holds_state(ap->type) || ap->type == ACCEPT ? -1 : ap->x.rp->index;
+    }
+    aOrder[i].nKey = n;
+  }
+
+  /* Split the classes until the states of each shift into the same
+   * classes on every symbol
+   */
+  nPrev = 0;
+  for (;;) {
+    qsort(aOrder, nLive, sizeof(aOrder[0]), state_key_compare);
+    nClass = 0;
+    for (i = 0; i < nLive; i = j) {
+      for (j = i; j < nLive && state_key_equal(&aOrder[i], &aOrder[j]); j++)
+        aClass[aOrder[j].iState] = nClass;
+      nClass++;
+    }
+    if (nClass == nPrev)
+      break;
+    nPrev = nClass;
+    for (i = 0; i < nLive; i++) {
+      int *aKey = aOrder[i].aKey;
+      stp = lemp->sorted[aOrder[i].iState];
+      n = 0;
+      aKey[n++] = aClass[aOrder[i].iState];
+      for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+        if (ap->type == SHIFT || ap->type == SSCONFLICT)
+          aKey[n++] = aClass[ap->x.stp->statenum];
+      }
+      aOrder[i].nKey = n;
+    }
+  }
+
+  /* Keep the first state of each class, and let every action that leads
+   * to a state of the class lead to that one instead
+   */
+  for (i = 0; i < nClass; i++)
+    aStack[i] = -1;
+  for (i = 0; i < lemp->nstate; i++) {
+    if (aClass[i] >= 0 && aStack[aClass[i]] < 0)
+      aStack[aClass[i]] = i;
+  }
+  for (i = 0; i < lemp->nstate; i++) {
+    if (aClass[i] < 0 || aStack[aClass[i]] != i)
+      continue;
+    for (ap = lemp->sorted[i]->actions; ap < lemp->sorted[i]->actions + lemp->sorted[i]->nAction; ap++) {
+      if (action_holds_state(ap->type))
+        ap->x.stp = lemp->sorted[aStack[aClass[ap->x.stp->statenum]]];
+    }
+  }
+  for (i = n = 0; i < lemp->nstate; i++) {
+    if (aClass[i] >= 0 && aStack[aClass[i]] == i) {
+      lemp->sorted[n] = lemp->sorted[i];
+      lemp->sorted[n]->statenum = n;
+      n++;
+    }
+  }
+  assert(n == nClass);
+  lemp->nstate = n;
+  free(aBuf);
+  free(aOrder);
+  free(aStack);
+  free(aClass);
+}
+
 /* Compare two states for sorting purposes.  The smaller state is the
  * one with the most non-terminal actions.  If they have the same number
  * of non-terminal actions, then the smaller is the one with the most
@@ -1538,7 +2710,10 @@ stateResortCompare(const void *a, const void *b) {
   const struct state *pB = *(const struct state **)b;
   int n;
 
-  n = pB->nNtAct - pA->nNtAct;
+  n = pA->autoReduce - pB->autoReduce;
+  if (n == 0) {
+    n = pB->nNtAct - pA->nNtAct;
+  }
   if (n == 0) {
     n = pB->nTknAct - pA->nTknAct;
     if (n == 0) {
@@ -1551,30 +2726,42 @@ stateResortCompare(const void *a, const void *b) {
 
 /* Renumber and resort states so that states with fewer choices
  * occur at the end.  Except, keep state 0 as the first state.
+ *
+ * Last of all come the states whose only action is to reduce by their
+ * default rule, which the parser may do without waiting for a look-ahead.
+ * Rules of the start symbol are left out, so that the parser never accepts
+ * before it sees the end of input.
  */
 void
 ResortStates(struct lemon *lemp) {
   int i;
   struct state *stp;
-  struct action_list *ap;
+  struct action *ap;
+  struct symbol *start; // The symbol state 0 accepts
+  struct rule *dflt;    // The rule a state reduces by default
 
+  start = start_symbol(lemp);
   for (i = 0; i < lemp->nstate; i++) {
     stp = lemp->sorted[i];
     stp->nTknAct = stp->nNtAct = 0;
     stp->iDflt = lemp->nstate + lemp->nrule;
     stp->iTknOfst = NO_OFFSET;
     stp->iNtOfst = NO_OFFSET;
-    for (ap = stp->actions; ap; ap = ap->next) {
-      if (compute_action(lemp, ap->item) >= 0) {
-        if (ap->item->sp->index < lemp->nterminal) {
+    dflt = 0;
+    for (ap = stp->actions; ap < stp->actions + stp->nAction; ap++) {
+      if (compute_action(lemp, ap) >= 0) {
+        if (ap->sp->index < lemp->nterminal) {
           stp->nTknAct++;
-        } else if (ap->item->sp->index < lemp->nsymbol) {
+        } else if (ap->sp->index < lemp->nsymbol) {
           stp->nNtAct++;
         } else {
-          stp->iDflt = compute_action(lemp, ap->item);
+          stp->iDflt = compute_action(lemp, ap);
+          if (ap->type == REDUCE)
+            dflt = ap->x.rp;
         }
       }
     }
+    stp->autoReduce = i > 0 && stp->nTknAct == 0 && stp->nNtAct == 0 && dflt && dflt->lhs != start;
   }
   qsort(&lemp->sorted[1], (size_t)(lemp->nstate - 1), sizeof(lemp->sorted[0]), stateResortCompare);
   for (i = 0; i < lemp->nstate; i++) {
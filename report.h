@@ -6,10 +6,12 @@
  */
 
 void Reprint(struct lemon *);
-void ReportOutput(struct lemon *);
+void ReportOutput(struct lemon *, int, int);
 void ReportTable(struct lemon *, int);
 void ReportHeader(struct lemon *);
 void CompressTables(struct lemon *);
+void BypassUnitRules(struct lemon *);
+void MinimizeStates(struct lemon *);
 void ResortStates(struct lemon *);
 
 #endif //_LEMON_REPORT_H_
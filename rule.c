@@ -10,3 +10,15 @@ struct rule_list *rule_list_insert(struct rule *rule, struct rule_list **list) {
     return new_list;
 }
 
+
+/* Reverse a list of rules in place and return its new head */
+struct rule_list *rule_list_reverse(struct rule_list *list) {
+    struct rule_list *prev = NULL, *next;
+    while (list) {
+        next = list->next;
+        list->next = prev;
+        prev = list;
+        list = next;
+    }
+    return prev;
+}
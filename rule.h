@@ -27,5 +27,6 @@ struct rule {
 };
 
 struct rule_list *rule_list_insert(struct rule *rule, struct rule_list **list);
+struct rule_list *rule_list_reverse(struct rule_list *list);
 
 #endif //_LEMON_RULE_H_
@@ -1,21 +1,22 @@
+#include "set.h"
+#include "context.h"
 #include "error.h"
+#include "lemon.h"
 
 #include <assert.h>
 #include <stdlib.h>
 
-static int size = 0;
-
 /* Set the set size */
 void
-SetSize(int n) {
-  size = n + 1;
+SetSize(struct lemon *lemp, int n) {
+  lemp->ctx->setsize = n + 1;
 }
 
 /* Allocate a new set */
 char *
-SetNew() {
+SetNew(struct lemon *lemp) {
   char *s;
-  s = (char *)calloc((size_t)size, 1);
+  s = (char *)calloc((size_t)lemp->ctx->setsize, 1);
   MemoryCheck(s);
   return s;
 }
@@ -30,9 +31,9 @@ SetFree(char *s) {
  * and FALSE if it was already there.
  */
 int
-SetAdd(char *s, int e) {
+SetAdd(struct lemon *lemp, char *s, int e) {
   int rv;
-  assert(e >= 0 && e < size);
+  assert(e >= 0 && e < lemp->ctx->setsize);
   rv = s[e];
   s[e] = 1;
   return !rv;
@@ -40,9 +41,10 @@ SetAdd(char *s, int e) {
 
 /* Add every element of s2 to s1.  Return TRUE if s1 changes. */
 int
-SetUnion(char *s1, char *s2) {
-  int i, progress;
+SetUnion(struct lemon *lemp, char *s1, char *s2) {
+  int i, size, progress;
   progress = 0;
+  size = lemp->ctx->setsize;
   for (i = 0; i < size; i++) {
     if (s2[i] == 0)
       continue;
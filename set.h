@@ -3,13 +3,16 @@
 
 /*
  * Set manipulation routines for the LEMON parser generator.
+ * The size of the sets is kept in the context of each run.
  */
 
-void SetSize(int);            // All sets will be of size N
-char *SetNew(void);           // A new set for element 0..N
-void SetFree(char *);         // Deallocate a set
-int SetAdd(char *, int);      // Add element to a set
-int SetUnion(char *, char *); // A <- A U B, thru element N
-#define SetFind(X, Y) (X[Y])  // True if Y is in set X
+struct lemon;
+
+void SetSize(struct lemon *, int);            // All sets will be of size N
+char *SetNew(struct lemon *);                 // A new set for element 0..N
+void SetFree(char *);                         // Deallocate a set
+int SetAdd(struct lemon *, char *, int);      // Add element to a set
+int SetUnion(struct lemon *, char *, char *); // A <- A U B, thru element N
+#define SetFind(X, Y) (X[Y])                  // True if Y is in set X
 
 #endif //_LEMON_SET_H_
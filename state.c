@@ -1,31 +1,37 @@
 #include "config.h"
+#include "context.h"
 #include "error.h"
+#include "lemon.h"
 #include "hash_table.h"
 #include "rule.h"
 #include "state.h"
-#include "hash.h"
 
+#include <assert.h>
 #include <stdlib.h>
 
-struct hash_table state_hash;
-
-static int compare_config_list(void const *left, void const *right);
+static int compare_basis(void const *left, void const *right);
 static void const *get_key_state(void const *obj);
 static unsigned int hash_state(void const *obj, unsigned int size);
 
+/* Return all states in an array indexed by their state numbers, which
+ * must run from 0 up without a gap
+ */
 struct state **
-array_of_state(unsigned int *size) {
+array_of_state(struct lemon *lemp, unsigned int *size) {
+    struct hash_table *state_hash = &lemp->ctx->states;
     struct state **array;
     unsigned int i = 0;
-    if (!state_hash.hash)
+    if (!state_hash->hash)
         return NULL;
-    array = (struct state **)calloc(state_hash.count, sizeof(struct state *));
+    array = (struct state **)calloc(state_hash->count, sizeof(struct state *));
     MemoryCheck(array);
     unsigned int h;
-    for (h = 0, i = 0; h < state_hash.size; h++) {
-        if (!state_hash.hash[h])
+    for (h = 0, i = 0; h < state_hash->size; h++) {
+        struct state *stp = state_hash->hash[h];
+        if (!stp)
             continue;
-        array[i] = state_hash.hash[h];
+        assert(stp->statenum >= 0 && (unsigned int)stp->statenum < state_hash->count);
+        array[stp->statenum] = stp;
         i++;
     }
     if (size)
@@ -33,55 +39,63 @@ array_of_state(unsigned int *size) {
     return array;
 }
 
+/* Return the state with the given sorted basis, or NULL.  The hash is
+ * the sum of the ruleposhash() of the basis configurations.
+ */
 struct state *
-lookup_state(struct config_list *key) {
-    return (struct state *)lookup_hash(key, get_key_state, compare_config_list, hash_state, &state_hash);
+lookup_state(struct lemon *lemp, struct config **basis, int nBasis, unsigned int hash) {
+    struct state key;
+    key.basis = basis;
+    key.nBasis = nBasis;
+    key.hash = hash;
+    return (struct state *)lookup_hash(&key, get_key_state, compare_basis, hash_state, &lemp->ctx->states);
 }
 
+/* Make a new state with the given sorted basis, which must not be in the
+ * table yet.  The state takes over the basis array.
+ */
 struct state *
-make_state(struct config_list *key) {
-    struct state *obj, *new_obj;
-    if (!key)
+make_state(struct lemon *lemp, struct config **basis, int nBasis, unsigned int hash) {
+    struct state *new_obj;
+    if (nBasis == 0)
         return NULL;
-    obj = lookup_state(key);
-    if (!obj && (new_obj = (struct state *)calloc(1, sizeof(struct state))) != NULL) {
-        struct config_list *configs;
-        new_obj->basis = key;
-        configs = config_list_closure(key); // Compute the configuration closure
-        config_list_sort(&configs);         // Sort the configuration closure
-        new_obj->configs = configs;         // Remember the configuration closure
-        insert_hash(new_obj, hash_state, &state_hash);
-        obj = new_obj;
-    }
-    MemoryCheck(obj);
-    return obj;
+    new_obj = (struct state *)calloc(1, sizeof(struct state));
+    MemoryCheck(new_obj);
+    new_obj->basis = basis;
+    new_obj->nBasis = nBasis;
+    new_obj->hash = hash;
+    new_obj->configs = config_closure(lemp, basis, nBasis, &new_obj->nConfig); // Compute the configuration closure
+    config_sort(new_obj->configs, new_obj->nConfig);                          // Sort the configuration closure
+    insert_hash(new_obj, hash_state, &lemp->ctx->states);
+    return new_obj;
 }
 
+/* Compare the basis configurations of two states, which are sorted,
+ * one after another.  States whose hashes or sizes differ are told
+ * apart without looking at the configurations.
+ */
 static int
-compare_config_list(void const *left, void const *right) {
-    struct config_list const *a = (struct config_list const *)left;
-    struct config_list const *b = (struct config_list const *)right;
-    int rc;
-    for (rc = 0; rc == 0 && a && b; a = a->next, b = b->next) {
-        rc = a->item->rule->index - b->item->rule->index;
+compare_basis(void const *left, void const *right) {
+    struct state const *a = (struct state const *)left;
+    struct state const *b = (struct state const *)right;
+    int i, rc;
+    if (a->hash != b->hash)
+        return a->hash < b->hash ? -1 : 1;
+    rc = a->nBasis - b->nBasis;
+    for (i = 0; rc == 0 && i < a->nBasis; i++) {
+        rc = a->basis[i]->rule->index - b->basis[i]->rule->index;
         if (rc == 0)
-            rc = a->item->position - b->item->position;
-    }
-    if (rc == 0) {
-        if (a)
-            rc = 1;
-        if (b)
-            rc = -1;
+            rc = a->basis[i]->position - b->basis[i]->position;
     }
     return rc;
 }
 
 static void const *
 get_key_state(void const *obj) {
-    return ((struct state *)obj)->basis;
+    return obj;
 }
 
 static unsigned int
 hash_state(void const *obj, unsigned int size) {
-    return configlisthash(((struct state const *) obj)->basis) & (size - 1);
+    return ((struct state const *)obj)->hash & (size - 1);
 }
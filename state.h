@@ -5,17 +5,25 @@
  * is encoded as an instance of the following structure.
  */
 struct state {
-    struct config_list *basis;   // The basis configurations for this state
-    struct config_list *configs; // All configurations in this set
+    struct config **basis;       // The basis configurations for this state, sorted
+    int nBasis;                  // Number of basis configurations
+    unsigned int hash;           // Sum of the ruleposhash() of the basis configurations
+    struct config **configs;     // All configurations in this set, sorted
+    int nConfig;                 // Number of configurations
     int statenum;                // Sequential number for this state
-    struct action_list *actions; // Array of actions for this state
+    struct action *actions;      // Array of actions for this state
+    int nAction;                 // Number of actions
+    int nActionAlloc;            // Number of slots allocated for actions
     int nTknAct, nNtAct;         // Number of actions on terminals and nonterminals
     int iTknOfst, iNtOfst;       // yy_action[] offset for terminals and nonterms
     int iDflt;                   // Default action
+    int autoReduce;              // True if the default reduce needs no look-ahead
 };
 
-struct state **array_of_state(unsigned int *size);
-struct state *lookup_state(struct config_list *key);
-struct state *make_state(struct config_list *key);
+struct lemon;
+
+struct state **array_of_state(struct lemon *lemp, unsigned int *size);
+struct state *lookup_state(struct lemon *lemp, struct config **basis, int nBasis, unsigned int hash);
+struct state *make_state(struct lemon *lemp, struct config **basis, int nBasis, unsigned int hash);
 
 #endif //_LEMON_STATE_H_
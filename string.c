@@ -1,13 +1,13 @@
 #include "string.h"
+#include "context.h"
 #include "hash_table.h"
 #include "error.h"
 #include "hash.h"
+#include "lemon.h"
 
 #include <string.h>
 #include <stdlib.h>
 
-struct hash_table string_hash;
-
 static void const *get_key_string(void const *obj);
 static unsigned int hash_string(void const *obj, unsigned int size);
 
@@ -17,14 +17,14 @@ compare_string(void const *left, void const *right) {
 }
 
 char const *
-make_string(char const *key) {
+make_string(struct lemon *lemp, char const *key) {
     char *obj, *new_obj;
     if (!key)
         return NULL;
-    obj = (char *)lookup_hash(key, get_key_string, compare_string, hash_string, &string_hash);
+    obj = (char *)lookup_hash(key, get_key_string, compare_string, hash_string, &lemp->ctx->strings);
     if (!obj && (new_obj = (char *)malloc(strlen(key) + 1)) != NULL) {
         strcpy(new_obj, key);
-        insert_hash(new_obj, hash_string, &string_hash);
+        insert_hash(new_obj, hash_string, &lemp->ctx->strings);
         obj = new_obj;
     }
     MemoryCheck(obj);
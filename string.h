@@ -1,7 +1,9 @@
 #ifndef _LEMON_STRING_H_
 #define _LEMON_STRING_H_
 
-char const *make_string(char const *key);
+struct lemon;
+
+char const *make_string(struct lemon *lemp, char const *key);
 
 int compare_string(void const *left, void const *right);
 
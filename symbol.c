@@ -1,30 +1,37 @@
 #include "symbol.h"
+#include "context.h"
 #include "hash_table.h"
 #include "error.h"
+#include "lemon.h"
 #include "string.h"
 #include "hash.h"
 
+#include <assert.h>
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 
-struct hash_table symbol_hash;
-
+static int compare_name(void const *left, void const *right);
 static void const *get_key_symbol(void const *obj);
 static unsigned int hash_symbol(void const *obj, unsigned int size);
 
+/* Return all symbols in an array, in the order they were made in */
 struct symbol **
-array_of_symbol(unsigned int *size) {
+array_of_symbol(struct lemon *lemp, unsigned int *size) {
+    struct hash_table *symbol_hash = &lemp->ctx->symbols;
     struct symbol **array;
     unsigned int i = 0;
-    if (!symbol_hash.hash)
+    if (!symbol_hash->hash)
         return NULL;
-    array = (struct symbol **)calloc(symbol_hash.count, sizeof(struct symbol *));
+    array = (struct symbol **)calloc(symbol_hash->count, sizeof(struct symbol *));
     MemoryCheck(array);
     unsigned int h;
-    for (h = 0, i = 0; h < symbol_hash.size; h++) {
-        if (!symbol_hash.hash[h])
+    for (h = 0, i = 0; h < symbol_hash->size; h++) {
+        struct symbol *sp = symbol_hash->hash[h];
+        if (!sp)
             continue;
-        array[i] = symbol_hash.hash[h];
+        assert(sp->index >= 0 && (unsigned int)sp->index < symbol_hash->count);
+        array[sp->index] = sp;
         i++;
     }
     if (size)
@@ -33,22 +40,25 @@ array_of_symbol(unsigned int *size) {
 }
 
 struct symbol *
-lookup_symbol(char const *key) {
-    return (struct symbol *)lookup_hash(key, get_key_symbol, compare_string, hash_symbol, &symbol_hash);
+lookup_symbol(struct lemon *lemp, char const *key) {
+    struct symbol key_symbol;
+    key_symbol.name = key;
+    return (struct symbol *)lookup_hash(&key_symbol, get_key_symbol, compare_name, hash_symbol, &lemp->ctx->symbols);
 }
 
 struct symbol *
-make_symbol(char const *key) {
+make_symbol(struct lemon *lemp, char const *key) {
     struct symbol *obj, *new_obj;
     if (!key)
         return NULL;
-    obj = lookup_symbol(key);
+    obj = lookup_symbol(lemp, key);
     if (!obj && (new_obj = (struct symbol *)calloc(1, sizeof(struct symbol))) != NULL) {
-        new_obj->name = make_string(key);
+        new_obj->name = make_string(lemp, key);
         new_obj->type = isupper(*key) ? TERMINAL : NONTERMINAL;
         new_obj->prec = -1;
         new_obj->assoc = UNKNOWN;
-        insert_hash(new_obj, hash_symbol, &symbol_hash);
+        new_obj->index = (int)lemp->ctx->symbols.count; // Until the symbols are sorted
+        insert_hash(new_obj, hash_symbol, &lemp->ctx->symbols);
         obj = new_obj;
     }
     MemoryCheck(obj);
@@ -56,9 +66,15 @@ make_symbol(char const *key) {
     return obj;
 }
 
+/* Compare the names of two symbols */
+static int
+compare_name(void const *left, void const *right) {
+    return strcmp(((struct symbol const *)left)->name, ((struct symbol const *)right)->name);
+}
+
 static void const *
 get_key_symbol(void const *obj) {
-    return ((struct symbol *)obj)->name;
+    return obj;
 }
 
 static unsigned int
@@ -0,0 +1,185 @@
+#include "template.h"
+#include "error.h"
+#include "output.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef __WIN32__
+#include <pthread.h>
+#endif
+
+/* Return true if a "Parse" prefix starts at z[i] */
+static int
+is_prefix(const char *z, size_t i) {
+  return z[i] == 'P' && strncmp(&z[i], "Parse", 5) == 0 && (i == 0 || !isalpha((unsigned char)z[i - 1]));
+}
+
+/* Find the "Parse" prefixes in every segment of a template whose
+ * segments are already filled in.
+ */
+static void
+find_prefixes(struct template *tp) {
+  int i, n, nAlloc;
+  size_t j;
+
+  n = nAlloc = 0;
+  tp->aSubst = 0;
+  for (i = 0; i < tp->nSegment; i++) {
+    struct template_segment *sp = &tp->aSegment[i];
+    sp->iSubst = n;
+    for (j = 0; j + 5 <= sp->n; j++) {
+      if (!is_prefix(sp->z, j))
+        continue;
+      if (n >= nAlloc) {
+        nAlloc = nAlloc * 2 + 16;
+        tp->aSubst = (size_t *)realloc(tp->aSubst, sizeof(tp->aSubst[0]) * (size_t)nAlloc);
+        MemoryCheck(tp->aSubst);
+      }
+      tp->aSubst[n++] = j;
+      j += 4;
+    }
+    sp->nSubst = n - sp->iSubst;
+  }
+}
+
+/* Set up a compiled-in template from its NULL-terminated segments */
+static void
+init_compiled(struct template *tp, const char *const *azSegment) {
+  int i;
+  for (tp->nSegment = 0; azSegment[tp->nSegment]; tp->nSegment++) {
+  }
+  tp->aSegment = (struct template_segment *)calloc((size_t)tp->nSegment, sizeof(tp->aSegment[0]));
+  MemoryCheck(tp->aSegment);
+  for (i = 0; i < tp->nSegment; i++) {
+    tp->aSegment[i].z = azSegment[i];
+    tp->aSegment[i].n = strlen(azSegment[i]);
+  }
+  tp->zText = 0;
+  find_prefixes(tp);
+}
+
+static struct template aDefault[2]; // lempar.c and lempar_glr.c
+
+static void
+init_defaults(void) {
+  init_compiled(&aDefault[0], template_lempar_c);
+  init_compiled(&aDefault[1], template_lempar_glr_c);
+}
+
+/* Return the compiled-in template of a plain or, if glr is true, of a
+ * GLR parser.  It is split the first time it is asked for and kept
+ * for the rest of the process.
+ */
+struct template *
+template_default(int glr) {
+#ifndef __WIN32__
+  static pthread_once_t once = PTHREAD_ONCE_INIT;
+  pthread_once(&once, init_defaults);
+#else
+  static int done = 0;
+  if (!done) {
+    init_defaults();
+    done = 1;
+  }
+#endif
+  return &aDefault[glr ? 1 : 0];
+}
+
+/* Read and split the template file zFilename.  Return NULL if the
+ * file cannot be read.
+ */
+struct template *
+template_read(const char *zFilename) {
+  struct template *tp;
+  FILE *in;
+  char *z;
+  long n;
+  size_t nText, i, iStart;
+  int nAlloc;
+
+  in = fopen(zFilename, "rb");
+  if (in == 0)
+    return 0;
+  if (fseek(in, 0, SEEK_END) != 0 || (n = ftell(in)) < 0 || fseek(in, 0, SEEK_SET) != 0) {
+    fclose(in);
+    return 0;
+  }
+  nText = (size_t)n;
+  z = (char *)malloc(nText + 1);
+  MemoryCheck(z);
+  if (fread(z, 1, nText, in) != nText) {
+    free(z);
+    fclose(in);
+    return 0;
+  }
+  fclose(in);
+  z[nText] = 0;
+
+  /* A segment ends where a line that begins with "%%" does, and the
+   * next one starts after that line.
+   */
+  tp = (struct template *)calloc(1, sizeof(*tp));
+  MemoryCheck(tp);
+  tp->zText = z;
+  nAlloc = 0;
+  iStart = 0;
+  for (i = 0;; i++) {
+    int isEnd = i == nText;
+    if (!isEnd && !(z[i] == '%' && z[i + 1] == '%' && (i == 0 || z[i - 1] == '\n')))
+      continue;
+    if (tp->nSegment >= nAlloc) {
+      nAlloc = nAlloc * 2 + 16;
+      tp->aSegment = (struct template_segment *)realloc(tp->aSegment, sizeof(tp->aSegment[0]) * (size_t)nAlloc);
+      MemoryCheck(tp->aSegment);
+    }
+    tp->aSegment[tp->nSegment].z = &z[iStart];
+    tp->aSegment[tp->nSegment].n = i - iStart;
+    tp->nSegment++;
+    if (isEnd)
+      break;
+    while (i < nText && z[i] != '\n')
+      i++;
+    iStart = i < nText ? i + 1 : i;
+  }
+  find_prefixes(tp);
+  return tp;
+}
+
+/* Release a template returned by template_read().  The compiled-in
+ * templates are left alone.
+ */
+void
+template_free(struct template *tp) {
+  if (tp == 0 || tp->zText == 0)
+    return;
+  free(tp->aSegment);
+  free(tp->aSubst);
+  free(tp->zText);
+  free(tp);
+}
+
+/* Write segment iSegment of a template, with every "Parse" prefix
+ * changed to zName unless zName is NULL.  There is nothing to write
+ * past the last segment.
+ */
+void
+template_xfer(struct output *out, struct template *tp, int iSegment, const char *zName) {
+  struct template_segment *sp;
+  size_t iStart = 0;
+  int i;
+
+  if (iSegment >= tp->nSegment)
+    return;
+  sp = &tp->aSegment[iSegment];
+  if (zName) {
+    for (i = 0; i < sp->nSubst; i++) {
+      size_t j = tp->aSubst[sp->iSubst + i];
+      output_write(out, &sp->z[iStart], j - iStart);
+      output_puts(out, zName);
+      iStart = j + 5;
+    }
+  }
+  output_write(out, &sp->z[iStart], sp->n - iStart);
+}
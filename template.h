@@ -0,0 +1,38 @@
+#ifndef _LEMON_TEMPLATE_H_
+#define _LEMON_TEMPLATE_H_
+
+#include <stddef.h>
+
+/*
+ * Driver templates of the LEMON parser generator.  A template is split
+ * once into the segments between its "%%" lines, and the places where a
+ * name replaces the "Parse" prefix are found up front, so that writing
+ * a segment out takes a few memcpy()s.  The default templates are
+ * compiled in; a template named with -T is read from its file.
+ */
+
+struct output;
+
+struct template_segment {
+  const char *z; // Text of the segment
+  size_t n;      // Length of the text
+  int iSubst;    // First entry of aSubst[] within this segment
+  int nSubst;    // Number of entries of aSubst[] within this segment
+};
+
+struct template {
+  struct template_segment *aSegment; // The segments, in order
+  int nSegment;                      // Number of segments
+  size_t *aSubst;                    // Offsets of "Parse" prefixes in their segments
+  char *zText;                       // Text read from a file, or NULL if compiled in
+};
+
+extern const char *const template_lempar_c[];     // Segments of lempar.c
+extern const char *const template_lempar_glr_c[]; // Segments of lempar_glr.c
+
+struct template *template_default(int);           // lempar.c, or lempar_glr.c if true
+struct template *template_read(const char *);     // Read a template file, NULL on error
+void template_free(struct template *);            // Release a template read from a file
+void template_xfer(struct output *, struct template *, int, const char *); // Write segment N
+
+#endif //_LEMON_TEMPLATE_H_
@@ -0,0 +1,2895 @@
+/* The default driver templates, lempar.c and lempar_glr.c, split into
+ * the segments between their "%%" lines.  Generated by mktemplates.sh;
+ * do not edit.
+ */
+#include "template.h"
+
+const char *const template_lempar_c[] = {
+  "/* Driver template for the LEMON parser generator.\n"
+  " * The author disclaims copyright to this source code.\n"
+  " */\n"
+  "#include <assert.h>\n"
+  "#include <stdlib.h>\n"
+  "\n"
+  "/* Make sure the INTERFACE macro is defined. */\n"
+  "#ifndef INTERFACE\n"
+  "#define INTERFACE 1\n"
+  "#endif\n"
+  "\n"
+  "/* Next is all token values, in a form suitable for use by makeheaders.\n"
+  " * This section will be null unless lemon is run with the -m switch.\n"
+  " */\n"
+  "/* These constants (all generated automatically by the parser generator)\n"
+  " * specify the various kinds of tokens (terminals) that the parser\n"
+  " * understands.\n"
+  " *\n"
+  " * Each symbol here is a terminal symbol in the grammar.\n"
+  " */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "/* The next thing included is series of defines which control\n"
+  " * various aspects of the generated parser.\n"
+  " *    YYCODETYPE         is the data type used for storing terminal\n"
+  " *                       and nonterminal numbers.  \"unsigned char\" is\n"
+  " *                       used if there are fewer than 250 terminals\n"
+  " *                       and nonterminals.  \"int\" is used otherwise.\n"
+  " *    YYNOCODE           is a number of type YYCODETYPE which corresponds\n"
+  " *                       to no legal terminal or nonterminal number.  This\n"
+  " *                       number is used to fill in empty slots of the hash\n"
+  " *                       table.\n"
+  " *    YYFALLBACK         If defined, this indicates that one or more tokens\n"
+  " *                       have fall-back values which should be used if the\n"
+  " *                       original value of the token will not parse.\n"
+  " *    YYTOKENCLASS       If defined, terminals are looked up in the action\n"
+  " *                       table by their class in yy_token_class[].\n"
+  " *    YYACTIONTYPE       is the data type used for storing terminal\n"
+  " *                       and nonterminal numbers.  \"unsigned char\" is\n"
+  " *                       used if there are fewer than 250 rules and\n"
+  " *                       states combined.  \"int\" is used otherwise.\n"
+  " *    ParseTOKENTYPE     is the data type used for minor tokens given\n"
+  " *                       directly to the parser from the tokenizer.\n"
+  " *    YYMINORTYPE        is the data type used for all minor tokens.\n"
+  " *                       This is typically a union of many types, one of\n"
+  " *                       which is ParseTOKENTYPE.  The entry in the union\n"
+  " *                       for base tokens is called \"yy0\".\n"
+  " *    YYMINORTYPES(X)    lists the number and type of every member of\n"
+  " *                       YYMINORTYPE, for ParseUnionReport().\n"
+  " *    YYBOXTYPES(X)      If defined, lists the types of the %boxed symbols.\n"
+  " *                       Their values are kept in a box arena, one box per\n"
+  " *                       stack entry, and YYMINORTYPE holds a pointer to\n"
+  " *                       the box in its \"yybox\" member.\n"
+  " *    YYSTACKDEPTH       is the maximum depth of the parser's stack.  If\n"
+  " *                       zero the stack is dynamically sized using realloc()\n"
+  " *    ParseARG_SDECL     A static variable declaration for the %extra_argument\n"
+  " *    ParseARG_PDECL     A parameter declaration for the %extra_argument\n"
+  " *    ParseARG_STORE     Code to store %extra_argument into yypParser\n"
+  " *    ParseARG_FETCH     Code to extract %extra_argument from yypParser\n"
+  " *    ParseARG_PARAM(X)  Passes X as the %extra_argument in a call to Parse\n"
+  " *    YYNSTATE           the combined number of states.\n"
+  " *    YYNRULE            the number of rules in the grammar\n"
+  " *    YYERRORSYMBOL      is the code number of the error symbol.  If not\n"
+  " *                       defined, then do no error processing.\n"
+  " *    YYSYNCTOKEN        is the code number of the %sync_token.  If\n"
+  " *                       defined, ParseParallel() is available when\n"
+  " *                       YYPARSEPOOL is also defined.\n"
+  " *    YYTABLEFILE        If defined, the parse tables are read at run time\n"
+  " *                       by ParseLoadTables() instead of compiled in.\n"
+  " *    YYTABLESIGNATURE   identifies the symbols and rules of the grammar\n"
+  " *                       that a table file must have been made from.\n"
+  " *    YYNTOKEN           the number of terminals.\n"
+  " */\n"
+  "\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "#ifndef NDEBUG\n"
+  "#include <stdio.h>\n"
+  "void ParseTrace(FILE *, char *);\n"
+  "void ParseUnionReport(FILE *);\n"
+  "#endif\n"
+  "void *ParseAlloc();\n"
+  "void ParseFree(void *);\n"
+  "void Parse(void *, int , ParseTOKENTYPE yyminor ParseARG_PDECL);\n"
+  "int ParseExpectedTokens(void *, int *, int);\n"
+  "#ifdef YYTABLEFILE\n"
+  "int ParseLoadTables(const char *);\n"
+  "void ParseUnloadTables(void);\n"
+  "#endif\n"
+  "\n"
+  "/* First off, code is included that follows the \"include\" declaration\n"
+  " * in the input grammar file.\n"
+  " */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "#ifdef YYBOXTYPES\n"
+  "#include <string.h>\n"
+  "\n"
+  "/* The box of a stack entry holds the value of a boxed symbol, so that\n"
+  " * a large type does not make every entry of the stack as large.\n"
+  " */\n"
+  "union yyBox {\n"
+  "#define YY_BOX_MEMBER(N, T) T yy##N;\n"
+  "  YYBOXTYPES(YY_BOX_MEMBER)\n"
+  "#undef YY_BOX_MEMBER\n"
+  "};\n"
+  "#endif\n"
+  "#define YY_NO_ACTION (YYNSTATE + YYNRULE + 2)\n"
+  "#define YY_ACCEPT_ACTION (YYNSTATE + YYNRULE + 1)\n"
+  "#define YY_ERROR_ACTION (YYNSTATE + YYNRULE)\n"
+  "\n"
+  "/* The yyzerominor constant is used to initialize instances of\n"
+  " * YYMINORTYPE objects to zero.\n"
+  " */\n"
+  "static const YYMINORTYPE yyzerominor = {0};\n"
+  "\n"
+  "/* Define the yytestcase() macro to be a no-op if is not already defined\n"
+  " * otherwise.\n"
+  " *\n"
+  " * Applications can choose to define yytestcase() in the %include section\n"
+  " * to a macro that can assist in verifying code coverage.  For production\n"
+  " * code the yytestcase() macro should be turned off.  But it is useful\n"
+  " * for testing.\n"
+  " */\n"
+  "#ifndef yytestcase\n"
+  "#define yytestcase(X)\n"
+  "#endif\n"
+  "\n"
+  "/* Next are the tables used to determine what action to take based on the\n"
+  " * current state and lookahead token.  These tables are used to implement\n"
+  " * functions that take a state number and lookahead value and return an\n"
+  " * action integer.\n"
+  " *\n"
+  " * Suppose the action integer is N.  Then the action is determined as\n"
+  " * follows\n"
+  " *\n"
+  " *   0 <= N < YYNSTATE                  Shift N.  That is, push the lookahead\n"
+  " *                                      token onto the stack and goto state N.\n"
+  " *\n"
+  " *   YYNSTATE <= N < YYNSTATE+YYNRULE   Reduce by rule N-YYNSTATE.\n"
+  " *\n"
+  " *   N == YYNSTATE+YYNRULE              A syntax error has occurred.\n"
+  " *\n"
+  " *   N == YYNSTATE+YYNRULE+1            The parser accepts its input.\n"
+  " *\n"
+  " *   N == YYNSTATE+YYNRULE+2            No such action.  Denotes unused\n"
+  " *                                      slots in the yy_action[] table.\n"
+  " *\n"
+  " * The action table is constructed as a single large table named yy_action[].\n"
+  " * Given state S and lookahead X, the action is computed as\n"
+  " *\n"
+  " *      yy_action[ yy_shift_ofst[S] + X ]\n"
+  " *\n"
+  " * If the index value yy_shift_ofst[S]+X is out of range or if the value\n"
+  " * yy_lookahead[yy_shift_ofst[S]+X] is not equal to X or if yy_shift_ofst[S]\n"
+  " * is equal to YY_SHIFT_USE_DFLT, it means that the action is not in the table\n"
+  " * and that yy_default[S] should be used instead.\n"
+  " *\n"
+  " * The formula above is for computing the action when the lookahead is\n"
+  " * a terminal symbol.  If the lookahead is a non-terminal (as occurs after\n"
+  " * a reduce action) then the yy_reduce_ofst[] array is used in place of\n"
+  " * the yy_shift_ofst[] array and YY_REDUCE_USE_DFLT is used in place of\n"
+  " * YY_SHIFT_USE_DFLT, and a goto that is not in the table is found in\n"
+  " * yy_goto_default[X-YYNTOKEN] instead of yy_default[S].\n"
+  " *\n"
+  " * The following are the tables generated in this section:\n"
+  " *\n"
+  " *  yy_action[]        A single table containing all actions.\n"
+  " *  yy_lookahead[]     A table containing the lookahead for each entry in\n"
+  " *                     yy_action.  Used to detect hash collisions.\n"
+  " *  yy_shift_ofst[]    For each state, the offset into yy_action for\n"
+  " *                     shifting terminals.\n"
+  " *  yy_reduce_ofst[]   For each state, the offset into yy_action for\n"
+  " *                     shifting non-terminals after a reduce.\n"
+  " *  yy_default[]       Default action for each state.\n"
+  " *  yy_goto_default[]  For each non-terminal, the state that most gotos on\n"
+  " *                     it lead to.  yy_action holds only the others.\n"
+  " *  yy_expected[]      Bitmaps of YY_EXPECTED_WORDS words of the terminals\n"
+  " *                     that states expect, for ParseExpectedTokens().\n"
+  " *  yy_expected_row[]  For each state, the number of its bitmap.\n"
+  " *  yy_token_class[]   For each terminal, the terminal whose actions it\n"
+  " *                     shares.  Only present if YYTOKENCLASS is defined.\n"
+  " *\n"
+  " * States numbered YY_MIN_AUTOREDUCE and up have no action but to reduce\n"
+  " * by the rule of yy_default[], which the parser does right after the\n"
+  " * shift into them unless YYNOEAGERREDUCE is defined.\n"
+  " */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "#ifdef YYTABLEFILE\n"
+  "/* The tables above are not compiled into this parser.  ParseLoadTables()\n"
+  " * reads them at run time from the binary file that \"lemon -b\" writes\n"
+  " * along with the parser, and the macros below stand for their parts.\n"
+  " *\n"
+  " * The file starts with the 8 bytes \"LEMONTBL\" and a header of the\n"
+  " * YYTBL_NWORD words numbered below.  Every table is an array of\n"
+  " * 32-bit integers at the offset from the start of the file given in\n"
+  " * the header, and the parser reads it where it lies.  All integers are\n"
+  " * in the byte order of the machine that ran lemon.  The token names\n"
+  " * come last, as offsets to NUL-terminated strings.\n"
+  " */\n"
+  "#include <stdio.h>\n"
+  "#include <string.h>\n"
+  "#ifndef __WIN32__\n"
+  "#include <fcntl.h>\n"
+  "#include <sys/mman.h>\n"
+  "#include <sys/stat.h>\n"
+  "#include <unistd.h>\n"
+  "#endif\n"
+  "\n"
+  "#define YYTBL_MAGIC \"LEMONTBL\"\n"
+  "#define YYTBL_VERSION 4\n"
+  "#define YYTBL_BYTEORDER 0x01020304\n"
+  "\n"
+  "enum {\n"
+  "  YYTBL_W_VERSION,       // YYTBL_VERSION\n"
+  "  YYTBL_W_BYTEORDER,     // YYTBL_BYTEORDER, as written by lemon\n"
+  "  YYTBL_W_SIGNATURE,     // YYTABLESIGNATURE of the grammar\n"
+  "  YYTBL_W_NOCODE,        // YYNOCODE\n"
+  "  YYTBL_W_NRULE,         // YYNRULE\n"
+  "  YYTBL_W_NSTATE,        // YYNSTATE\n"
+  "  YYTBL_W_NACTION,       // Entries in yy_action[] and yy_lookahead[]\n"
+  "  YYTBL_W_NSHIFT,        // Entries in yy_shift_ofst[]\n"
+  "  YYTBL_W_NREDUCE,       // Entries in yy_reduce_ofst[]\n"
+  "  YYTBL_W_SHIFT_DFLT,    // YY_SHIFT_USE_DFLT\n"
+  "  YYTBL_W_REDUCE_DFLT,   // YY_REDUCE_USE_DFLT\n"
+  "  YYTBL_W_MIN_AUTOREDUCE, // YY_MIN_AUTOREDUCE\n"
+  "  YYTBL_W_NTOKEN,        // Entries in yy_token_class[]\n"
+  "  YYTBL_W_NFALLBACK,     // Entries in yyFallback[]\n"
+  "  YYTBL_W_NEXPECTED,     // Number of bitmaps in yy_expected[]\n"
+  "  YYTBL_W_ACTION,        // Offset of yy_action[]\n"
+  "  YYTBL_W_LOOKAHEAD,     // Offset of yy_lookahead[]\n"
+  "  YYTBL_W_SHIFT_OFST,    // Offset of yy_shift_ofst[]\n"
+  "  YYTBL_W_REDUCE_OFST,   // Offset of yy_reduce_ofst[]\n"
+  "  YYTBL_W_DEFAULT,       // Offset of yy_default[]\n"
+  "  YYTBL_W_GOTO_DEFAULT,  // Offset of yy_goto_default[]\n"
+  "  YYTBL_W_EXPECTED,      // Offset of yy_expected[]\n"
+  "  YYTBL_W_EXPECTED_ROW,  // Offset of yy_expected_row[]\n"
+  "  YYTBL_W_TOKEN_CLASS,   // Offset of yy_token_class[]\n"
+  "  YYTBL_W_FALLBACK,      // Offset of yyFallback[]\n"
+  "  YYTBL_W_TOKEN_NAME,    // Offset of the YYNOCODE-1 offsets of the names\n"
+  "  YYTBL_W_SIZE,          // Size of the file in bytes, a multiple of 8\n"
+  "  YYTBL_W_CHECKSUM,      // FNV-1a hash of all other words after the magic\n"
+  "  YYTBL_NWORD\n"
+  "};\n"
+  "\n"
+  "/* The tables in use, and the file they came from */\n"
+  "static struct {\n"
+  "  char *pFile;                              // Content of the table file\n"
+  "  size_t nFile;                             // Size of the file in bytes\n"
+  "  int isMapped;                             // True if pFile is mapped, false if malloc()ed\n"
+  "  int nState;                               // YYNSTATE\n"
+  "  int nAction;                              // YY_ACTTAB_COUNT\n"
+  "  int nShift;                               // YY_SHIFT_COUNT+1\n"
+  "  int nReduce;                              // YY_REDUCE_COUNT+1\n"
+  "  int iShiftUseDflt;                        // YY_SHIFT_USE_DFLT\n"
+  "  int iReduceUseDflt;                       // YY_REDUCE_USE_DFLT\n"
+  "  int iMinAutoReduce;                       // YY_MIN_AUTOREDUCE\n"
+  "  int nFallback;                            // Entries in yyFallback[]\n"
+  "  const int *aAction;                       // yy_action[]\n"
+  "  const int *aLookahead;                    // yy_lookahead[]\n"
+  "  const int *aShiftOfst;                    // yy_shift_ofst[]\n"
+  "  const int *aReduceOfst;                   // yy_reduce_ofst[]\n"
+  "  const int *aDefault;                      // yy_default[]\n"
+  "  const int *aGotoDefault;                  // yy_goto_default[]\n"
+  "  const unsigned int *aExpected;            // yy_expected[]\n"
+  "  const int *aExpectedRow;                  // yy_expected_row[]\n"
+  "  const int *aTokenClass;                   // yy_token_class[]\n"
+  "  const int *aFallback;                     // yyFallback[]\n"
+  "#ifndef NDEBUG\n"
+  "  const char **azTokenName;                 // yyTokenName[]\n"
+  "#endif\n"
+  "} yyTables;\n"
+  "\n"
+  "#define YY_ACTTAB_COUNT (yyTables.nAction)\n"
+  "#define YY_SHIFT_USE_DFLT (yyTables.iShiftUseDflt)\n"
+  "#define YY_SHIFT_COUNT (yyTables.nShift - 1)\n"
+  "#define YY_REDUCE_USE_DFLT (yyTables.iReduceUseDflt)\n"
+  "#define YY_REDUCE_COUNT (yyTables.nReduce - 1)\n"
+  "#define YY_MIN_AUTOREDUCE (yyTables.iMinAutoReduce)\n"
+  "#define YY_FALLBACK_COUNT (yyTables.nFallback)\n"
+  "#define yy_action (yyTables.aAction)\n"
+  "#define yy_lookahead (yyTables.aLookahead)\n"
+  "#define yy_shift_ofst (yyTables.aShiftOfst)\n"
+  "#define yy_reduce_ofst (yyTables.aReduceOfst)\n"
+  "#define yy_default (yyTables.aDefault)\n"
+  "#define yy_goto_default (yyTables.aGotoDefault)\n"
+  "#define yy_expected (yyTables.aExpected)\n"
+  "#define yy_expected_row (yyTables.aExpectedRow)\n"
+  "#define YY_EXPECTED_WORDS ((YYNTOKEN + 31) / 32)\n"
+  "#define yy_token_class (yyTables.aTokenClass)\n"
+  "#define yyFallback (yyTables.aFallback)\n"
+  "#ifndef NDEBUG\n"
+  "#define yyTokenName (yyTables.azTokenName)\n"
+  "#endif\n"
+  "\n"
+  "/* Return a pointer to the n words of a table at offset iOfst of the\n"
+  " * file, or NULL if they are not all inside the file or not aligned.\n"
+  " */\n"
+  "static const int *\n"
+  "yyTableAt(const char *pFile, size_t nFile, unsigned int iOfst, size_t n) {\n"
+  "  if (iOfst % sizeof(int) != 0 || iOfst > nFile || n > (nFile - iOfst) / sizeof(int))\n"
+  "    return 0;\n"
+  "  return (const int *)&pFile[iOfst];\n"
+  "}\n"
+  "\n"
+  "/* Add the n words of a[] to the FNV-1a hash h */\n"
+  "static unsigned int\n"
+  "yyTableChecksum(unsigned int h, const unsigned int *a, size_t n) {\n"
+  "  size_t i;\n"
+  "  for (i = 0; i < n; i++)\n"
+  "    h = (h ^ a[i]) * 0x01000193;\n"
+  "  return h;\n"
+  "}\n"
+  "\n"
+  "/* Return true if all n values of a[] are between lwr and upr */\n"
+  "static int\n"
+  "yyTableInRange(const int *a, int n, int lwr, int upr) {\n"
+  "  int i;\n"
+  "  for (i = 0; i < n; i++) {\n"
+  "    if (a[i] < lwr || a[i] > upr)\n"
+  "      return 0;\n"
+  "  }\n"
+  "  return 1;\n"
+  "}\n"
+  "\n"
+  "/* Release the tables read by ParseLoadTables().  No parser may be\n"
+  " * used afterwards until tables are loaded again.\n"
+  " */\n"
+  "void\n"
+  "ParseUnloadTables(void) {\n"
+  "#ifndef NDEBUG\n"
+  "  free((void *)yyTables.azTokenName);\n"
+  "#endif\n"
+  "  if (yyTables.isMapped) {\n"
+  "#ifndef __WIN32__\n"
+  "    munmap(yyTables.pFile, yyTables.nFile);\n"
+  "#endif\n"
+  "  } else {\n"
+  "    free(yyTables.pFile);\n"
+  "  }\n"
+  "  memset(&yyTables, 0, sizeof(yyTables));\n"
+  "}\n"
+  "\n"
+  "/* Read the parse tables from the file zFile, which \"lemon -b\" made from\n"
+  " * this same grammar.  The file is mapped into memory where the system\n"
+  " * allows it, so processes that load the same file share its pages.\n"
+  " * Tables loaded before are released.  No parser may be running while\n"
+  " * the tables change.\n"
+  " *\n"
+  " * Outputs:\n"
+  " * 0 on success.  -1 if the file cannot be read or does not hold tables\n"
+  " * for this grammar, in which case the tables in use stay as they were.\n"
+  " */\n"
+  "int\n"
+  "ParseLoadTables(const char *zFile) {\n"
+  "  char *pFile = 0;\n"
+  "  size_t nFile = 0;\n"
+  "  int isMapped = 0;\n"
+  "  const unsigned int *aHdr;\n"
+  "  const int *aAction, *aLookahead, *aShiftOfst, *aReduceOfst, *aDefault, *aGotoDefault;\n"
+  "  const int *aExpected, *aExpectedRow;\n"
+  "  const int *aTokenClass, *aFallback, *aName;\n"
+  "  int nState, nAction, nShift, nReduce, nFallback, nExpected, nLast, i;\n"
+  "#ifndef NDEBUG\n"
+  "  const char **azTokenName;\n"
+  "#endif\n"
+  "\n"
+  "#ifndef __WIN32__\n"
+  "  {\n"
+  "    struct stat st;\n"
+  "    int fd = open(zFile, O_RDONLY);\n"
+  "    if (fd < 0)\n"
+  "      return -1;\n"
+  "    if (fstat(fd, &st) == 0 && st.st_size > 0) {\n"
+  "      nFile = (size_t)st.st_size;\n"
+  "      pFile = (char *)mmap(0, nFile, PROT_READ, MAP_SHARED, fd, 0);\n"
+  "      if (pFile == (char *)MAP_FAILED)\n"
+  "        pFile = 0;\n"
+  "      else\n"
+  "        isMapped = 1;\n"
+  "    }\n"
+  "    close(fd);\n"
+  "  }\n"
+  "#endif\n"
+  "  if (pFile == 0) {\n"
+  "    FILE *in = fopen(zFile, \"rb\");\n"
+  "    long n;\n"
+  "    if (in == 0)\n"
+  "      return -1;\n"
+  "    if (fseek(in, 0, SEEK_END) == 0 && (n = ftell(in)) > 0 && fseek(in, 0, SEEK_SET) == 0) {\n"
+  "      nFile = (size_t)n;\n"
+  "      pFile = (char *)malloc(nFile);\n"
+  "      if (pFile && fread(pFile, 1, nFile, in) != nFile) {\n"
+  "        free(pFile);\n"
+  "        pFile = 0;\n"
+  "      }\n"
+  "    }\n"
+  "    fclose(in);\n"
+  "    if (pFile == 0)\n"
+  "      return -1;\n"
+  "  }\n"
+  "\n"
+  "  /* Check that the file holds tables for this parser, undamaged, and\n"
+  "   * that nothing in them leads the parser outside of them.\n"
+  "   */\n"
+  "  aHdr = (const unsigned int *)yyTableAt(pFile, nFile, 8, YYTBL_NWORD);\n"
+  "  if (aHdr == 0 || memcmp(pFile, YYTBL_MAGIC, 8) != 0 || aHdr[YYTBL_W_VERSION] != YYTBL_VERSION ||\n"
+  "      aHdr[YYTBL_W_BYTEORDER] != YYTBL_BYTEORDER || aHdr[YYTBL_W_SIGNATURE] != YYTABLESIGNATURE ||\n"
+  "      aHdr[YYTBL_W_NOCODE] != YYNOCODE || aHdr[YYTBL_W_NRULE] != YYNRULE || aHdr[YYTBL_W_SIZE] != nFile ||\n"
+  "      aHdr[YYTBL_W_NTOKEN] != YYNTOKEN || nFile % 8 != 0 || pFile[nFile - 1] != 0 ||\n"
+  "      aHdr[YYTBL_W_CHECKSUM] != yyTableChecksum(yyTableChecksum(0x811c9dc5, aHdr, YYTBL_W_CHECKSUM),\n"
+  "                                                &aHdr[YYTBL_NWORD], nFile / 4 - 2 - YYTBL_NWORD)) {\n"
+  "    goto bad_file;\n"
+  "  }\n"
+  "  nState = (int)aHdr[YYTBL_W_NSTATE];\n"
+  "  nAction = (int)aHdr[YYTBL_W_NACTION];\n"
+  "  nShift = (int)aHdr[YYTBL_W_NSHIFT];\n"
+  "  nReduce = (int)aHdr[YYTBL_W_NREDUCE];\n"
+  "  nFallback = (int)aHdr[YYTBL_W_NFALLBACK];\n"
+  "  nExpected = (int)aHdr[YYTBL_W_NEXPECTED];\n"
+  "  if (nState <= 0 || nAction < 0 || nShift < 0 || nShift > nState || nReduce < 0 || nReduce > nState ||\n"
+  "      nFallback < 0 || nFallback > YYNTOKEN || nExpected <= 0 || nExpected > nState) {\n"
+  "    goto bad_file;\n"
+  "  }\n"
+  "  nLast = nState + YYNRULE + 2; // YY_NO_ACTION\n"
+  "  aAction = yyTableAt(pFile, nFile, aHdr[YYTBL_W_ACTION], nAction);\n"
+  "  aLookahead = yyTableAt(pFile, nFile, aHdr[YYTBL_W_LOOKAHEAD], nAction);\n"
+  "  aShiftOfst = yyTableAt(pFile, nFile, aHdr[YYTBL_W_SHIFT_OFST], nShift);\n"
+  "  aReduceOfst = yyTableAt(pFile, nFile, aHdr[YYTBL_W_REDUCE_OFST], nReduce);\n"
+  "  aDefault = yyTableAt(pFile, nFile, aHdr[YYTBL_W_DEFAULT], nState);\n"
+  "  aGotoDefault = yyTableAt(pFile, nFile, aHdr[YYTBL_W_GOTO_DEFAULT], YYNOCODE - 1 - YYNTOKEN);\n"
+  "  aExpected = yyTableAt(pFile, nFile, aHdr[YYTBL_W_EXPECTED], (size_t)nExpected * YY_EXPECTED_WORDS);\n"
+  "  aExpectedRow = yyTableAt(pFile, nFile, aHdr[YYTBL_W_EXPECTED_ROW], nState);\n"
+  "  aTokenClass = yyTableAt(pFile, nFile, aHdr[YYTBL_W_TOKEN_CLASS], YYNTOKEN);\n"
+  "  aFallback = yyTableAt(pFile, nFile, aHdr[YYTBL_W_FALLBACK], nFallback);\n"
+  "  aName = yyTableAt(pFile, nFile, aHdr[YYTBL_W_TOKEN_NAME], YYNOCODE - 1);\n"
+  "  if (aAction == 0 || aLookahead == 0 || aShiftOfst == 0 || aReduceOfst == 0 || aDefault == 0 || aGotoDefault == 0 ||\n"
+  "      aTokenClass == 0 || aFallback == 0 || aName == 0 || aExpected == 0 || aExpectedRow == 0 ||\n"
+  "      !yyTableInRange(aExpectedRow, nState, 0, nExpected - 1) ||\n"
+  "      !yyTableInRange(aAction, nAction, 0, nLast) || !yyTableInRange(aLookahead, nAction, 0, YYNOCODE - 1) ||\n"
+  "      !yyTableInRange(aDefault, nState, 0, nLast) || !yyTableInRange(aGotoDefault, YYNOCODE - 1 - YYNTOKEN, 0, nLast) ||\n"
+  "      !yyTableInRange(aTokenClass, YYNTOKEN, 0, YYNTOKEN - 1) ||\n"
+  "      !yyTableInRange(aFallback, nFallback, 0, YYNTOKEN - 1) ||\n"
+  "      !yyTableInRange(aName, YYNOCODE - 1, (int)aHdr[YYTBL_W_TOKEN_NAME] + 4 * (YYNOCODE - 1), (int)nFile - 1)) {\n"
+  "    goto bad_file;\n"
+  "  }\n"
+  "#ifndef NDEBUG\n"
+  "  azTokenName = (const char **)malloc((YYNOCODE - 1) * sizeof(azTokenName[0]));\n"
+  "  if (azTokenName == 0)\n"
+  "    goto bad_file;\n"
+  "  for (i = 0; i < YYNOCODE - 1; i++)\n"
+  "    azTokenName[i] = &pFile[aName[i]];\n"
+  "#endif\n"
+  "\n"
+  "  ParseUnloadTables();\n"
+  "  yyTables.pFile = pFile;\n"
+  "  yyTables.nFile = nFile;\n"
+  "  yyTables.isMapped = isMapped;\n"
+  "  yyTables.nState = nState;\n"
+  "  yyTables.nAction = nAction;\n"
+  "  yyTables.nShift = nShift;\n"
+  "  yyTables.nReduce = nReduce;\n"
+  "  yyTables.iShiftUseDflt = (int)aHdr[YYTBL_W_SHIFT_DFLT];\n"
+  "  yyTables.iReduceUseDflt = (int)aHdr[YYTBL_W_REDUCE_DFLT];\n"
+  "  yyTables.iMinAutoReduce = (int)aHdr[YYTBL_W_MIN_AUTOREDUCE];\n"
+  "  yyTables.nFallback = nFallback;\n"
+  "  yyTables.aAction = aAction;\n"
+  "  yyTables.aLookahead = aLookahead;\n"
+  "  yyTables.aShiftOfst = aShiftOfst;\n"
+  "  yyTables.aReduceOfst = aReduceOfst;\n"
+  "  yyTables.aDefault = aDefault;\n"
+  "  yyTables.aGotoDefault = aGotoDefault;\n"
+  "  yyTables.aExpected = (const unsigned int *)aExpected;\n"
+  "  yyTables.aExpectedRow = aExpectedRow;\n"
+  "  yyTables.aTokenClass = aTokenClass;\n"
+  "  yyTables.aFallback = aFallback;\n"
+  "#ifndef NDEBUG\n"
+  "  yyTables.azTokenName = azTokenName;\n"
+  "#endif\n"
+  "  return 0;\n"
+  "\n"
+  "bad_file:\n"
+  "  if (isMapped) {\n"
+  "#ifndef __WIN32__\n"
+  "    munmap(pFile, nFile);\n"
+  "#endif\n"
+  "  } else {\n"
+  "    free(pFile);\n"
+  "  }\n"
+  "  return -1;\n"
+  "}\n"
+  "#else\n"
+  "#define YY_FALLBACK_COUNT ((int)(sizeof(yyFallback) / sizeof(yyFallback[0])))\n"
+  "#endif /* YYTABLEFILE */\n"
+  "\n"
+  "/* States from YY_MIN_AUTOREDUCE on are reduced right after the shift\n"
+  " * into them, unless YYNOEAGERREDUCE is defined or there are none.\n"
+  " */\n"
+  "#ifndef YYNOEAGERREDUCE\n"
+  "#ifdef YYTABLEFILE\n"
+  "#define YYEAGERREDUCE 1\n"
+  "#else\n"
+  "#if YY_MIN_AUTOREDUCE < YYNSTATE\n"
+  "#define YYEAGERREDUCE 1\n"
+  "#endif\n"
+  "#endif\n"
+  "#endif\n"
+  "\n"
+  "/* The next table maps tokens into fallback tokens.  If a construct\n"
+  " * like the following:\n"
+  " *\n"
+  " *      %fallback ID X Y Z.\n"
+  " *\n"
+  " * appears in the grammar, then ID becomes a fallback token for X, Y,\n"
+  " * and Z.  Whenever one of the tokens X, Y, or Z is input to the parser\n"
+  " * but it does not parse, the type of the token is changed to ID and\n"
+  " * the parse is retried before an error is thrown.\n"
+  " */\n"
+  "#if defined(YYFALLBACK) && !defined(YYTABLEFILE)\n"
+  "static const YYCODETYPE yyFallback[] = {\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "};\n"
+  "#endif /* YYFALLBACK */\n"
+  "\n"
+  "/* The following structure represents a single element of the\n"
+  " * parser's stack.  Information stored includes:\n"
+  " *\n"
+  " *   +  The state number for the parser at this level of the stack.\n"
+  " *\n"
+  " *   +  The value of the token stored at this level of the stack.\n"
+  " *      (In other words, the \"major\" token.)\n"
+  " *\n"
+  " *   +  The semantic value stored at this level of the stack.  This is\n"
+  " *      the information used by the action routines in the grammar.\n"
+  " *      It is sometimes called the \"minor\" token.\n"
+  " */\n"
+  "struct yyStackEntry {\n"
+  "  YYACTIONTYPE stateno; // The state-number\n"
+  "  YYCODETYPE major;     // The major token value.  This is the code number for the token at this stack level\n"
+  "  YYMINORTYPE minor;    // The user-supplied minor token value.  This is the value of the token\n"
+  "};\n"
+  "typedef struct yyStackEntry yyStackEntry;\n"
+  "\n"
+  "/* The state of the parser is completely contained in an instance of\n"
+  " * the following structure\n"
+  " */\n"
+  "struct yyParser {\n"
+  "  int yyidx; // Index of top element in stack\n"
+  "#ifdef YYTRACKMAXSTACKDEPTH\n"
+  "  int yyidxMax; // Maximum value of yyidx\n"
+  "#endif\n"
+  "  int yyerrcnt;  // Shifts left before out of the error\n"
+  "  ParseARG_SDECL // A place to hold %extra_argument\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "  int yystksz;           // Current side of the stack\n"
+  "  yyStackEntry *yystack; // The parser's stack\n"
+  "#ifdef YYBOXTYPES\n"
+  "  int yynbox;            // Number of chunks of boxes\n"
+  "  union yyBox **yyboxes; // Chunks of YYBOXCHUNK boxes, which never move\n"
+  "#endif\n"
+  "#else\n"
+  "  yyStackEntry yystack[YYSTACKDEPTH]; // The parser's stack\n"
+  "#ifdef YYBOXTYPES\n"
+  "  union yyBox yybox[YYSTACKDEPTH + 1]; // The box of each stack entry, and one for a reduce\n"
+  "#endif\n"
+  "#endif\n"
+  "};\n"
+  "typedef struct yyParser yyParser;\n"
+  "\n"
+  "/* yyBoxAt(p, i) is the box of the i-th entry of the stack.  The box\n"
+  " * above the top of the stack holds the left-hand side of a reduce until\n"
+  " * the right-hand side is popped.\n"
+  " */\n"
+  "#ifdef YYBOXTYPES\n"
+  "#if YYSTACKDEPTH > 0\n"
+  "#define yyBoxAt(p, i) (&(p)->yybox[i])\n"
+  "#else\n"
+  "#define YYBOXCHUNK 64\n"
+  "#define yyBoxAt(p, i) (&(p)->yyboxes[(i) / YYBOXCHUNK][(i) % YYBOXCHUNK])\n"
+  "#endif\n"
+  "#endif\n"
+  "\n"
+  "#ifndef NDEBUG\n"
+  "static FILE *yyTraceFILE = 0;\n"
+  "static char *yyTracePrompt = 0;\n"
+  "\n"
+  "/* Turn parser tracing on by giving a stream to which to write the trace\n"
+  " * and a prompt to preface each trace message.  Tracing is turned off\n"
+  " * by making either argument NULL\n"
+  " *\n"
+  " * Inputs:\n"
+  " * <ul>\n"
+  " * <li> A FILE* to which trace output should be written.\n"
+  " *      If NULL, then tracing is turned off.\n"
+  " * <li> A prefix string written at the beginning of every\n"
+  " *      line of trace output.  If NULL, then tracing is\n"
+  " *      turned off.\n"
+  " * </ul>\n"
+  " *\n"
+  " * Outputs:\n"
+  " * None.\n"
+  " */\n"
+  "void\n"
+  "ParseTrace(FILE *TraceFILE, char *zTracePrompt) {\n"
+  "  yyTraceFILE = TraceFILE;\n"
+  "  yyTracePrompt = zTracePrompt;\n"
+  "  if (yyTraceFILE == 0)\n"
+  "    yyTracePrompt = 0;\n"
+  "  else if (yyTracePrompt == 0)\n"
+  "    yyTraceFILE = 0;\n"
+  "}\n"
+  "\n"
+  "/* Write the size of every member of the union of semantic values, to\n"
+  " * find the types that make each entry of the stack large.  A boxed type\n"
+  " * is listed with the size of its box, as the stack only holds a pointer\n"
+  " * to it.\n"
+  " */\n"
+  "void\n"
+  "ParseUnionReport(FILE *out) {\n"
+  "  static const struct {\n"
+  "    int iMember;       // The member is yy<iMember>\n"
+  "    const char *zType; // Its type, as declared in the grammar\n"
+  "    unsigned nByte;    // Size of the type\n"
+  "    int isBoxed;       // True if the value is kept in a box\n"
+  "  } aMember[] = {\n"
+  "#define YY_MEMBER(N, T) {N, #T, (unsigned)sizeof(T), 0},\n"
+  "    YYMINORTYPES(YY_MEMBER)\n"
+  "#undef YY_MEMBER\n"
+  "#ifdef YYBOXTYPES\n"
+  "#define YY_MEMBER(N, T) {N, #T, (unsigned)sizeof(T), 1},\n"
+  "    YYBOXTYPES(YY_MEMBER)\n"
+  "#undef YY_MEMBER\n"
+  "#endif\n"
+  "  };\n"
+  "  unsigned i;\n"
+  "  fprintf(out, \"YYMINORTYPE: %u bytes, stack entry: %u bytes\\n\", (unsigned)sizeof(YYMINORTYPE),\n"
+  "          (unsigned)sizeof(yyStackEntry));\n"
+  "  for (i = 0; i < sizeof(aMember) / sizeof(aMember[0]); i++) {\n"
+  "    const char *zNote = \"\";\n"
+  "    if (aMember[i].isBoxed)\n"
+  "      zNote = \"  (boxed)\";\n"
+  "    else if (aMember[i].nByte == sizeof(YYMINORTYPE))\n"
+  "      zNote = \"  (sets the size)\";\n"
+  "    fprintf(out, \"  yy%-5d %6u  %s%s\\n\", aMember[i].iMember, aMember[i].nByte, aMember[i].zType, zNote);\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "/* For tracing shifts, the names of all terminals and nonterminals\n"
+  " * are required.  The following table supplies these names\n"
+  " */\n"
+  "#ifndef YYTABLEFILE\n"
+  "static const char *const yyTokenName[] = {\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "};\n"
+  "#endif\n"
+  "\n"
+  "/* For tracing reduce actions, the names of all rules are required. */\n"
+  "static const char *const yyRuleName[] = {\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "};\n"
+  "#endif /* NDEBUG */\n"
+  "\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "/* Try to increase the size of the parser stack. */\n"
+  "static void\n"
+  "yyGrowStack(yyParser *p) {\n"
+  "  int newSize;\n"
+  "  yyStackEntry *pNew;\n"
+  "\n"
+  "  newSize = p->yystksz * 2 + 100;\n"
+  "#ifdef YYBOXTYPES\n"
+  "  /* The stack holds pointers to boxes, so they are added a chunk at a\n"
+  "   * time rather than moved.  There is one box more than stack entries.\n"
+  "   */\n"
+  "  while (p->yynbox <= newSize / YYBOXCHUNK) {\n"
+  "    union yyBox **aNew = realloc(p->yyboxes, (p->yynbox + 1) * sizeof(aNew[0]));\n"
+  "    if (aNew == 0)\n"
+  "      return;\n"
+  "    p->yyboxes = aNew;\n"
+  "    aNew[p->yynbox] = malloc(YYBOXCHUNK * sizeof(union yyBox));\n"
+  "    if (aNew[p->yynbox] == 0)\n"
+  "      return;\n"
+  "    p->yynbox++;\n"
+  "  }\n"
+  "#endif\n"
+  "  pNew = realloc(p->yystack, newSize * sizeof(pNew[0]));\n"
+  "  if (pNew) {\n"
+  "    p->yystack = pNew;\n"
+  "    p->yystksz = newSize;\n"
+  "#ifndef NDEBUG\n"
+  "    if (yyTraceFILE) {\n"
+  "      fprintf(yyTraceFILE, \"%sStack grows to %d entries!\\n\", yyTracePrompt, p->yystksz);\n"
+  "    }\n"
+  "#endif\n"
+  "  }\n"
+  "}\n"
+  "#endif\n"
+  "\n"
+  "/* This function allocates a new parser.\n"
+  " * The only argument is a pointer to a function which works like\n"
+  " * malloc.\n"
+  " *\n"
+  " * Inputs:\n"
+  " * A pointer to the function used to allocate memory.\n"
+  " *\n"
+  " * Outputs:\n"
+  " * A pointer to a parser.  This pointer is used in subsequent calls\n"
+  " * to Parse and ParseFree.\n"
+  " */\n"
+  "void *\n"
+  "ParseAlloc() {\n"
+  "  yyParser *pParser;\n"
+  "  pParser = (yyParser *)malloc((size_t)sizeof(yyParser));\n"
+  "  if (pParser) {\n"
+  "    pParser->yyidx = -1;\n"
+  "#ifdef YYTRACKMAXSTACKDEPTH\n"
+  "    pParser->yyidxMax = 0;\n"
+  "#endif\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "    pParser->yystack = NULL;\n"
+  "    pParser->yystksz = 0;\n"
+  "#ifdef YYBOXTYPES\n"
+  "    pParser->yyboxes = NULL;\n"
+  "    pParser->yynbox = 0;\n"
+  "#endif\n"
+  "    yyGrowStack(pParser);\n"
+  "#endif\n"
+  "  }\n"
+  "  return pParser;\n"
+  "}\n"
+  "\n"
+  "/* The following function deletes the value associated with a\n"
+  " * symbol.  The symbol can be either a terminal or nonterminal.\n"
+  " * \"yymajor\" is the symbol code, and \"yypminor\" is a pointer to\n"
+  " * the value.\n"
+  " */\n"
+  "static void\n"
+  "yy_destructor(yyParser *yypParser,  // The parser\n"
+  "              YYCODETYPE yymajor,   // Type code for object to destroy\n"
+  "              YYMINORTYPE *yypminor // The object to be destroyed\n"
+  "              ) {\n"
+  "  ParseARG_FETCH;\n"
+  "  switch (yymajor) {\n"
+  "    /* Here is inserted the actions which take place when a\n"
+  "     * terminal or non-terminal is destroyed.  This can happen\n"
+  "     * when the symbol is popped from the stack during a\n"
+  "     * reduce or during error processing or when a parser is\n"
+  "     * being destroyed before it is finished parsing.\n"
+  "     *\n"
+  "     * Note: during a reduce, the only symbols destroyed are those\n"
+  "     * which appear on the RHS of the rule, but which are not used\n"
+  "     * inside the C code.\n"
+  "     */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "    default : break; // If no destructor action specified: do nothing\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "/* Pop the parser's stack once.\n"
+  " *\n"
+  " * If there is a destructor routine associated with the token which\n"
+  " * is popped from the stack, then call it.\n"
+  " *\n"
+  " * Return the major token number for the symbol popped.\n"
+  " */\n"
+  "static int\n"
+  "yy_pop_parser_stack(yyParser *pParser) {\n"
+  "  YYCODETYPE yymajor;\n"
+  "  yyStackEntry *yytos = &pParser->yystack[pParser->yyidx];\n"
+  "\n"
+  "  if (pParser->yyidx < 0)\n"
+  "    return 0;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE && pParser->yyidx >= 0) {\n"
+  "    fprintf(yyTraceFILE, \"%sPopping %s\\n\", yyTracePrompt, yyTokenName[yytos->major]);\n"
+  "  }\n"
+  "#endif\n"
+  "  yymajor = yytos->major;\n"
+  "  yy_destructor(pParser, yymajor, &yytos->minor);\n"
+  "  pParser->yyidx--;\n"
+  "  return yymajor;\n"
+  "}\n"
+  "\n"
+  "/* Deallocate and destroy a parser.  Destructors are all called for\n"
+  " * all stack elements before shutting the parser down.\n"
+  " *\n"
+  " * Inputs:\n"
+  " * <ul>\n"
+  " * <li>  A pointer to the parser.  This should be a pointer\n"
+  " *       obtained from ParseAlloc.\n"
+  " * <li>  A pointer to a function used to reclaim memory obtained\n"
+  " *       from malloc.\n"
+  " * </ul>\n"
+  " */\n"
+  "void\n"
+  "ParseFree(void *p) {\n"
+  "  yyParser *pParser = (yyParser *)p;\n"
+  "  if (pParser == 0)\n"
+  "    return;\n"
+  "  while (pParser->yyidx >= 0)\n"
+  "    yy_pop_parser_stack(pParser);\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "  free(pParser->yystack);\n"
+  "#ifdef YYBOXTYPES\n"
+  "  while (pParser->yynbox > 0)\n"
+  "    free(pParser->yyboxes[--pParser->yynbox]);\n"
+  "  free(pParser->yyboxes);\n"
+  "#endif\n"
+  "#endif\n"
+  "  free((void *)pParser);\n"
+  "}\n"
+  "\n"
+  "/* Return the peak depth of the stack for a parser. */\n"
+  "#ifdef YYTRACKMAXSTACKDEPTH\n"
+  "int\n"
+  "ParseStackPeak(void *p) {\n"
+  "  yyParser *pParser = (yyParser *)p;\n"
+  "  return pParser->yyidxMax;\n"
+  "}\n"
+  "#endif\n"
+  "\n"
+  "/* Write the codes of up to nToken of the terminals that the parser\n"
+  " * expects next to aToken[], in increasing order, and return how many\n"
+  " * it expects in all.  Called from %syntax_error, these are the tokens\n"
+  " * that would have been accepted in place of the one in error.\n"
+  " */\n"
+  "int\n"
+  "ParseExpectedTokens(void *p, int *aToken, int nToken) {\n"
+  "  yyParser *pParser = (yyParser *)p;\n"
+  "  const unsigned int *aWord;\n"
+  "  unsigned int w;\n"
+  "  int stateno, i, j, n;\n"
+  "\n"
+  "  stateno = pParser->yyidx >= 0 ? pParser->yystack[pParser->yyidx].stateno : 0;\n"
+  "  aWord = &yy_expected[yy_expected_row[stateno] * YY_EXPECTED_WORDS];\n"
+  "  n = 0;\n"
+  "  for (i = 0; i < YY_EXPECTED_WORDS; i++) {\n"
+  "    for (w = aWord[i], j = 0; w; w >>= 1, j++) {\n"
+  "      if (w & 1) {\n"
+  "        if (n < nToken)\n"
+  "          aToken[n] = i * 32 + j;\n"
+  "        n++;\n"
+  "      }\n"
+  "    }\n"
+  "  }\n"
+  "  return n;\n"
+  "}\n"
+  "\n"
+  "/* Find the appropriate action for a parser given the terminal\n"
+  " * look-ahead token iLookAhead, or rather its class in yy_token_class[].\n"
+  " *\n"
+  " * If the look-ahead token is YYNOCODE, then check to see if the action is\n"
+  " * independent of the look-ahead.  If it is, return the action, otherwise\n"
+  " * return YY_NO_ACTION.\n"
+  " */\n"
+  "static int\n"
+  "yy_find_shift_action(yyParser *pParser,    // The parser\n"
+  "                     YYCODETYPE iLookAhead // The look-ahead token\n"
+  "                     ) {\n"
+  "  int i;\n"
+  "  int stateno = pParser->yystack[pParser->yyidx].stateno;\n"
+  "\n"
+  "  if (stateno > YY_SHIFT_COUNT || (i = yy_shift_ofst[stateno]) == YY_SHIFT_USE_DFLT) {\n"
+  "    return yy_default[stateno];\n"
+  "  }\n"
+  "  assert(iLookAhead != YYNOCODE);\n"
+  "  i += iLookAhead;\n"
+  "  if (i < 0 || i >= YY_ACTTAB_COUNT || yy_lookahead[i] != iLookAhead) {\n"
+  "    if (iLookAhead > 0) {\n"
+  "#ifdef YYFALLBACK\n"
+  "      YYCODETYPE iFallback; // Fallback token\n"
+  "      if (iLookAhead < YY_FALLBACK_COUNT && (iFallback = yyFallback[iLookAhead]) != 0) {\n"
+  "#ifndef NDEBUG\n"
+  "        if (yyTraceFILE) {\n"
+  "          fprintf(yyTraceFILE, \"%sFALLBACK %s => %s\\n\", yyTracePrompt, yyTokenName[iLookAhead], yyTokenName[iFallback]);\n"
+  "        }\n"
+  "#endif\n"
+  "        return yy_find_shift_action(pParser, iFallback);\n"
+  "      }\n"
+  "#endif\n"
+  "#ifdef YYWILDCARD\n"
+  "      {\n"
+  "        int j = i - iLookAhead + YYWILDCARD;\n"
+  "        if (\n"
+  "#if defined(YYTABLEFILE) || YY_SHIFT_MIN + YYWILDCARD < 0\n"
+  "            j >= 0 &&\n"
+  "#endif\n"
+  "#ifdef YYTABLEFILE\n"
+  "            j < YY_ACTTAB_COUNT &&\n"
+  "#else\n"
+  "#if YY_SHIFT_MAX + YYWILDCARD >= YY_ACTTAB_COUNT\n"
+  "            j < YY_ACTTAB_COUNT &&\n"
+  "#endif\n"
+  "#endif\n"
+  "            yy_lookahead[j] == YYWILDCARD) {\n"
+  "#ifndef NDEBUG\n"
+  "          if (yyTraceFILE) {\n"
+  "            fprintf(yyTraceFILE, \"%sWILDCARD %s => %s\\n\", yyTracePrompt, yyTokenName[iLookAhead],\n"
+  "                    yyTokenName[YYWILDCARD]);\n"
+  "          }\n"
+  "#endif /* NDEBUG */\n"
+  "          return yy_action[j];\n"
+  "        }\n"
+  "      }\n"
+  "#endif /* YYWILDCARD */\n"
+  "    }\n"
+  "    return yy_default[stateno];\n"
+  "  } else {\n"
+  "    return yy_action[i];\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "/* Find the appropriate action for a parser given the non-terminal\n"
+  " * look-ahead token iLookAhead.\n"
+  " *\n"
+  " * If the look-ahead token is YYNOCODE, then check to see if the action is\n"
+  " * independent of the look-ahead.  If it is, return the action, otherwise\n"
+  " * return YY_NO_ACTION.  A goto that yy_action[] leaves out is the default\n"
+  " * of its non-terminal.\n"
+  " */\n"
+  "static int\n"
+  "yy_find_reduce_action(int stateno,          // Current state number\n"
+  "                      YYCODETYPE iLookAhead // The look-ahead token\n"
+  "                      ) {\n"
+  "  int i;\n"
+  "  assert(iLookAhead != YYNOCODE);\n"
+  "  if (stateno <= YY_REDUCE_COUNT && yy_reduce_ofst[stateno] != YY_REDUCE_USE_DFLT) {\n"
+  "    i = yy_reduce_ofst[stateno] + iLookAhead;\n"
+  "    if (i >= 0 && i < YY_ACTTAB_COUNT && yy_lookahead[i] == iLookAhead) {\n"
+  "      return yy_action[i];\n"
+  "    }\n"
+  "  }\n"
+  "#ifdef YYERRORSYMBOL\n"
+  "  if (iLookAhead == YYERRORSYMBOL) {\n"
+  "    return yy_default[stateno];\n"
+  "  }\n"
+  "#endif\n"
+  "  assert(iLookAhead >= YYNTOKEN);\n"
+  "  return yy_goto_default[iLookAhead - YYNTOKEN];\n"
+  "}\n"
+  "\n"
+  "/* The following routine is called if the stack overflows. */\n"
+  "static void\n"
+  "yyStackOverflow(yyParser *yypParser, YYMINORTYPE *yypMinor) {\n"
+  "  ParseARG_FETCH;\n"
+  "  yypParser->yyidx--;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sStack Overflow!\\n\", yyTracePrompt);\n"
+  "  }\n"
+  "#endif\n"
+  "  while (yypParser->yyidx >= 0)\n"
+  "    yy_pop_parser_stack(yypParser);\n"
+  "  /* Here code is inserted which will execute if the parser\n"
+  "   * stack every overflows */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  ParseARG_STORE; // Suppress warning about unused %extra_argument var\n"
+  "}\n"
+  "\n"
+  "/* Perform a shift action. */\n"
+  "static void\n"
+  "yy_shift(yyParser *yypParser,  // The parser to be shifted\n"
+  "         int yyNewState,       // The new state to shift in\n"
+  "         int yyMajor,          // The major token to shift in\n"
+  "         YYMINORTYPE *yypMinor // Pointer to the minor token to shift in\n"
+  "         ) {\n"
+  "  yyStackEntry *yytos;\n"
+  "  yypParser->yyidx++;\n"
+  "#ifdef YYTRACKMAXSTACKDEPTH\n"
+  "  if (yypParser->yyidx > yypParser->yyidxMax) {\n"
+  "    yypParser->yyidxMax = yypParser->yyidx;\n"
+  "  }\n"
+  "#endif\n"
+  "#if YYSTACKDEPTH > 0\n"
+  "  if (yypParser->yyidx >= YYSTACKDEPTH) {\n"
+  "    yyStackOverflow(yypParser, yypMinor);\n"
+  "    return;\n"
+  "  }\n"
+  "#else\n"
+  "  if (yypParser->yyidx >= yypParser->yystksz) {\n"
+  "    yyGrowStack(yypParser);\n"
+  "    if (yypParser->yyidx >= yypParser->yystksz) {\n"
+  "      yyStackOverflow(yypParser, yypMinor);\n"
+  "      return;\n"
+  "    }\n"
+  "  }\n"
+  "#endif\n"
+  "  yytos = &yypParser->yystack[yypParser->yyidx];\n"
+  "  yytos->stateno = (YYACTIONTYPE)yyNewState;\n"
+  "  yytos->major = (YYCODETYPE)yyMajor;\n"
+  "  yytos->minor = *yypMinor;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE && yypParser->yyidx > 0) {\n"
+  "    int i;\n"
+  "    fprintf(yyTraceFILE, \"%sShift %d\\n\", yyTracePrompt, yyNewState);\n"
+  "    fprintf(yyTraceFILE, \"%sStack:\", yyTracePrompt);\n"
+  "    for (i = 1; i <= yypParser->yyidx; i++)\n"
+  "      fprintf(yyTraceFILE, \" %s\", yyTokenName[yypParser->yystack[i].major]);\n"
+  "    fprintf(yyTraceFILE, \"\\n\");\n"
+  "  }\n"
+  "#endif\n"
+  "}\n"
+  "\n"
+  "/* The following table contains information about every rule that\n"
+  " * is used during the reduce.  It is compiled in even with YYTABLEFILE,\n"
+  " * since the code of the rules below depends on it.\n"
+  " */\n"
+  "static const struct {\n"
+  "  YYCODETYPE lhs;     // Symbol on the left-hand side of the rule\n"
+  "  unsigned char nrhs; // Number of right-hand side symbols in the rule\n"
+  "} yyRuleInfo[] = {\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "};\n"
+  "\n"
+  "static void yy_accept(yyParser *); // Forward Declaration\n"
+  "\n"
+  "/* Perform a reduce action and the shift that must immediately\n"
+  " * follow the reduce.\n"
+  " */\n"
+  "static void\n"
+  "yy_reduce(yyParser *yypParser, // The parser\n"
+  "          int yyruleno         // Number of the rule by which to reduce\n"
+  "          ) {\n"
+  "  int yygoto;              // The next state\n"
+  "  int yyact;               // The next action\n"
+  "  YYMINORTYPE yygotominor; // The LHS of the rule reduced\n"
+  "  yyStackEntry *yymsp;     // The top of the parser's stack\n"
+  "  int yysize;              // Amount to pop the stack\n"
+  "  ParseARG_FETCH;\n"
+  "  yymsp = &yypParser->yystack[yypParser->yyidx];\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE && yyruleno >= 0 && yyruleno < (int)(sizeof(yyRuleName) / sizeof(yyRuleName[0]))) {\n"
+  "    fprintf(yyTraceFILE, \"%sReduce [%s].\\n\", yyTracePrompt, yyRuleName[yyruleno]);\n"
+  "  }\n"
+  "#endif /* NDEBUG */\n"
+  "\n"
+  "  /* Silence complaints from purify about yygotominor being uninitialized\n"
+  "   * in some cases when it is copied into the stack after the following\n"
+  "   * switch.  yygotominor is uninitialized when a rule reduces that does\n"
+  "   * not set the value of its left-hand side nonterminal.  Leaving the\n"
+  "   * value of the nonterminal uninitialized is utterly harmless as long\n"
+  "   * as the value is never used.  So really the only thing this code\n"
+  "   * accomplishes is to quieten purify.\n"
+  "   *\n"
+  "   * 2007-01-16:  The wireshark project (www.wireshark.org) reports that\n"
+  "   * without this code, their parser segfaults.  I'm not sure what there\n"
+  "   * parser is doing to make this happen.  This is the second bug report\n"
+  "   * from wireshark this week.  Clearly they are stressing Lemon in ways\n"
+  "   * that it has not been previously stressed...  (SQLite ticket #2172)\n"
+  "   */\n"
+  "  yygotominor = yyzerominor;\n"
+  "#ifdef YYBOXTYPES\n"
+  "  /* A boxed left-hand side is built in the box above the top of the\n"
+  "   * stack.  The action moves it down once the right-hand side is done.\n"
+  "   * The box still holds whatever was built in it last, so it is zeroed\n"
+  "   * here as yygotominor is above.\n"
+  "   */\n"
+  "  yygotominor.yybox = yyBoxAt(yypParser, yypParser->yyidx + 1);\n"
+  "  memset(yygotominor.yybox, 0, sizeof(*yygotominor.yybox));\n"
+  "#endif\n"
+  "\n"
+  "  switch (yyruleno) {\n"
+  "    /* Beginning here are the reduction cases.  A typical example\n"
+  "     * follows:\n"
+  "     *   case 0:\n"
+  "     *  #line <lineno> <grammarfile>\n"
+  "     *     { ... }           // User supplied code\n"
+  "     *  #line <lineno> <thisfile>\n"
+  "     *     break;\n"
+  "     */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  };\n"
+  "  yygoto = yyRuleInfo[yyruleno].lhs;\n"
+  "  yysize = yyRuleInfo[yyruleno].nrhs;\n"
+  "  yypParser->yyidx -= yysize;\n"
+  "  yyact = yy_find_reduce_action(yymsp[-yysize].stateno, (YYCODETYPE)yygoto);\n"
+  "  if (yyact < YYNSTATE) {\n"
+  "#ifdef NDEBUG\n"
+  "    /* If we are not debugging and the reduce action popped at least\n"
+  "     * one element off the stack, then we can push the new element back\n"
+  "     * onto the stack here, and skip the stack overflow test in yy_shift().\n"
+  "     * That gives a significant speed improvement.\n"
+  "     */\n"
+  "    if (yysize) {\n"
+  "      yypParser->yyidx++;\n"
+  "      yymsp -= yysize - 1;\n"
+  "      yymsp->stateno = (YYACTIONTYPE)yyact;\n"
+  "      yymsp->major = (YYCODETYPE)yygoto;\n"
+  "      yymsp->minor = yygotominor;\n"
+  "    } else\n"
+  "#endif\n"
+  "    {\n"
+  "      yy_shift(yypParser, yyact, yygoto, &yygotominor);\n"
+  "    }\n"
+  "  } else {\n"
+  "    assert(yyact == YYNSTATE + YYNRULE + 1);\n"
+  "    yy_accept(yypParser);\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "/* The following code executes when the parse fails */\n"
+  "#ifndef YYNOERRORRECOVERY\n"
+  "static void\n"
+  "yy_parse_failed(yyParser *yypParser // The parser\n"
+  "                ) {\n"
+  "  ParseARG_FETCH;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sFail!\\n\", yyTracePrompt);\n"
+  "  }\n"
+  "#endif\n"
+  "  while (yypParser->yyidx >= 0)\n"
+  "    yy_pop_parser_stack(yypParser);\n"
+  "  /* Here code is inserted which will be executed whenever the\n"
+  "   * parser fails\n"
+  "   */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  ParseARG_STORE; // Suppress warning about unused %extra_argument variable\n"
+  "}\n"
+  "#endif /* YYNOERRORRECOVERY */\n"
+  "\n"
+  "/* The following code executes when a syntax error first occurs. */\n"
+  "static void\n"
+  "yy_syntax_error(yyParser *yypParser, // The parser\n"
+  "                int yymajor,         // The major type of the error token\n"
+  "                YYMINORTYPE yyminor  // The minor type of the error token\n"
+  "                ) {\n"
+  "  ParseARG_FETCH;\n"
+  "#define TOKEN (yyminor.yy0)\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  ParseARG_STORE; // Suppress warning about unused %extra_argument variable\n"
+  "}\n"
+  "\n"
+  "/* The following is executed when the parser accepts */\n"
+  "static void\n"
+  "yy_accept(yyParser *yypParser // The parser\n"
+  "          ) {\n"
+  "  ParseARG_FETCH;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sAccept!\\n\", yyTracePrompt);\n"
+  "  }\n"
+  "#endif\n"
+  "  while (yypParser->yyidx >= 0)\n"
+  "    yy_pop_parser_stack(yypParser);\n"
+  "  /* Here code is inserted which will be executed whenever the\n"
+  "   * parser accepts\n"
+  "   */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  ParseARG_STORE; // Suppress warning about unused %extra_argument variable\n"
+  "}\n"
+  "\n"
+  "/* The main parser program.\n"
+  " * The first argument is a pointer to a structure obtained from\n"
+  " * \"ParseAlloc\" which describes the current state of the parser.\n"
+  " * The second argument is the major token number.  The third is\n"
+  " * the minor token.  The fourth optional argument is whatever the\n"
+  " * user wants (and specified in the grammar) and is available for\n"
+  " * use by the action routines.\n"
+  " *\n"
+  " * Inputs:\n"
+  " * <ul>\n"
+  " * <li> A pointer to the parser (an opaque structure.)\n"
+  " * <li> The major token number.\n"
+  " * <li> The minor token number.\n"
+  " * <li> An option argument of a grammar-specified type.\n"
+  " * </ul>\n"
+  " *\n"
+  " * Outputs:\n"
+  " * None.\n"
+  " */\n"
+  "void\n"
+  "Parse(void *yyp,             // The parser\n"
+  "      int yymajor,           // The major token code number\n"
+  "      ParseTOKENTYPE yyminor // The value for the token\n"
+  "      ParseARG_PDECL         // Optional %extra_argument parameter\n"
+  "      ) {\n"
+  "  YYMINORTYPE yyminorunion;\n"
+  "  int yyact;        // The parser action.\n"
+  "  int yyendofinput; // True if we are at the end of input\n"
+  "  int yyclass;      // The column of yymajor in the action table\n"
+  "#ifdef YYERRORSYMBOL\n"
+  "  int yyerrorhit = 0; // True if yymajor has invoked an error\n"
+  "#endif\n"
+  "  yyParser *yypParser; // The parser\n"
+  "\n"
+  "  /* (re)initialize the parser, if necessary */\n"
+  "  yypParser = (yyParser *)yyp;\n"
+  "  if (yypParser->yyidx < 0) {\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "    if (yypParser->yystksz <= 0) {\n"
+  "      yyminorunion = yyzerominor;\n"
+  "      yyStackOverflow(yypParser, &yyminorunion);\n"
+  "      return;\n"
+  "    }\n"
+  "#endif\n"
+  "    yypParser->yyidx = 0;\n"
+  "    yypParser->yyerrcnt = -1;\n"
+  "    yypParser->yystack[0].stateno = 0;\n"
+  "    yypParser->yystack[0].major = 0;\n"
+  "  }\n"
+  "  yyminorunion.yy0 = yyminor;\n"
+  "  yyendofinput = (yymajor == 0);\n"
+  "#ifdef YYTOKENCLASS\n"
+  "  yyclass = yy_token_class[yymajor];\n"
+  "#else\n"
+  "  yyclass = yymajor;\n"
+  "#endif\n"
+  "  ParseARG_STORE;\n"
+  "\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sInput %s\\n\", yyTracePrompt, yyTokenName[yymajor]);\n"
+  "  }\n"
+  "#endif\n"
+  "\n"
+  "  do {\n"
+  "    yyact = yy_find_shift_action(yypParser, (YYCODETYPE)yyclass);\n"
+  "    if (yyact < YYNSTATE) {\n"
+  "      assert(!yyendofinput); // Impossible to shift the $ token\n"
+  "      yy_shift(yypParser, yyact, yymajor, &yyminorunion);\n"
+  "      yypParser->yyerrcnt--;\n"
+  "      yymajor = YYNOCODE;\n"
+  "#ifdef YYEAGERREDUCE\n"
+  "      /* States from YY_MIN_AUTOREDUCE on reduce by their default rule\n"
+  "       * whatever the next token is, so there is no need to wait for it.\n"
+  "       * This lets the actions of a complete statement run before the\n"
+  "       * tokenizer delivers another token.\n"
+  "       */\n"
+  "      while (yypParser->yyidx >= 0 && yypParser->yystack[yypParser->yyidx].stateno >= YY_MIN_AUTOREDUCE) {\n"
+  "        yy_reduce(yypParser, yy_default[yypParser->yystack[yypParser->yyidx].stateno] - YYNSTATE);\n"
+  "      }\n"
+  "#endif\n"
+  "    } else if (yyact < YYNSTATE + YYNRULE) {\n"
+  "      yy_reduce(yypParser, yyact - YYNSTATE);\n"
+  "    } else {\n"
+  "      assert(yyact == YY_ERROR_ACTION);\n"
+  "#ifdef YYERRORSYMBOL\n"
+  "      int yymx;\n"
+  "#endif\n"
+  "#ifndef NDEBUG\n"
+  "      if (yyTraceFILE) {\n"
+  "        fprintf(yyTraceFILE, \"%sSyntax Error!\\n\", yyTracePrompt);\n"
+  "      }\n"
+  "#endif\n"
+  "#ifdef YYERRORSYMBOL\n"
+  "      /* A syntax error has occurred.\n"
+  "       * The response to an error depends upon whether or not the\n"
+  "       * grammar defines an error token \"ERROR\".\n"
+  "       *\n"
+  "       * This is what we do if the grammar does define ERROR:\n"
+  "       *\n"
+  "       *  * Call the %syntax_error function.\n"
+  "       *\n"
+  "       *  * Begin popping the stack until we enter a state where\n"
+  "       *    it is legal to shift the error symbol, then shift\n"
+  "       *    the error symbol.\n"
+  "       *\n"
+  "       *  * Set the error count to three.\n"
+  "       *\n"
+  "       *  * Begin accepting and shifting new tokens.  No new error\n"
+  "       *    processing will occur until three tokens have been\n"
+  "       *    shifted successfully.\n"
+  "       *\n"
+  "       */\n"
+  "      if (yypParser->yyerrcnt < 0) {\n"
+  "        yy_syntax_error(yypParser, yymajor, yyminorunion);\n"
+  "      }\n"
+  "      yymx = yypParser->yystack[yypParser->yyidx].major;\n"
+  "      if (yymx == YYERRORSYMBOL || yyerrorhit) {\n"
+  "#ifndef NDEBUG\n"
+  "        if (yyTraceFILE) {\n"
+  "          fprintf(yyTraceFILE, \"%sDiscard input token %s\\n\", yyTracePrompt, yyTokenName[yymajor]);\n"
+  "        }\n"
+  "#endif\n"
+  "        yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);\n"
+  "        yymajor = YYNOCODE;\n"
+  "      } else {\n"
+  "        while (yypParser->yyidx >= 0 && yymx != YYERRORSYMBOL &&\n"
+  "               (yyact = yy_find_reduce_action(yypParser->yystack[yypParser->yyidx].stateno, YYERRORSYMBOL)) >=\n"
+  "                   YYNSTATE) {\n"
+  "          yy_pop_parser_stack(yypParser);\n"
+  "        }\n"
+  "        if (yypParser->yyidx < 0 || yymajor == 0) {\n"
+  "          yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);\n"
+  "          yy_parse_failed(yypParser);\n"
+  "          yymajor = YYNOCODE;\n"
+  "        } else if (yymx != YYERRORSYMBOL) {\n"
+  "          YYMINORTYPE u2;\n"
+  "          u2.YYERRSYMDT = 0;\n"
+  "          yy_shift(yypParser, yyact, YYERRORSYMBOL, &u2);\n"
+  "        }\n"
+  "      }\n"
+  "      yypParser->yyerrcnt = 3;\n"
+  "      yyerrorhit = 1;\n"
+  "#elif defined(YYNOERRORRECOVERY)\n"
+  "      /* If the YYNOERRORRECOVERY macro is defined, then do not attempt to\n"
+  "       * do any kind of error recovery.  Instead, simply invoke the syntax\n"
+  "       * error routine and continue going as if nothing had happened.\n"
+  "       *\n"
+  "       * Applications can set this macro (for example inside %include) if\n"
+  "       * they intend to abandon the parse upon the first syntax error seen.\n"
+  "       */\n"
+  "      yy_syntax_error(yypParser, yymajor, yyminorunion);\n"
+  "      yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);\n"
+  "      yymajor = YYNOCODE;\n"
+  "\n"
+  "#else // YYERRORSYMBOL is not defined\n"
+  "      /* This is what we do if the grammar does not define ERROR:\n"
+  "       *\n"
+  "       *  * Report an error message, and throw away the input token.\n"
+  "       *\n"
+  "       *  * If the input token is $, then fail the parse.\n"
+  "       *\n"
+  "       * As before, subsequent error messages are suppressed until\n"
+  "       * three input tokens have been successfully shifted.\n"
+  "       */\n"
+  "      if (yypParser->yyerrcnt <= 0) {\n"
+  "        yy_syntax_error(yypParser, yymajor, yyminorunion);\n"
+  "      }\n"
+  "      yypParser->yyerrcnt = 3;\n"
+  "      yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);\n"
+  "      if (yyendofinput) {\n"
+  "        yy_parse_failed(yypParser);\n"
+  "      }\n"
+  "      yymajor = YYNOCODE;\n"
+  "#endif\n"
+  "    }\n"
+  "  } while (yymajor != YYNOCODE && yypParser->yyidx >= 0);\n"
+  "  return;\n"
+  "}\n"
+  "\n"
+  "#ifdef YYPARSEPOOL\n"
+  "#ifndef YYSYNCTOKEN\n"
+  "#error \"YYPARSEPOOL requires a %sync_token declaration in the grammar\"\n"
+  "#endif\n"
+  "#include <pthread.h>\n"
+  "\n"
+  "/* The parallel driver.  The input is split into segments after every\n"
+  " * YYSYNCTOKEN, and every segment is parsed as a complete input on one of\n"
+  " * a pool of parsers, each owned by a worker thread.  The generated tables\n"
+  " * are read-only, so the parsers share nothing but the job below.\n"
+  " */\n"
+  "typedef struct yyPoolJob {\n"
+  "  const int *aMajor;            // Major token codes of the whole input\n"
+  "  const ParseTOKENTYPE *aMinor; // Minor token values of the whole input\n"
+  "  const int *aStart;            // First token of each segment, then nToken\n"
+  "  int nSegment;                 // Number of segments\n"
+  "  int iNext;                    // Next segment to hand out\n"
+  "  void **apArg;                 // The %extra_argument of each segment\n"
+  "  void *(*xArg)(void *, int);   // Makes the argument of a segment\n"
+  "  void *pCtx;                   // First argument to xArg\n"
+  "  pthread_mutex_t mutex;        // Protects iNext\n"
+  "} yyPoolJob;\n"
+  "\n"
+  "/* Parse segments until the job runs out of them.  A worker that gets no\n"
+  " * parser leaves the segments to the others.\n"
+  " */\n"
+  "static void *\n"
+  "yy_pool_worker(void *pArg) {\n"
+  "  yyPoolJob *pJob = (yyPoolJob *)pArg;\n"
+  "  yyParser *pParser;\n"
+  "  int i, j;\n"
+  "\n"
+  "  pParser = (yyParser *)ParseAlloc();\n"
+  "  if (pParser == 0)\n"
+  "    return 0;\n"
+  "  for (;;) {\n"
+  "    pthread_mutex_lock(&pJob->mutex);\n"
+  "    i = pJob->iNext;\n"
+  "    if (i < pJob->nSegment)\n"
+  "      pJob->iNext++;\n"
+  "    pthread_mutex_unlock(&pJob->mutex);\n"
+  "    if (i >= pJob->nSegment)\n"
+  "      break;\n"
+  "    pArg = pJob->xArg(pJob->pCtx, i);\n"
+  "    pJob->apArg[i] = pArg;\n"
+  "    for (j = pJob->aStart[i]; j < pJob->aStart[i + 1]; j++) {\n"
+  "      Parse(pParser, pJob->aMajor[j], pJob->aMinor[j] ParseARG_PARAM(pArg));\n"
+  "    }\n"
+  "    Parse(pParser, 0, yyzerominor.yy0 ParseARG_PARAM(pArg));\n"
+  "    /* A segment that failed without recovering may leave symbols behind */\n"
+  "    while (pParser->yyidx >= 0) {\n"
+  "      yy_pop_parser_stack(pParser);\n"
+  "    }\n"
+  "  }\n"
+  "  ParseFree(pParser);\n"
+  "  return 0;\n"
+  "}\n"
+  "\n"
+  "/* Parse the \"nToken\" tokens in aMajor[] and aMinor[] on \"nThread\" threads.\n"
+  " * The input does not include the final end-of-input token; every segment\n"
+  " * gets its own.\n"
+  " *\n"
+  " * \"xArg\" is called from the worker threads, once per segment and before\n"
+  " * its first token, to make the %extra_argument the segment is parsed with,\n"
+  " * so the %extra_argument must be a pointer.  Once the workers are done,\n"
+  " * \"xMerge\" is called from this thread with each of those arguments, in\n"
+  " * input order.\n"
+  " *\n"
+  " * Outputs:\n"
+  " * Zero on success, or non-zero if memory ran out.  If no thread could get\n"
+  " * a parser for the last segments, xMerge is called only for the segments\n"
+  " * before them, which are all that have an argument.\n"
+  " */\n"
+  "int\n"
+  "ParseParallel(const int *aMajor,                       // Major token codes\n"
+  "              const ParseTOKENTYPE *aMinor,            // Minor token values\n"
+  "              int nToken,                              // Number of tokens\n"
+  "              int nThread,                             // Number of threads\n"
+  "              void *(*xArg)(void *, int),              // Argument of a segment\n"
+  "              void (*xMerge)(void *, int, void *),     // Merges a segment\n"
+  "              void *pCtx                               // First argument to xArg and xMerge\n"
+  "              ) {\n"
+  "  yyPoolJob job;\n"
+  "  pthread_t *aThread;\n"
+  "  int *aStart;\n"
+  "  int i, nSegment, nStarted;\n"
+  "\n"
+  "  nSegment = 0;\n"
+  "  for (i = 0; i < nToken; i++) {\n"
+  "    if (aMajor[i] == YYSYNCTOKEN || i == nToken - 1)\n"
+  "      nSegment++;\n"
+  "  }\n"
+  "  aStart = (int *)malloc((nSegment + 1) * sizeof(aStart[0]));\n"
+  "  job.apArg = (void **)malloc((nSegment + 1) * sizeof(job.apArg[0]));\n"
+  "  if (nThread > nSegment)\n"
+  "    nThread = nSegment;\n"
+  "  if (nThread < 1)\n"
+  "    nThread = 1;\n"
+  "  aThread = (pthread_t *)malloc(nThread * sizeof(aThread[0]));\n"
+  "  if (aStart == 0 || job.apArg == 0 || aThread == 0) {\n"
+  "    free(aStart);\n"
+  "    free(job.apArg);\n"
+  "    free(aThread);\n"
+  "    return 1;\n"
+  "  }\n"
+  "  nSegment = 0;\n"
+  "  aStart[0] = 0;\n"
+  "  for (i = 0; i < nToken; i++) {\n"
+  "    if (aMajor[i] == YYSYNCTOKEN || i == nToken - 1)\n"
+  "      aStart[++nSegment] = i + 1;\n"
+  "  }\n"
+  "\n"
+  "  job.aMajor = aMajor;\n"
+  "  job.aMinor = aMinor;\n"
+  "  job.aStart = aStart;\n"
+  "  job.nSegment = nSegment;\n"
+  "  job.iNext = 0;\n"
+  "  job.xArg = xArg;\n"
+  "  job.pCtx = pCtx;\n"
+  "  pthread_mutex_init(&job.mutex, 0);\n"
+  "  for (nStarted = 0; nStarted < nThread; nStarted++) {\n"
+  "    if (pthread_create(&aThread[nStarted], 0, yy_pool_worker, &job) != 0)\n"
+  "      break;\n"
+  "  }\n"
+  "  for (i = 0; i < nStarted; i++) {\n"
+  "    pthread_join(aThread[i], 0);\n"
+  "  }\n"
+  "  if (job.iNext < nSegment)\n"
+  "    yy_pool_worker(&job); // No threads or no parsers to be had: parse the rest here\n"
+  "  pthread_mutex_destroy(&job.mutex);\n"
+  "\n"
+  "  /* The segments are handed out in order, so those parsed come first */\n"
+  "  for (i = 0; i < job.iNext; i++) {\n"
+  "    xMerge(pCtx, i, job.apArg[i]);\n"
+  "  }\n"
+  "  free(aStart);\n"
+  "  free(job.apArg);\n"
+  "  free(aThread);\n"
+  "  return job.iNext < nSegment;\n"
+  "}\n"
+  "#endif /* YYPARSEPOOL */\n",
+  0
+};
+
+const char *const template_lempar_glr_c[] = {
+  "/* GLR driver template for the LEMON parser generator.\n"
+  " * The author disclaims copyright to this source code.\n"
+  " *\n"
+  " * This template is used instead of lempar.c when lemon is run with the\n"
+  " * -G switch.  The tables keep every parsing conflict the grammar could\n"
+  " * not resolve, and the parser splits into several branches whenever it\n"
+  " * meets one.  See the comment above yyGlrNode for the details.\n"
+  " */\n"
+  "#include <assert.h>\n"
+  "#include <stdlib.h>\n"
+  "\n"
+  "/* Make sure the INTERFACE macro is defined. */\n"
+  "#ifndef INTERFACE\n"
+  "#define INTERFACE 1\n"
+  "#endif\n"
+  "\n"
+  "/* Next is all token values, in a form suitable for use by makeheaders.\n"
+  " * This section will be null unless lemon is run with the -m switch.\n"
+  " */\n"
+  "/* These constants (all generated automatically by the parser generator)\n"
+  " * specify the various kinds of tokens (terminals) that the parser\n"
+  " * understands.\n"
+  " *\n"
+  " * Each symbol here is a terminal symbol in the grammar.\n"
+  " */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "/* The next thing included is series of defines which control\n"
+  " * various aspects of the generated parser.\n"
+  " *    YYCODETYPE         is the data type used for storing terminal\n"
+  " *                       and nonterminal numbers.  \"unsigned char\" is\n"
+  " *                       used if there are fewer than 250 terminals\n"
+  " *                       and nonterminals.  \"int\" is used otherwise.\n"
+  " *    YYNOCODE           is a number of type YYCODETYPE which corresponds\n"
+  " *                       to no legal terminal or nonterminal number.  This\n"
+  " *                       number is used to fill in empty slots of the hash\n"
+  " *                       table.\n"
+  " *    YYFALLBACK         If defined, this indicates that one or more tokens\n"
+  " *                       have fall-back values which should be used if the\n"
+  " *                       original value of the token will not parse.\n"
+  " *    YYTOKENCLASS       If defined, terminals are looked up in the action\n"
+  " *                       table by their class in yy_token_class[].\n"
+  " *    YYACTIONTYPE       is the data type used for storing terminal\n"
+  " *                       and nonterminal numbers.  \"unsigned char\" is\n"
+  " *                       used if there are fewer than 250 rules and\n"
+  " *                       states combined.  \"int\" is used otherwise.\n"
+  " *    ParseTOKENTYPE     is the data type used for minor tokens given\n"
+  " *                       directly to the parser from the tokenizer.\n"
+  " *    YYMINORTYPE        is the data type used for all minor tokens.\n"
+  " *                       This is typically a union of many types, one of\n"
+  " *                       which is ParseTOKENTYPE.  The entry in the union\n"
+  " *                       for base tokens is called \"yy0\".\n"
+  " *    YYSTACKDEPTH       is the maximum depth of the parser's stack.  If\n"
+  " *                       zero the stack is dynamically sized using realloc()\n"
+  " *    ParseARG_SDECL     A static variable declaration for the %extra_argument\n"
+  " *    ParseARG_PDECL     A parameter declaration for the %extra_argument\n"
+  " *    ParseARG_STORE     Code to store %extra_argument into yypParser\n"
+  " *    ParseARG_FETCH     Code to extract %extra_argument from yypParser\n"
+  " *    YYNSTATE           the combined number of states.\n"
+  " *    YYNRULE            the number of rules in the grammar\n"
+  " *    YYERRORSYMBOL      is the code number of the error symbol.  If not\n"
+  " *                       defined, then do no error processing.\n"
+  " *    YYNTOKEN           the number of terminals.\n"
+  " */\n"
+  "\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "#ifndef NDEBUG\n"
+  "#include <stdio.h>\n"
+  "void ParseTrace(FILE *, char *);\n"
+  "#endif\n"
+  "void *ParseAlloc();\n"
+  "void ParseFree(void *);\n"
+  "void Parse(void *, int , ParseTOKENTYPE yyminor ParseARG_PDECL);\n"
+  "int ParseExpectedTokens(void *, int *, int);\n"
+  "\n"
+  "/* First off, code is included that follows the \"include\" declaration\n"
+  " * in the input grammar file.\n"
+  " */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "#define YY_NO_ACTION (YYNSTATE + YYNRULE + 2)\n"
+  "#define YY_ACCEPT_ACTION (YYNSTATE + YYNRULE + 1)\n"
+  "#define YY_ERROR_ACTION (YYNSTATE + YYNRULE)\n"
+  "#define YY_CONFLICT_ACTION (YYNSTATE + YYNRULE + 3)\n"
+  "\n"
+  "/* The yyzerominor constant is used to initialize instances of\n"
+  " * YYMINORTYPE objects to zero.\n"
+  " */\n"
+  "static const YYMINORTYPE yyzerominor = {0};\n"
+  "\n"
+  "/* Define the yytestcase() macro to be a no-op if is not already defined\n"
+  " * otherwise.\n"
+  " *\n"
+  " * Applications can choose to define yytestcase() in the %include section\n"
+  " * to a macro that can assist in verifying code coverage.  For production\n"
+  " * code the yytestcase() macro should be turned off.  But it is useful\n"
+  " * for testing.\n"
+  " */\n"
+  "#ifndef yytestcase\n"
+  "#define yytestcase(X)\n"
+  "#endif\n"
+  "\n"
+  "/* Next are the tables used to determine what action to take based on the\n"
+  " * current state and lookahead token.  These tables are used to implement\n"
+  " * functions that take a state number and lookahead value and return an\n"
+  " * action integer.\n"
+  " *\n"
+  " * Suppose the action integer is N.  Then the action is determined as\n"
+  " * follows\n"
+  " *\n"
+  " *   0 <= N < YYNSTATE                  Shift N.  That is, push the lookahead\n"
+  " *                                      token onto the stack and goto state N.\n"
+  " *\n"
+  " *   YYNSTATE <= N < YYNSTATE+YYNRULE   Reduce by rule N-YYNSTATE.\n"
+  " *\n"
+  " *   N == YYNSTATE+YYNRULE              A syntax error has occurred.\n"
+  " *\n"
+  " *   N == YYNSTATE+YYNRULE+1            The parser accepts its input.\n"
+  " *\n"
+  " *   N == YYNSTATE+YYNRULE+2            No such action.  Denotes unused\n"
+  " *                                      slots in the yy_action[] table.\n"
+  " *\n"
+  " *   YYNSTATE+YYNRULE+3 <= N            A parsing conflict.  All the actions\n"
+  " *                                      which may be taken are listed from\n"
+  " *                                      yy_conflict[N-YYNSTATE-YYNRULE-3]\n"
+  " *                                      up to the next YY_NO_ACTION, the one\n"
+  " *                                      LR would have taken first.\n"
+  " *\n"
+  " * The action table is constructed as a single large table named yy_action[].\n"
+  " * Given state S and lookahead X, the action is computed as\n"
+  " *\n"
+  " *      yy_action[ yy_shift_ofst[S] + X ]\n"
+  " *\n"
+  " * If the index value yy_shift_ofst[S]+X is out of range or if the value\n"
+  " * yy_lookahead[yy_shift_ofst[S]+X] is not equal to X or if yy_shift_ofst[S]\n"
+  " * is equal to YY_SHIFT_USE_DFLT, it means that the action is not in the table\n"
+  " * and that yy_default[S] should be used instead.\n"
+  " *\n"
+  " * The formula above is for computing the action when the lookahead is\n"
+  " * a terminal symbol.  If the lookahead is a non-terminal (as occurs after\n"
+  " * a reduce action) then the yy_reduce_ofst[] array is used in place of\n"
+  " * the yy_shift_ofst[] array and YY_REDUCE_USE_DFLT is used in place of\n"
+  " * YY_SHIFT_USE_DFLT, and a goto that is not in the table is found in\n"
+  " * yy_goto_default[X-YYNTOKEN] instead of yy_default[S].\n"
+  " *\n"
+  " * The following are the tables generated in this section:\n"
+  " *\n"
+  " *  yy_action[]        A single table containing all actions.\n"
+  " *  yy_lookahead[]     A table containing the lookahead for each entry in\n"
+  " *                     yy_action.  Used to detect hash collisions.\n"
+  " *  yy_shift_ofst[]    For each state, the offset into yy_action for\n"
+  " *                     shifting terminals.\n"
+  " *  yy_reduce_ofst[]   For each state, the offset into yy_action for\n"
+  " *                     shifting non-terminals after a reduce.\n"
+  " *  yy_default[]       Default action for each state.\n"
+  " *  yy_goto_default[]  For each non-terminal, the state that most gotos on\n"
+  " *                     it lead to.  yy_action holds only the others.\n"
+  " *  yy_expected[]      Bitmaps of YY_EXPECTED_WORDS words of the terminals\n"
+  " *                     that states expect, for ParseExpectedTokens().\n"
+  " *  yy_expected_row[]  For each state, the number of its bitmap.\n"
+  " *  yy_token_class[]   For each terminal, the terminal whose actions it\n"
+  " *                     shares.  Only present if YYTOKENCLASS is defined.\n"
+  " *  yy_conflict[]      The lists of actions of every parsing conflict.\n"
+  " *\n"
+  " * States numbered YY_MIN_AUTOREDUCE and up have no action but to reduce\n"
+  " * by the rule of yy_default[], which the parser does right after the\n"
+  " * shift into them unless YYNOEAGERREDUCE is defined.\n"
+  " */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "\n"
+  "/* The next table maps tokens into fallback tokens.  If a construct\n"
+  " * like the following:\n"
+  " *\n"
+  " *      %fallback ID X Y Z.\n"
+  " *\n"
+  " * appears in the grammar, then ID becomes a fallback token for X, Y,\n"
+  " * and Z.  Whenever one of the tokens X, Y, or Z is input to the parser\n"
+  " * but it does not parse, the type of the token is changed to ID and\n"
+  " * the parse is retried before an error is thrown.\n"
+  " */\n"
+  "#ifdef YYFALLBACK\n"
+  "static const YYCODETYPE yyFallback[] = {\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "};\n"
+  "#endif /* YYFALLBACK */\n"
+  "\n"
+  "/* The following structure represents a single element of the\n"
+  " * parser's stack.  Information stored includes:\n"
+  " *\n"
+  " *   +  The state number for the parser at this level of the stack.\n"
+  " *\n"
+  " *   +  The value of the token stored at this level of the stack.\n"
+  " *      (In other words, the \"major\" token.)\n"
+  " *\n"
+  " *   +  The semantic value stored at this level of the stack.  This is\n"
+  " *      the information used by the action routines in the grammar.\n"
+  " *      It is sometimes called the \"minor\" token.\n"
+  " */\n"
+  "struct yyStackEntry {\n"
+  "  YYACTIONTYPE stateno; // The state-number\n"
+  "  YYCODETYPE major;     // The major token value.  This is the code number for the token at this stack level\n"
+  "  YYMINORTYPE minor;    // The user-supplied minor token value.  This is the value of the token\n"
+  "};\n"
+  "typedef struct yyStackEntry yyStackEntry;\n"
+  "\n"
+  "#if YY_CONFLICT_COUNT > 0\n"
+  "/* While the input is deterministic the parser runs on its stack exactly\n"
+  " * like the LR driver.  When a parsing conflict is seen, the parser splits:\n"
+  " * every action of the conflict continues as a branch of its own, and the\n"
+  " * entries the branches push are kept in a graph-structured stack of\n"
+  " * yyGlrNode objects on top of the plain stack, which becomes the shared\n"
+  " * trunk of all branches.  The trunk is not changed while split.\n"
+  " *\n"
+  " * A branch which hits a syntax error dies.  Two reductions of the same\n"
+  " * token which end in the same state on top of the same entry are\n"
+  " * ambiguous parses of the same input; the first one found wins, which is\n"
+  " * the one LR would have taken.\n"
+  " *\n"
+  " * The reduce actions of the grammar are deferred while split, so only\n"
+  " * the parse which survives ever runs them: a node made by a reduce\n"
+  " * records the rule and the right-hand side it popped.  As soon as a\n"
+  " * single branch remains, its deferred actions run in input order and\n"
+  " * the branch is moved onto the trunk.\n"
+  " *\n"
+  " * Every branch alive at a token has shifted every token since the split,\n"
+  " * so the values in the nodes of a dying branch are copies of values held\n"
+  " * by the survivors, and the nodes are dropped without their destructors.\n"
+  " */\n"
+  "typedef struct yyGlrNode yyGlrNode;\n"
+  "\n"
+  "/* A position in the graph-structured stack: a node or a trunk entry */\n"
+  "struct yyGlrPos {\n"
+  "  yyGlrNode *pNode; // A node, or NULL for an entry of the trunk\n"
+  "  int iTrunk;       // Index of the trunk entry if pNode is NULL\n"
+  "};\n"
+  "typedef struct yyGlrPos yyGlrPos;\n"
+  "\n"
+  "struct yyGlrNode {\n"
+  "  yyGlrPos below; // The entry under this one.  Free nodes chain through below.pNode\n"
+  "  yyGlrPos rhs;   // The top of the right-hand side of a deferred reduce\n"
+  "  int iRule;      // Rule of the deferred reduce, or -1 if e.minor holds the value\n"
+  "  int nRef;       // References from heads and from the nodes above\n"
+  "  yyStackEntry e; // State, symbol and value of this entry\n"
+  "};\n"
+  "\n"
+  "/* A growable list of branch heads.  \"act\" is an action already chosen\n"
+  " * for the head, or -1 to look it up.\n"
+  " */\n"
+  "struct yyGlrList {\n"
+  "  struct {\n"
+  "    yyGlrPos pos;\n"
+  "    int act;\n"
+  "  } *a;\n"
+  "  int n;      // Number of heads in the list\n"
+  "  int nAlloc; // Number of slots allocated for a[]\n"
+  "};\n"
+  "typedef struct yyGlrList yyGlrList;\n"
+  "#endif /* YY_CONFLICT_COUNT */\n"
+  "\n"
+  "/* The state of the parser is completely contained in an instance of\n"
+  " * the following structure\n"
+  " */\n"
+  "struct yyParser {\n"
+  "  int yyidx; // Index of top element in stack\n"
+  "#ifdef YYTRACKMAXSTACKDEPTH\n"
+  "  int yyidxMax; // Maximum value of yyidx\n"
+  "#endif\n"
+  "  int yyerrcnt;  // Shifts left before out of the error\n"
+  "  ParseARG_SDECL // A place to hold %extra_argument\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "  int yystksz;           // Current side of the stack\n"
+  "  yyStackEntry *yystack; // The parser's stack\n"
+  "#else\n"
+  "  yyStackEntry yystack[YYSTACKDEPTH]; // The parser's stack\n"
+  "#endif\n"
+  "#if YY_CONFLICT_COUNT > 0\n"
+  "  yyGlrList yyheads;        // Heads of the live branches.  Empty while not split\n"
+  "  yyGlrList yywork;         // Heads yet to act on the current token\n"
+  "  yyGlrList yynext;         // Heads which shifted the current token\n"
+  "  yyGlrList yymade;         // Nodes made by a reduce on the current token\n"
+  "  yyGlrNode *yyfree;        // Nodes ready for reuse\n"
+  "  yyStackEntry yyrhs[256];  // The right-hand side of a deferred reduce\n"
+  "#endif\n"
+  "};\n"
+  "typedef struct yyParser yyParser;\n"
+  "\n"
+  "#ifndef NDEBUG\n"
+  "static FILE *yyTraceFILE = 0;\n"
+  "static char *yyTracePrompt = 0;\n"
+  "\n"
+  "/* Turn parser tracing on by giving a stream to which to write the trace\n"
+  " * and a prompt to preface each trace message.  Tracing is turned off\n"
+  " * by making either argument NULL\n"
+  " *\n"
+  " * Inputs:\n"
+  " * <ul>\n"
+  " * <li> A FILE* to which trace output should be written.\n"
+  " *      If NULL, then tracing is turned off.\n"
+  " * <li> A prefix string written at the beginning of every\n"
+  " *      line of trace output.  If NULL, then tracing is\n"
+  " *      turned off.\n"
+  " * </ul>\n"
+  " *\n"
+  " * Outputs:\n"
+  " * None.\n"
+  " */\n"
+  "void\n"
+  "ParseTrace(FILE *TraceFILE, char *zTracePrompt) {\n"
+  "  yyTraceFILE = TraceFILE;\n"
+  "  yyTracePrompt = zTracePrompt;\n"
+  "  if (yyTraceFILE == 0)\n"
+  "    yyTracePrompt = 0;\n"
+  "  else if (yyTracePrompt == 0)\n"
+  "    yyTraceFILE = 0;\n"
+  "}\n"
+  "\n"
+  "/* For tracing shifts, the names of all terminals and nonterminals\n"
+  " * are required.  The following table supplies these names\n"
+  " */\n"
+  "static const char *const yyTokenName[] = {\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "};\n"
+  "\n"
+  "/* For tracing reduce actions, the names of all rules are required. */\n"
+  "static const char *const yyRuleName[] = {\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "};\n"
+  "#endif /* NDEBUG */\n"
+  "\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "/* Try to increase the size of the parser stack. */\n"
+  "static void\n"
+  "yyGrowStack(yyParser *p) {\n"
+  "  int newSize;\n"
+  "  yyStackEntry *pNew;\n"
+  "\n"
+  "  newSize = p->yystksz * 2 + 100;\n"
+  "  pNew = realloc(p->yystack, newSize * sizeof(pNew[0]));\n"
+  "  if (pNew) {\n"
+  "    p->yystack = pNew;\n"
+  "    p->yystksz = newSize;\n"
+  "#ifndef NDEBUG\n"
+  "    if (yyTraceFILE) {\n"
+  "      fprintf(yyTraceFILE, \"%sStack grows to %d entries!\\n\", yyTracePrompt, p->yystksz);\n"
+  "    }\n"
+  "#endif\n"
+  "  }\n"
+  "}\n"
+  "#endif\n"
+  "\n"
+  "/* This function allocates a new parser.\n"
+  " * The only argument is a pointer to a function which works like\n"
+  " * malloc.\n"
+  " *\n"
+  " * Inputs:\n"
+  " * A pointer to the function used to allocate memory.\n"
+  " *\n"
+  " * Outputs:\n"
+  " * A pointer to a parser.  This pointer is used in subsequent calls\n"
+  " * to Parse and ParseFree.\n"
+  " */\n"
+  "void *\n"
+  "ParseAlloc() {\n"
+  "  yyParser *pParser;\n"
+  "  pParser = (yyParser *)malloc((size_t)sizeof(yyParser));\n"
+  "  if (pParser) {\n"
+  "    pParser->yyidx = -1;\n"
+  "#ifdef YYTRACKMAXSTACKDEPTH\n"
+  "    pParser->yyidxMax = 0;\n"
+  "#endif\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "    pParser->yystack = NULL;\n"
+  "    pParser->yystksz = 0;\n"
+  "    yyGrowStack(pParser);\n"
+  "#endif\n"
+  "#if YY_CONFLICT_COUNT > 0\n"
+  "    pParser->yyheads.a = pParser->yywork.a = pParser->yynext.a = pParser->yymade.a = NULL;\n"
+  "    pParser->yyheads.n = pParser->yywork.n = pParser->yynext.n = pParser->yymade.n = 0;\n"
+  "    pParser->yyheads.nAlloc = pParser->yywork.nAlloc = pParser->yynext.nAlloc = pParser->yymade.nAlloc = 0;\n"
+  "    pParser->yyfree = NULL;\n"
+  "#endif\n"
+  "  }\n"
+  "  return pParser;\n"
+  "}\n"
+  "\n"
+  "/* The following function deletes the value associated with a\n"
+  " * symbol.  The symbol can be either a terminal or nonterminal.\n"
+  " * \"yymajor\" is the symbol code, and \"yypminor\" is a pointer to\n"
+  " * the value.\n"
+  " */\n"
+  "static void\n"
+  "yy_destructor(yyParser *yypParser,  // The parser\n"
+  "              YYCODETYPE yymajor,   // Type code for object to destroy\n"
+  "              YYMINORTYPE *yypminor // The object to be destroyed\n"
+  "              ) {\n"
+  "  ParseARG_FETCH;\n"
+  "  switch (yymajor) {\n"
+  "    /* Here is inserted the actions which take place when a\n"
+  "     * terminal or non-terminal is destroyed.  This can happen\n"
+  "     * when the symbol is popped from the stack during a\n"
+  "     * reduce or during error processing or when a parser is\n"
+  "     * being destroyed before it is finished parsing.\n"
+  "     *\n"
+  "     * Note: during a reduce, the only symbols destroyed are those\n"
+  "     * which appear on the RHS of the rule, but which are not used\n"
+  "     * inside the C code.\n"
+  "     */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "    default : break; // If no destructor action specified: do nothing\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "/* Pop the parser's stack once.\n"
+  " *\n"
+  " * If there is a destructor routine associated with the token which\n"
+  " * is popped from the stack, then call it.\n"
+  " *\n"
+  " * Return the major token number for the symbol popped.\n"
+  " */\n"
+  "static int\n"
+  "yy_pop_parser_stack(yyParser *pParser) {\n"
+  "  YYCODETYPE yymajor;\n"
+  "  yyStackEntry *yytos = &pParser->yystack[pParser->yyidx];\n"
+  "\n"
+  "  if (pParser->yyidx < 0)\n"
+  "    return 0;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE && pParser->yyidx >= 0) {\n"
+  "    fprintf(yyTraceFILE, \"%sPopping %s\\n\", yyTracePrompt, yyTokenName[yytos->major]);\n"
+  "  }\n"
+  "#endif\n"
+  "  yymajor = yytos->major;\n"
+  "  yy_destructor(pParser, yymajor, &yytos->minor);\n"
+  "  pParser->yyidx--;\n"
+  "  return yymajor;\n"
+  "}\n"
+  "\n"
+  "/* Return the peak depth of the stack for a parser. */\n"
+  "#ifdef YYTRACKMAXSTACKDEPTH\n"
+  "int\n"
+  "ParseStackPeak(void *p) {\n"
+  "  yyParser *pParser = (yyParser *)p;\n"
+  "  return pParser->yyidxMax;\n"
+  "}\n"
+  "#endif\n"
+  "\n"
+  "/* Write the codes of up to nToken of the terminals that the parser\n"
+  " * expects next to aToken[], in increasing order, and return how many\n"
+  " * it expects in all.  While the parser is split, these are the tokens\n"
+  " * of the state at the top of the stack it shares, where the split began.\n"
+  " */\n"
+  "int\n"
+  "ParseExpectedTokens(void *p, int *aToken, int nToken) {\n"
+  "  yyParser *pParser = (yyParser *)p;\n"
+  "  const unsigned int *aWord;\n"
+  "  unsigned int w;\n"
+  "  int stateno, i, j, n;\n"
+  "\n"
+  "  stateno = pParser->yyidx >= 0 ? pParser->yystack[pParser->yyidx].stateno : 0;\n"
+  "  aWord = &yy_expected[yy_expected_row[stateno] * YY_EXPECTED_WORDS];\n"
+  "  n = 0;\n"
+  "  for (i = 0; i < YY_EXPECTED_WORDS; i++) {\n"
+  "    for (w = aWord[i], j = 0; w; w >>= 1, j++) {\n"
+  "      if (w & 1) {\n"
+  "        if (n < nToken)\n"
+  "          aToken[n] = i * 32 + j;\n"
+  "        n++;\n"
+  "      }\n"
+  "    }\n"
+  "  }\n"
+  "  return n;\n"
+  "}\n"
+  "\n"
+  "/* Find the appropriate action for a parser in state \"stateno\" given\n"
+  " * the terminal look-ahead token iLookAhead, or rather its class in\n"
+  " * yy_token_class[].\n"
+  " *\n"
+  " * If the look-ahead token is YYNOCODE, then check to see if the action is\n"
+  " * independent of the look-ahead.  If it is, return the action, otherwise\n"
+  " * return YY_NO_ACTION.\n"
+  " */\n"
+  "static int\n"
+  "yy_find_shift_action(int stateno,          // Current state number\n"
+  "                     YYCODETYPE iLookAhead // The look-ahead token\n"
+  "                     ) {\n"
+  "  int i;\n"
+  "\n"
+  "  if (stateno > YY_SHIFT_COUNT || (i = yy_shift_ofst[stateno]) == YY_SHIFT_USE_DFLT) {\n"
+  "    return yy_default[stateno];\n"
+  "  }\n"
+  "  assert(iLookAhead != YYNOCODE);\n"
+  "  i += iLookAhead;\n"
+  "  if (i < 0 || i >= YY_ACTTAB_COUNT || yy_lookahead[i] != iLookAhead) {\n"
+  "    if (iLookAhead > 0) {\n"
+  "#ifdef YYFALLBACK\n"
+  "      YYCODETYPE iFallback; // Fallback token\n"
+  "      if (iLookAhead < sizeof(yyFallback) / sizeof(yyFallback[0]) && (iFallback = yyFallback[iLookAhead]) != 0) {\n"
+  "#ifndef NDEBUG\n"
+  "        if (yyTraceFILE) {\n"
+  "          fprintf(yyTraceFILE, \"%sFALLBACK %s => %s\\n\", yyTracePrompt, yyTokenName[iLookAhead], yyTokenName[iFallback]);\n"
+  "        }\n"
+  "#endif\n"
+  "        return yy_find_shift_action(stateno, iFallback);\n"
+  "      }\n"
+  "#endif\n"
+  "#ifdef YYWILDCARD\n"
+  "      {\n"
+  "        int j = i - iLookAhead + YYWILDCARD;\n"
+  "        if (\n"
+  "#if YY_SHIFT_MIN + YYWILDCARD < 0\n"
+  "            j >= 0 &&\n"
+  "#endif\n"
+  "#if YY_SHIFT_MAX + YYWILDCARD >= YY_ACTTAB_COUNT\n"
+  "            j < YY_ACTTAB_COUNT &&\n"
+  "#endif\n"
+  "            yy_lookahead[j] == YYWILDCARD) {\n"
+  "#ifndef NDEBUG\n"
+  "          if (yyTraceFILE) {\n"
+  "            fprintf(yyTraceFILE, \"%sWILDCARD %s => %s\\n\", yyTracePrompt, yyTokenName[iLookAhead],\n"
+  "                    yyTokenName[YYWILDCARD]);\n"
+  "          }\n"
+  "#endif /* NDEBUG */\n"
+  "          return yy_action[j];\n"
+  "        }\n"
+  "      }\n"
+  "#endif /* YYWILDCARD */\n"
+  "    }\n"
+  "    return yy_default[stateno];\n"
+  "  } else {\n"
+  "    return yy_action[i];\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "/* Find the appropriate action for a parser given the non-terminal\n"
+  " * look-ahead token iLookAhead.\n"
+  " *\n"
+  " * If the look-ahead token is YYNOCODE, then check to see if the action is\n"
+  " * independent of the look-ahead.  If it is, return the action, otherwise\n"
+  " * return YY_NO_ACTION.  A goto that yy_action[] leaves out is the default\n"
+  " * of its non-terminal.\n"
+  " */\n"
+  "static int\n"
+  "yy_find_reduce_action(int stateno,          // Current state number\n"
+  "                      YYCODETYPE iLookAhead // The look-ahead token\n"
+  "                      ) {\n"
+  "  int i;\n"
+  "  assert(iLookAhead != YYNOCODE);\n"
+  "  if (stateno <= YY_REDUCE_COUNT && yy_reduce_ofst[stateno] != YY_REDUCE_USE_DFLT) {\n"
+  "    i = yy_reduce_ofst[stateno] + iLookAhead;\n"
+  "    if (i >= 0 && i < YY_ACTTAB_COUNT && yy_lookahead[i] == iLookAhead) {\n"
+  "      return yy_action[i];\n"
+  "    }\n"
+  "  }\n"
+  "#ifdef YYERRORSYMBOL\n"
+  "  if (iLookAhead == YYERRORSYMBOL) {\n"
+  "    return yy_default[stateno];\n"
+  "  }\n"
+  "#endif\n"
+  "  assert(iLookAhead >= YYNTOKEN);\n"
+  "  return yy_goto_default[iLookAhead - YYNTOKEN];\n"
+  "}\n"
+  "\n"
+  "/* The following routine is called if the stack overflows. */\n"
+  "static void\n"
+  "yyStackOverflow(yyParser *yypParser, YYMINORTYPE *yypMinor) {\n"
+  "  ParseARG_FETCH;\n"
+  "  yypParser->yyidx--;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sStack Overflow!\\n\", yyTracePrompt);\n"
+  "  }\n"
+  "#endif\n"
+  "  while (yypParser->yyidx >= 0)\n"
+  "    yy_pop_parser_stack(yypParser);\n"
+  "  /* Here code is inserted which will execute if the parser\n"
+  "   * stack every overflows */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  ParseARG_STORE; // Suppress warning about unused %extra_argument var\n"
+  "}\n"
+  "\n"
+  "/* Perform a shift action. */\n"
+  "static void\n"
+  "yy_shift(yyParser *yypParser,  // The parser to be shifted\n"
+  "         int yyNewState,       // The new state to shift in\n"
+  "         int yyMajor,          // The major token to shift in\n"
+  "         YYMINORTYPE *yypMinor // Pointer to the minor token to shift in\n"
+  "         ) {\n"
+  "  yyStackEntry *yytos;\n"
+  "  yypParser->yyidx++;\n"
+  "#ifdef YYTRACKMAXSTACKDEPTH\n"
+  "  if (yypParser->yyidx > yypParser->yyidxMax) {\n"
+  "    yypParser->yyidxMax = yypParser->yyidx;\n"
+  "  }\n"
+  "#endif\n"
+  "#if YYSTACKDEPTH > 0\n"
+  "  if (yypParser->yyidx >= YYSTACKDEPTH) {\n"
+  "    yyStackOverflow(yypParser, yypMinor);\n"
+  "    return;\n"
+  "  }\n"
+  "#else\n"
+  "  if (yypParser->yyidx >= yypParser->yystksz) {\n"
+  "    yyGrowStack(yypParser);\n"
+  "    if (yypParser->yyidx >= yypParser->yystksz) {\n"
+  "      yyStackOverflow(yypParser, yypMinor);\n"
+  "      return;\n"
+  "    }\n"
+  "  }\n"
+  "#endif\n"
+  "  yytos = &yypParser->yystack[yypParser->yyidx];\n"
+  "  yytos->stateno = (YYACTIONTYPE)yyNewState;\n"
+  "  yytos->major = (YYCODETYPE)yyMajor;\n"
+  "  yytos->minor = *yypMinor;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE && yypParser->yyidx > 0) {\n"
+  "    int i;\n"
+  "    fprintf(yyTraceFILE, \"%sShift %d\\n\", yyTracePrompt, yyNewState);\n"
+  "    fprintf(yyTraceFILE, \"%sStack:\", yyTracePrompt);\n"
+  "    for (i = 1; i <= yypParser->yyidx; i++)\n"
+  "      fprintf(yyTraceFILE, \" %s\", yyTokenName[yypParser->yystack[i].major]);\n"
+  "    fprintf(yyTraceFILE, \"\\n\");\n"
+  "  }\n"
+  "#endif\n"
+  "}\n"
+  "\n"
+  "/* The following table contains information about every rule that\n"
+  " * is used during the reduce.\n"
+  " */\n"
+  "static const struct {\n"
+  "  YYCODETYPE lhs;     // Symbol on the left-hand side of the rule\n"
+  "  unsigned char nrhs; // Number of right-hand side symbols in the rule\n"
+  "} yyRuleInfo[] = {\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "};\n"
+  "\n"
+  "static void yy_accept(yyParser *); // Forward Declaration\n"
+  "\n"
+  "/* Run the reduce action of rule \"yyruleno\" on the right-hand side\n"
+  " * whose last entry is \"yymsp\", and return the value of the left-hand\n"
+  " * side.\n"
+  " */\n"
+  "static YYMINORTYPE\n"
+  "yy_reduce_action(yyParser *yypParser, // The parser\n"
+  "                 int yyruleno,        // Number of the rule by which to reduce\n"
+  "                 yyStackEntry *yymsp  // The last entry of the right-hand side\n"
+  "                 ) {\n"
+  "  YYMINORTYPE yygotominor; // The LHS of the rule reduced\n"
+  "  ParseARG_FETCH;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE && yyruleno >= 0 && yyruleno < (int)(sizeof(yyRuleName) / sizeof(yyRuleName[0]))) {\n"
+  "    fprintf(yyTraceFILE, \"%sReduce [%s].\\n\", yyTracePrompt, yyRuleName[yyruleno]);\n"
+  "  }\n"
+  "#endif /* NDEBUG */\n"
+  "\n"
+  "  /* See the comment in yy_reduce() of lempar.c */\n"
+  "  yygotominor = yyzerominor;\n"
+  "\n"
+  "  switch (yyruleno) {\n"
+  "    /* Beginning here are the reduction cases.  A typical example\n"
+  "     * follows:\n"
+  "     *   case 0:\n"
+  "     *  #line <lineno> <grammarfile>\n"
+  "     *     { ... }           // User supplied code\n"
+  "     *  #line <lineno> <thisfile>\n"
+  "     *     break;\n"
+  "     */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  };\n"
+  "  return yygotominor;\n"
+  "}\n"
+  "\n"
+  "/* Perform a reduce action and the shift that must immediately\n"
+  " * follow the reduce.\n"
+  " */\n"
+  "static void\n"
+  "yy_reduce(yyParser *yypParser, // The parser\n"
+  "          int yyruleno         // Number of the rule by which to reduce\n"
+  "          ) {\n"
+  "  int yygoto;              // The next state\n"
+  "  int yyact;               // The next action\n"
+  "  YYMINORTYPE yygotominor; // The LHS of the rule reduced\n"
+  "  yyStackEntry *yymsp;     // The top of the parser's stack\n"
+  "  int yysize;              // Amount to pop the stack\n"
+  "  yymsp = &yypParser->yystack[yypParser->yyidx];\n"
+  "  yygotominor = yy_reduce_action(yypParser, yyruleno, yymsp);\n"
+  "  yygoto = yyRuleInfo[yyruleno].lhs;\n"
+  "  yysize = yyRuleInfo[yyruleno].nrhs;\n"
+  "  yypParser->yyidx -= yysize;\n"
+  "  yyact = yy_find_reduce_action(yymsp[-yysize].stateno, (YYCODETYPE)yygoto);\n"
+  "  if (yyact < YYNSTATE) {\n"
+  "#ifdef NDEBUG\n"
+  "    /* If we are not debugging and the reduce action popped at least\n"
+  "     * one element off the stack, then we can push the new element back\n"
+  "     * onto the stack here, and skip the stack overflow test in yy_shift().\n"
+  "     * That gives a significant speed improvement.\n"
+  "     */\n"
+  "    if (yysize) {\n"
+  "      yypParser->yyidx++;\n"
+  "      yymsp -= yysize - 1;\n"
+  "      yymsp->stateno = (YYACTIONTYPE)yyact;\n"
+  "      yymsp->major = (YYCODETYPE)yygoto;\n"
+  "      yymsp->minor = yygotominor;\n"
+  "    } else\n"
+  "#endif\n"
+  "    {\n"
+  "      yy_shift(yypParser, yyact, yygoto, &yygotominor);\n"
+  "    }\n"
+  "  } else {\n"
+  "    assert(yyact == YYNSTATE + YYNRULE + 1);\n"
+  "    yy_accept(yypParser);\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "#if YY_CONFLICT_COUNT > 0\n"
+  "/* Return a position on the trunk */\n"
+  "static yyGlrPos\n"
+  "yy_glr_trunk(int iTrunk) {\n"
+  "  yyGlrPos pos;\n"
+  "  pos.pNode = NULL;\n"
+  "  pos.iTrunk = iTrunk;\n"
+  "  return pos;\n"
+  "}\n"
+  "\n"
+  "/* Return the position of a node */\n"
+  "static yyGlrPos\n"
+  "yy_glr_pos(yyGlrNode *pNode) {\n"
+  "  yyGlrPos pos;\n"
+  "  pos.pNode = pNode;\n"
+  "  pos.iTrunk = 0;\n"
+  "  return pos;\n"
+  "}\n"
+  "\n"
+  "/* Return the stack entry at a position */\n"
+  "static yyStackEntry *\n"
+  "yy_glr_entry(yyParser *p, yyGlrPos pos) {\n"
+  "  return pos.pNode ? &pos.pNode->e : &p->yystack[pos.iTrunk];\n"
+  "}\n"
+  "\n"
+  "/* Return the position under a position */\n"
+  "static yyGlrPos\n"
+  "yy_glr_below(yyGlrPos pos) {\n"
+  "  return pos.pNode ? pos.pNode->below : yy_glr_trunk(pos.iTrunk - 1);\n"
+  "}\n"
+  "\n"
+  "/* Return a new node with one reference on top of \"below\", taking over a\n"
+  " * reference to \"below\".  Return NULL if out of memory.\n"
+  " */\n"
+  "static yyGlrNode *\n"
+  "yy_glr_node(yyParser *p, yyGlrPos below, int stateno, int major) {\n"
+  "  yyGlrNode *pNode = p->yyfree;\n"
+  "  if (pNode) {\n"
+  "    p->yyfree = pNode->below.pNode;\n"
+  "  } else {\n"
+  "    pNode = (yyGlrNode *)malloc(sizeof(*pNode));\n"
+  "    if (pNode == 0)\n"
+  "      return 0;\n"
+  "  }\n"
+  "  pNode->below = below;\n"
+  "  pNode->iRule = -1;\n"
+  "  pNode->nRef = 1;\n"
+  "  pNode->e.stateno = (YYACTIONTYPE)stateno;\n"
+  "  pNode->e.major = (YYCODETYPE)major;\n"
+  "  pNode->e.minor = yyzerominor;\n"
+  "  return pNode;\n"
+  "}\n"
+  "\n"
+  "/* Add a reference to a position */\n"
+  "static void\n"
+  "yy_glr_ref(yyGlrPos pos) {\n"
+  "  if (pos.pNode)\n"
+  "    pos.pNode->nRef++;\n"
+  "}\n"
+  "\n"
+  "/* Drop a reference to a position.  Nodes nobody refers to any longer\n"
+  " * are recycled without calling destructors.\n"
+  " */\n"
+  "static void\n"
+  "yy_glr_unref(yyParser *p, yyGlrPos pos) {\n"
+  "  yyGlrNode *pNode;\n"
+  "  while ((pNode = pos.pNode) != 0 && --pNode->nRef == 0) {\n"
+  "    if (pNode->iRule >= 0 && yyRuleInfo[pNode->iRule].nrhs > 0)\n"
+  "      yy_glr_unref(p, pNode->rhs);\n"
+  "    pos = pNode->below;\n"
+  "    pNode->below.pNode = p->yyfree;\n"
+  "    p->yyfree = pNode;\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "/* Append a head to a list, taking over a reference to \"pos\".  Return\n"
+  " * zero and drop the reference if out of memory.\n"
+  " */\n"
+  "static int\n"
+  "yy_glr_push(yyParser *p, yyGlrList *pList, yyGlrPos pos, int act) {\n"
+  "  if (pList->n >= pList->nAlloc) {\n"
+  "    int nNew = pList->nAlloc * 2 + 8;\n"
+  "    void *aNew = realloc(pList->a, nNew * sizeof(pList->a[0]));\n"
+  "    if (aNew == 0) {\n"
+  "      yy_glr_unref(p, pos);\n"
+  "      return 0;\n"
+  "    }\n"
+  "    pList->a = aNew;\n"
+  "    pList->nAlloc = nNew;\n"
+  "  }\n"
+  "  pList->a[pList->n].pos = pos;\n"
+  "  pList->a[pList->n].act = act;\n"
+  "  pList->n++;\n"
+  "  return 1;\n"
+  "}\n"
+  "\n"
+  "/* Drop all heads of a list */\n"
+  "static void\n"
+  "yy_glr_clear(yyParser *p, yyGlrList *pList) {\n"
+  "  while (pList->n > 0)\n"
+  "    yy_glr_unref(p, pList->a[--pList->n].pos);\n"
+  "}\n"
+  "\n"
+  "/* Return true if the list holds a node with the same state and symbol\n"
+  " * as \"pNode\" on top of the same entry.\n"
+  " */\n"
+  "static int\n"
+  "yy_glr_find(yyGlrList *pList, yyGlrNode *pNode) {\n"
+  "  int i;\n"
+  "  for (i = 0; i < pList->n; i++) {\n"
+  "    yyGlrNode *pOther = pList->a[i].pos.pNode;\n"
+  "    if (pOther->e.stateno == pNode->e.stateno && pOther->e.major == pNode->e.major &&\n"
+  "        pOther->below.pNode == pNode->below.pNode &&\n"
+  "        (pNode->below.pNode || pOther->below.iTrunk == pNode->below.iTrunk)) {\n"
+  "      return 1;\n"
+  "    }\n"
+  "  }\n"
+  "  return 0;\n"
+  "}\n"
+  "\n"
+  "static void yy_glr_resolve(yyParser *, yyGlrNode *); // Forward Declaration\n"
+  "\n"
+  "/* Run the deferred reduce actions of the \"n\" entries at and under \"pos\",\n"
+  " * bottom first.\n"
+  " */\n"
+  "static void\n"
+  "yy_glr_resolve_rhs(yyParser *p, yyGlrPos pos, int n) {\n"
+  "  if (n == 0)\n"
+  "    return;\n"
+  "  yy_glr_resolve_rhs(p, yy_glr_below(pos), n - 1);\n"
+  "  if (pos.pNode)\n"
+  "    yy_glr_resolve(p, pos.pNode);\n"
+  "}\n"
+  "\n"
+  "/* Run the deferred reduce action of a node, if any.  The right-hand side\n"
+  " * is consumed by the action, so its nodes are recycled without calling\n"
+  " * destructors.\n"
+  " */\n"
+  "static void\n"
+  "yy_glr_resolve(yyParser *p, yyGlrNode *pNode) {\n"
+  "  yyGlrNode *pRhs;\n"
+  "  yyGlrPos pos;\n"
+  "  int i, yysize;\n"
+  "\n"
+  "  if (pNode->iRule < 0)\n"
+  "    return;\n"
+  "  yysize = yyRuleInfo[pNode->iRule].nrhs;\n"
+  "  yy_glr_resolve_rhs(p, pNode->rhs, yysize);\n"
+  "  for (i = yysize, pos = pNode->rhs; i > 0; i--, pos = yy_glr_below(pos)) {\n"
+  "    p->yyrhs[i] = *yy_glr_entry(p, pos);\n"
+  "  }\n"
+  "  pNode->e.minor = yy_reduce_action(p, pNode->iRule, &p->yyrhs[yysize]);\n"
+  "  pNode->iRule = -1;\n"
+  "  for (pos = pNode->rhs; yysize > 0 && (pRhs = pos.pNode) != 0; yysize--) {\n"
+  "    if (--pRhs->nRef > 0)\n"
+  "      return;\n"
+  "    pos = pRhs->below;\n"
+  "    pRhs->below.pNode = p->yyfree;\n"
+  "    p->yyfree = pRhs;\n"
+  "    if (yysize == 1)\n"
+  "      yy_glr_unref(p, pos);\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "/* Call the destructors of all values held by a node, including those of\n"
+  " * the right-hand side of a deferred reduce.\n"
+  " */\n"
+  "static void\n"
+  "yy_glr_destroy(yyParser *p, yyGlrNode *pNode) {\n"
+  "  yyGlrPos pos;\n"
+  "  int i;\n"
+  "  if (pNode->iRule < 0) {\n"
+  "    yy_destructor(p, pNode->e.major, &pNode->e.minor);\n"
+  "    return;\n"
+  "  }\n"
+  "  for (i = yyRuleInfo[pNode->iRule].nrhs, pos = pNode->rhs; i > 0; i--, pos = yy_glr_below(pos)) {\n"
+  "    if (pos.pNode) {\n"
+  "      yy_glr_destroy(p, pos.pNode);\n"
+  "    } else {\n"
+  "      yy_destructor(p, p->yystack[pos.iTrunk].major, &p->yystack[pos.iTrunk].minor);\n"
+  "    }\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "/* Give up on a split parse: destroy the values held by the first branch,\n"
+  " * drop all branches and leave the trunk under them.\n"
+  " */\n"
+  "static void\n"
+  "yy_glr_discard(yyParser *p) {\n"
+  "  yyGlrPos pos;\n"
+  "  if (p->yyheads.n == 0)\n"
+  "    return;\n"
+  "  for (pos = p->yyheads.a[0].pos; pos.pNode; pos = pos.pNode->below) {\n"
+  "    yy_glr_destroy(p, pos.pNode);\n"
+  "  }\n"
+  "  p->yyidx = pos.iTrunk;\n"
+  "  yy_glr_clear(p, &p->yyheads);\n"
+  "}\n"
+  "\n"
+  "/* Run the deferred reduce actions of the branch ending at \"pos\" and move\n"
+  " * its entries onto the trunk, bottom first.\n"
+  " */\n"
+  "static void\n"
+  "yy_glr_flatten(yyParser *p, yyGlrPos pos) {\n"
+  "  yyGlrNode *pNode = pos.pNode;\n"
+  "  if (pNode == 0) {\n"
+  "    p->yyidx = pos.iTrunk;\n"
+  "    return;\n"
+  "  }\n"
+  "  yy_glr_flatten(p, pNode->below);\n"
+  "  if (p->yyidx < 0) {\n"
+  "    /* The stack overflowed below this entry */\n"
+  "    yy_glr_destroy(p, pNode);\n"
+  "    return;\n"
+  "  }\n"
+  "  yy_glr_resolve(p, pNode);\n"
+  "  yy_shift(p, pNode->e.stateno, pNode->e.major, &pNode->e.minor);\n"
+  "}\n"
+  "\n"
+  "/* Only one branch is left.  Make it the trunk of a deterministic parse. */\n"
+  "static void\n"
+  "yy_glr_join(yyParser *p) {\n"
+  "  yyGlrPos pos = p->yyheads.a[0].pos;\n"
+  "  p->yyheads.n = 0;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sJoin\\n\", yyTracePrompt);\n"
+  "  }\n"
+  "#endif\n"
+  "  yy_glr_flatten(p, pos);\n"
+  "  yy_glr_unref(p, pos);\n"
+  "}\n"
+  "\n"
+  "/* A branch accepts by reducing with \"pNode\".  All other branches are\n"
+  " * dropped.\n"
+  " */\n"
+  "static void\n"
+  "yy_glr_accept(yyParser *p, yyGlrNode *pNode) {\n"
+  "  yy_glr_clear(p, &p->yywork);\n"
+  "  yy_glr_clear(p, &p->yynext);\n"
+  "  yy_glr_clear(p, &p->yymade);\n"
+  "  yy_glr_clear(p, &p->yyheads);\n"
+  "  yy_glr_resolve(p, pNode);\n"
+  "  assert(pNode->below.pNode == 0);\n"
+  "  p->yyidx = pNode->below.iTrunk;\n"
+  "  yy_glr_unref(p, yy_glr_pos(pNode));\n"
+  "  yy_accept(p);\n"
+  "}\n"
+  "\n"
+  "/* Feed one token, of class \"yyclass\", to all branches of a split parse.\n"
+  " * Return zero if no branch can take it, which leaves the branches as\n"
+  " * they were.\n"
+  " */\n"
+  "static int\n"
+  "yy_glr_token(yyParser *p, int yymajor, int yyclass, YYMINORTYPE *yypMinor) {\n"
+  "  yyGlrList *pWork = &p->yywork;\n"
+  "  yyGlrList *pNext = &p->yynext;\n"
+  "  yyGlrList *pMade = &p->yymade;\n"
+  "  yyGlrList tmp;\n"
+  "  yyGlrNode *pNode;\n"
+  "  yyGlrPos pos, base;\n"
+  "  int i, n, yyact, yyruleno, yysize;\n"
+  "\n"
+  "  for (i = p->yyheads.n - 1; i >= 0; i--) {\n"
+  "    yy_glr_ref(p->yyheads.a[i].pos);\n"
+  "    yy_glr_push(p, pWork, p->yyheads.a[i].pos, -1);\n"
+  "  }\n"
+  "  while (pWork->n > 0) {\n"
+  "    pWork->n--;\n"
+  "    pos = pWork->a[pWork->n].pos;\n"
+  "    yyact = pWork->a[pWork->n].act;\n"
+  "    if (yyact < 0)\n"
+  "      yyact = yy_find_shift_action(yy_glr_entry(p, pos)->stateno, (YYCODETYPE)yyclass);\n"
+  "    if (yyact >= YY_CONFLICT_ACTION) {\n"
+  "      const YYACTIONTYPE *aAlt = &yy_conflict[yyact - YY_CONFLICT_ACTION];\n"
+  "      for (n = 0; aAlt[n] != YY_NO_ACTION; n++)\n"
+  "        ;\n"
+  "#ifndef NDEBUG\n"
+  "      if (yyTraceFILE) {\n"
+  "        fprintf(yyTraceFILE, \"%sSplit %d ways on %s\\n\", yyTracePrompt, n, yyTokenName[yymajor]);\n"
+  "      }\n"
+  "#endif\n"
+  "      for (i = n - 1; i >= 0; i--) {\n"
+  "        yy_glr_ref(pos);\n"
+  "        yy_glr_push(p, pWork, pos, aAlt[i]);\n"
+  "      }\n"
+  "      yy_glr_unref(p, pos);\n"
+  "    } else if (yyact < YYNSTATE) {\n"
+  "      assert(yymajor != 0); // Impossible to shift the $ token\n"
+  "      pNode = yy_glr_node(p, pos, yyact, yymajor);\n"
+  "      if (pNode == 0) {\n"
+  "        yy_glr_unref(p, pos);\n"
+  "        continue;\n"
+  "      }\n"
+  "      pNode->e.minor = *yypMinor;\n"
+  "      if (yy_glr_find(pNext, pNode)) {\n"
+  "        yy_glr_unref(p, yy_glr_pos(pNode));\n"
+  "        continue;\n"
+  "      }\n"
+  "      yy_glr_push(p, pNext, yy_glr_pos(pNode), -1);\n"
+  "    } else if (yyact < YYNSTATE + YYNRULE) {\n"
+  "      yyruleno = yyact - YYNSTATE;\n"
+  "      yysize = yyRuleInfo[yyruleno].nrhs;\n"
+  "      for (base = pos, i = 0; i < yysize; i++)\n"
+  "        base = yy_glr_below(base);\n"
+  "      yy_glr_ref(base);\n"
+  "      pNode = yy_glr_node(p, base, yy_find_reduce_action(yy_glr_entry(p, base)->stateno, yyRuleInfo[yyruleno].lhs),\n"
+  "                          yyRuleInfo[yyruleno].lhs);\n"
+  "      if (pNode == 0) {\n"
+  "        yy_glr_unref(p, base);\n"
+  "        yy_glr_unref(p, pos);\n"
+  "        continue;\n"
+  "      }\n"
+  "      pNode->iRule = yyruleno;\n"
+  "      pNode->rhs = pos;\n"
+  "      if (yysize == 0)\n"
+  "        yy_glr_unref(p, pos);\n"
+  "#ifndef NDEBUG\n"
+  "      if (yyTraceFILE) {\n"
+  "        fprintf(yyTraceFILE, \"%sDefer [%s]\\n\", yyTracePrompt, yyRuleName[yyruleno]);\n"
+  "      }\n"
+  "#endif\n"
+  "      if (pNode->e.stateno == YY_ACCEPT_ACTION) {\n"
+  "        yy_glr_accept(p, pNode);\n"
+  "        return 1;\n"
+  "      }\n"
+  "      if (yy_glr_find(pMade, pNode)) {\n"
+  "#ifndef NDEBUG\n"
+  "        if (yyTraceFILE) {\n"
+  "          fprintf(yyTraceFILE, \"%sMerge ambiguous %s\\n\", yyTracePrompt, yyTokenName[pNode->e.major]);\n"
+  "        }\n"
+  "#endif\n"
+  "        yy_glr_unref(p, yy_glr_pos(pNode));\n"
+  "        continue;\n"
+  "      }\n"
+  "      yy_glr_ref(yy_glr_pos(pNode));\n"
+  "      yy_glr_push(p, pMade, yy_glr_pos(pNode), -1);\n"
+  "      yy_glr_push(p, pWork, yy_glr_pos(pNode), -1);\n"
+  "    } else {\n"
+  "#ifndef NDEBUG\n"
+  "      if (yyTraceFILE) {\n"
+  "        fprintf(yyTraceFILE, \"%sBranch in state %d dies\\n\", yyTracePrompt, yy_glr_entry(p, pos)->stateno);\n"
+  "      }\n"
+  "#endif\n"
+  "      yy_glr_unref(p, pos);\n"
+  "    }\n"
+  "  }\n"
+  "  yy_glr_clear(p, pMade);\n"
+  "  if (pNext->n == 0)\n"
+  "    return 0;\n"
+  "  yy_glr_clear(p, &p->yyheads);\n"
+  "  tmp = p->yyheads;\n"
+  "  p->yyheads = *pNext;\n"
+  "  *pNext = tmp;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sShift %s on %d branches\\n\", yyTracePrompt, yyTokenName[yymajor], p->yyheads.n);\n"
+  "  }\n"
+  "#endif\n"
+  "  if (p->yyheads.n == 1)\n"
+  "    yy_glr_join(p);\n"
+  "  return 1;\n"
+  "}\n"
+  "#endif /* YY_CONFLICT_COUNT */\n"
+  "\n"
+  "/* Deallocate and destroy a parser.  Destructors are all called for\n"
+  " * all stack elements before shutting the parser down.\n"
+  " *\n"
+  " * Inputs:\n"
+  " * <ul>\n"
+  " * <li>  A pointer to the parser.  This should be a pointer\n"
+  " *       obtained from ParseAlloc.\n"
+  " * <li>  A pointer to a function used to reclaim memory obtained\n"
+  " *       from malloc.\n"
+  " * </ul>\n"
+  " */\n"
+  "void\n"
+  "ParseFree(void *p) {\n"
+  "  yyParser *pParser = (yyParser *)p;\n"
+  "  if (pParser == 0)\n"
+  "    return;\n"
+  "#if YY_CONFLICT_COUNT > 0\n"
+  "  yy_glr_discard(pParser);\n"
+  "  while (pParser->yyfree) {\n"
+  "    yyGlrNode *pNode = pParser->yyfree;\n"
+  "    pParser->yyfree = pNode->below.pNode;\n"
+  "    free(pNode);\n"
+  "  }\n"
+  "  free(pParser->yyheads.a);\n"
+  "  free(pParser->yywork.a);\n"
+  "  free(pParser->yynext.a);\n"
+  "  free(pParser->yymade.a);\n"
+  "#endif\n"
+  "  while (pParser->yyidx >= 0)\n"
+  "    yy_pop_parser_stack(pParser);\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "  free(pParser->yystack);\n"
+  "#endif\n"
+  "  free((void *)pParser);\n"
+  "}\n"
+  "\n"
+  "/* The following code executes when the parse fails */\n"
+  "#ifndef YYNOERRORRECOVERY\n"
+  "static void\n"
+  "yy_parse_failed(yyParser *yypParser // The parser\n"
+  "                ) {\n"
+  "  ParseARG_FETCH;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sFail!\\n\", yyTracePrompt);\n"
+  "  }\n"
+  "#endif\n"
+  "#if YY_CONFLICT_COUNT > 0\n"
+  "  yy_glr_discard(yypParser);\n"
+  "#endif\n"
+  "  while (yypParser->yyidx >= 0)\n"
+  "    yy_pop_parser_stack(yypParser);\n"
+  "  /* Here code is inserted which will be executed whenever the\n"
+  "   * parser fails\n"
+  "   */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  ParseARG_STORE; // Suppress warning about unused %extra_argument variable\n"
+  "}\n"
+  "#endif /* YYNOERRORRECOVERY */\n"
+  "\n"
+  "/* The following code executes when a syntax error first occurs. */\n"
+  "static void\n"
+  "yy_syntax_error(yyParser *yypParser, // The parser\n"
+  "                int yymajor,         // The major type of the error token\n"
+  "                YYMINORTYPE yyminor  // The minor type of the error token\n"
+  "                ) {\n"
+  "  ParseARG_FETCH;\n"
+  "#define TOKEN (yyminor.yy0)\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  ParseARG_STORE; // Suppress warning about unused %extra_argument variable\n"
+  "}\n"
+  "\n"
+  "/* The following is executed when the parser accepts */\n"
+  "static void\n"
+  "yy_accept(yyParser *yypParser // The parser\n"
+  "          ) {\n"
+  "  ParseARG_FETCH;\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sAccept!\\n\", yyTracePrompt);\n"
+  "  }\n"
+  "#endif\n"
+  "  while (yypParser->yyidx >= 0)\n"
+  "    yy_pop_parser_stack(yypParser);\n"
+  "  /* Here code is inserted which will be executed whenever the\n"
+  "   * parser accepts\n"
+  "   */\n"
+  "// clang-format off\n",
+  "// clang-format on\n"
+  "  ParseARG_STORE; // Suppress warning about unused %extra_argument variable\n"
+  "}\n"
+  "\n"
+  "/* The main parser program.\n"
+  " * The first argument is a pointer to a structure obtained from\n"
+  " * \"ParseAlloc\" which describes the current state of the parser.\n"
+  " * The second argument is the major token number.  The third is\n"
+  " * the minor token.  The fourth optional argument is whatever the\n"
+  " * user wants (and specified in the grammar) and is available for\n"
+  " * use by the action routines.\n"
+  " *\n"
+  " * While the parser is split, a syntax error only discards the token\n"
+  " * that no branch could take, whether or not the grammar has an error\n"
+  " * symbol.\n"
+  " *\n"
+  " * Inputs:\n"
+  " * <ul>\n"
+  " * <li> A pointer to the parser (an opaque structure.)\n"
+  " * <li> The major token number.\n"
+  " * <li> The minor token number.\n"
+  " * <li> An option argument of a grammar-specified type.\n"
+  " * </ul>\n"
+  " *\n"
+  " * Outputs:\n"
+  " * None.\n"
+  " */\n"
+  "void\n"
+  "Parse(void *yyp,             // The parser\n"
+  "      int yymajor,           // The major token code number\n"
+  "      ParseTOKENTYPE yyminor // The value for the token\n"
+  "      ParseARG_PDECL         // Optional %extra_argument parameter\n"
+  "      ) {\n"
+  "  YYMINORTYPE yyminorunion;\n"
+  "  int yyact;        // The parser action.\n"
+  "  int yyendofinput; // True if we are at the end of input\n"
+  "  int yyclass;      // The column of yymajor in the action table\n"
+  "#ifdef YYERRORSYMBOL\n"
+  "  int yyerrorhit = 0; // True if yymajor has invoked an error\n"
+  "#endif\n"
+  "  yyParser *yypParser; // The parser\n"
+  "\n"
+  "  /* (re)initialize the parser, if necessary */\n"
+  "  yypParser = (yyParser *)yyp;\n"
+  "  if (yypParser->yyidx < 0) {\n"
+  "#if YYSTACKDEPTH <= 0\n"
+  "    if (yypParser->yystksz <= 0) {\n"
+  "      yyminorunion = yyzerominor;\n"
+  "      yyStackOverflow(yypParser, &yyminorunion);\n"
+  "      return;\n"
+  "    }\n"
+  "#endif\n"
+  "    yypParser->yyidx = 0;\n"
+  "    yypParser->yyerrcnt = -1;\n"
+  "    yypParser->yystack[0].stateno = 0;\n"
+  "    yypParser->yystack[0].major = 0;\n"
+  "  }\n"
+  "  yyminorunion.yy0 = yyminor;\n"
+  "  yyendofinput = (yymajor == 0);\n"
+  "#ifdef YYTOKENCLASS\n"
+  "  yyclass = yy_token_class[yymajor];\n"
+  "#else\n"
+  "  yyclass = yymajor;\n"
+  "#endif\n"
+  "  ParseARG_STORE;\n"
+  "\n"
+  "#ifndef NDEBUG\n"
+  "  if (yyTraceFILE) {\n"
+  "    fprintf(yyTraceFILE, \"%sInput %s\\n\", yyTracePrompt, yyTokenName[yymajor]);\n"
+  "  }\n"
+  "#endif\n"
+  "\n"
+  "  do {\n"
+  "#if YY_CONFLICT_COUNT > 0\n"
+  "    if (yypParser->yyheads.n > 0) {\n"
+  "      if (yy_glr_token(yypParser, yymajor, yyclass, &yyminorunion)) {\n"
+  "        yypParser->yyerrcnt--;\n"
+  "      } else {\n"
+  "#ifndef NDEBUG\n"
+  "        if (yyTraceFILE) {\n"
+  "          fprintf(yyTraceFILE, \"%sSyntax Error!\\n\", yyTracePrompt);\n"
+  "        }\n"
+  "#endif\n"
+  "        if (yypParser->yyerrcnt <= 0) {\n"
+  "          yy_syntax_error(yypParser, yymajor, yyminorunion);\n"
+  "        }\n"
+  "        yypParser->yyerrcnt = 3;\n"
+  "        yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);\n"
+  "#ifndef YYNOERRORRECOVERY\n"
+  "        if (yyendofinput) {\n"
+  "          yy_parse_failed(yypParser);\n"
+  "        }\n"
+  "#endif\n"
+  "      }\n"
+  "      yymajor = YYNOCODE;\n"
+  "      continue;\n"
+  "    }\n"
+  "#endif\n"
+  "    yyact = yy_find_shift_action(yypParser->yystack[yypParser->yyidx].stateno, (YYCODETYPE)yyclass);\n"
+  "#if YY_CONFLICT_COUNT > 0\n"
+  "    if (yyact >= YY_CONFLICT_ACTION) {\n"
+  "      /* Split into branches.  Without the memory to do so, go on with\n"
+  "       * the action LR would have taken.\n"
+  "       */\n"
+  "      if (yy_glr_push(yypParser, &yypParser->yyheads, yy_glr_trunk(yypParser->yyidx), -1))\n"
+  "        continue;\n"
+  "      yyact = yy_conflict[yyact - YY_CONFLICT_ACTION];\n"
+  "    }\n"
+  "#endif\n"
+  "    if (yyact < YYNSTATE) {\n"
+  "      assert(!yyendofinput); // Impossible to shift the $ token\n"
+  "      yy_shift(yypParser, yyact, yymajor, &yyminorunion);\n"
+  "      yypParser->yyerrcnt--;\n"
+  "      yymajor = YYNOCODE;\n"
+  "#if YY_MIN_AUTOREDUCE < YYNSTATE && !defined(YYNOEAGERREDUCE)\n"
+  "      /* States from YY_MIN_AUTOREDUCE on reduce by their default rule\n"
+  "       * whatever the next token is, so there is no need to wait for it.\n"
+  "       * This lets the actions of a complete statement run before the\n"
+  "       * tokenizer delivers another token.\n"
+  "       */\n"
+  "      while (yypParser->yyidx >= 0 && yypParser->yystack[yypParser->yyidx].stateno >= YY_MIN_AUTOREDUCE) {\n"
+  "        yy_reduce(yypParser, yy_default[yypParser->yystack[yypParser->yyidx].stateno] - YYNSTATE);\n"
+  "      }\n"
+  "#endif\n"
+  "    } else if (yyact < YYNSTATE + YYNRULE) {\n"
+  "      yy_reduce(yypParser, yyact - YYNSTATE);\n"
+  "    } else {\n"
+  "      assert(yyact == YY_ERROR_ACTION);\n"
+  "#ifdef YYERRORSYMBOL\n"
+  "      int yymx;\n"
+  "#endif\n"
+  "#ifndef NDEBUG\n"
+  "      if (yyTraceFILE) {\n"
+  "        fprintf(yyTraceFILE, \"%sSyntax Error!\\n\", yyTracePrompt);\n"
+  "      }\n"
+  "#endif\n"
+  "#ifdef YYERRORSYMBOL\n"
+  "      /* A syntax error has occurred.\n"
+  "       * The response to an error depends upon whether or not the\n"
+  "       * grammar defines an error token \"ERROR\".\n"
+  "       *\n"
+  "       * This is what we do if the grammar does define ERROR:\n"
+  "       *\n"
+  "       *  * Call the %syntax_error function.\n"
+  "       *\n"
+  "       *  * Begin popping the stack until we enter a state where\n"
+  "       *    it is legal to shift the error symbol, then shift\n"
+  "       *    the error symbol.\n"
+  "       *\n"
+  "       *  * Set the error count to three.\n"
+  "       *\n"
+  "       *  * Begin accepting and shifting new tokens.  No new error\n"
+  "       *    processing will occur until three tokens have been\n"
+  "       *    shifted successfully.\n"
+  "       *\n"
+  "       */\n"
+  "      if (yypParser->yyerrcnt < 0) {\n"
+  "        yy_syntax_error(yypParser, yymajor, yyminorunion);\n"
+  "      }\n"
+  "      yymx = yypParser->yystack[yypParser->yyidx].major;\n"
+  "      if (yymx == YYERRORSYMBOL || yyerrorhit) {\n"
+  "#ifndef NDEBUG\n"
+  "        if (yyTraceFILE) {\n"
+  "          fprintf(yyTraceFILE, \"%sDiscard input token %s\\n\", yyTracePrompt, yyTokenName[yymajor]);\n"
+  "        }\n"
+  "#endif\n"
+  "        yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);\n"
+  "        yymajor = YYNOCODE;\n"
+  "      } else {\n"
+  "        while (yypParser->yyidx >= 0 && yymx != YYERRORSYMBOL &&\n"
+  "               (yyact = yy_find_reduce_action(yypParser->yystack[yypParser->yyidx].stateno, YYERRORSYMBOL)) >=\n"
+  "                   YYNSTATE) {\n"
+  "          yy_pop_parser_stack(yypParser);\n"
+  "        }\n"
+  "        if (yypParser->yyidx < 0 || yymajor == 0) {\n"
+  "          yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);\n"
+  "          yy_parse_failed(yypParser);\n"
+  "          yymajor = YYNOCODE;\n"
+  "        } else if (yymx != YYERRORSYMBOL) {\n"
+  "          YYMINORTYPE u2;\n"
+  "          u2.YYERRSYMDT = 0;\n"
+  "          yy_shift(yypParser, yyact, YYERRORSYMBOL, &u2);\n"
+  "        }\n"
+  "      }\n"
+  "      yypParser->yyerrcnt = 3;\n"
+  "      yyerrorhit = 1;\n"
+  "#elif defined(YYNOERRORRECOVERY)\n"
+  "      /* If the YYNOERRORRECOVERY macro is defined, then do not attempt to\n"
+  "       * do any kind of error recovery.  Instead, simply invoke the syntax\n"
+  "       * error routine and continue going as if nothing had happened.\n"
+  "       *\n"
+  "       * Applications can set this macro (for example inside %include) if\n"
+  "       * they intend to abandon the parse upon the first syntax error seen.\n"
+  "       */\n"
+  "      yy_syntax_error(yypParser, yymajor, yyminorunion);\n"
+  "      yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);\n"
+  "      yymajor = YYNOCODE;\n"
+  "\n"
+  "#else // YYERRORSYMBOL is not defined\n"
+  "      /* This is what we do if the grammar does not define ERROR:\n"
+  "       *\n"
+  "       *  * Report an error message, and throw away the input token.\n"
+  "       *\n"
+  "       *  * If the input token is $, then fail the parse.\n"
+  "       *\n"
+  "       * As before, subsequent error messages are suppressed until\n"
+  "       * three input tokens have been successfully shifted.\n"
+  "       */\n"
+  "      if (yypParser->yyerrcnt <= 0) {\n"
+  "        yy_syntax_error(yypParser, yymajor, yyminorunion);\n"
+  "      }\n"
+  "      yypParser->yyerrcnt = 3;\n"
+  "      yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);\n"
+  "      if (yyendofinput) {\n"
+  "        yy_parse_failed(yypParser);\n"
+  "      }\n"
+  "      yymajor = YYNOCODE;\n"
+  "#endif\n"
+  "    }\n"
+  "  } while (yymajor != YYNOCODE && yypParser->yyidx >= 0);\n"
+  "  return;\n"
+  "}\n",
+  0
+};
@@ -0,0 +1,49 @@
+#!/bin/sh
+# Print the figures quoted for the table and automaton optimizations:
+#
+#   - the time lemon takes on big.y, and YY_ACTTAB_COUNT with -t 0,
+#     -t 300 and -t 3000;
+#   - the reductions the parser from expr.y makes for "2*(3+4)*5";
+#   - YY_ACTTAB_COUNT for tokclass.y.
+#
+#   test/bench.sh path/to/lemon
+#
+# Set CC to the compiler for expr_main.c.  Times are in milliseconds and
+# need a date(1) that knows %N; -t 300 and -t 3000 also depend on the
+# speed of the machine.
+
+LEMON=${1:-./lemon}
+case $LEMON in
+/*) ;;
+*) LEMON=$(pwd)/$LEMON ;;
+esac
+CC=${CC:-cc}
+TEST=$(cd "$(dirname "$0")" && pwd)
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+cd "$WORK" || exit 1
+
+now_ms() {
+  date +%s%N | sed 's/......$//'
+}
+
+acttab_count() {
+  sed -n 's/^#define YY_ACTTAB_COUNT (\([0-9]*\))$/\1/p' "$1"
+}
+
+cp "$TEST/big.y" "$TEST/expr.y" "$TEST/tokclass.y" "$TEST/expr_main.c" .
+
+for t in 0 300 3000; do
+  start=$(now_ms)
+  "$LEMON" -q -t $t big.y || exit 1
+  end=$(now_ms)
+  echo "big.y -t $t: YY_ACTTAB_COUNT $(acttab_count big.c), $((end - start)) ms"
+done
+
+"$LEMON" -q expr.y || exit 1
+: > expr.h
+"$CC" -o expr expr_main.c || exit 1
+echo "expr.y: $(./expr '2*(3+4)*5' t | grep -c Reduce) reductions for 2*(3+4)*5"
+
+"$LEMON" -q tokclass.y || exit 1
+echo "tokclass.y: YY_ACTTAB_COUNT $(acttab_count tokclass.c)"
@@ -0,0 +1,404 @@
+/* A generated grammar of 400 rules over 100 nonterminals, for timing
+ * lemon and measuring the size of the action table.  See bench.sh.
+ */
+start ::= n0.
+n0 ::= P0 n1 n98 T7. { /* r */ }
+n0 ::= P1 n61 n27 T1 n50. { /* r */ }
+n0 ::= P2 n99 T28 T14 n14. { /* r */ }
+n0 ::= P3 T1 n2 n49. { /* r */ }
+n1 ::= P4 n2 n94 T14. { /* r */ }
+n1 ::= P5 n72 T14 n99 T18. { /* r */ }
+n1 ::= P6 T35. { /* r */ }
+n1 ::= P7 T18. { /* r */ }
+n2 ::= P8 n3 n95. { /* r */ }
+n2 ::= P9 n88 T18 n66 n67. { /* r */ }
+n2 ::= P10 n7 T25 T11 T23. { /* r */ }
+n2 ::= P11 T32. { /* r */ }
+n3 ::= P12 n4 n70. { /* r */ }
+n3 ::= P13 T1 T19 n82 n54. { /* r */ }
+n3 ::= P14 T14 n29. { /* r */ }
+n3 ::= P15 T22 n77. { /* r */ }
+n4 ::= P16 n5 T17 n82 n5. { /* r */ }
+n4 ::= P17 n99 n21 n76 T3. { /* r */ }
+n4 ::= P18 n77 n69 T22 T0. { /* r */ }
+n4 ::= P19 T1 n86 T37. { /* r */ }
+n5 ::= P20 n6 n76 n38. { /* r */ }
+n5 ::= P21 n92. { /* r */ }
+n5 ::= P22 T1. { /* r */ }
+n5 ::= P23 T17 T7 n29 T4. { /* r */ }
+n6 ::= P24 n7 T33 n91. { /* r */ }
+n6 ::= P25 n44 T20 T7. { /* r */ }
+n6 ::= P26 T21. { /* r */ }
+n6 ::= P27 n40 T32 n84 T1. { /* r */ }
+n7 ::= P28 n8 T9 T10. { /* r */ }
+n7 ::= P29 n94 T14 n88 n74. { /* r */ }
+n7 ::= P30 T1 T36 n92 n15. { /* r */ }
+n7 ::= P31 T13 n47 T4. { /* r */ }
+n8 ::= P32 n9 n47 n62 n25. { /* r */ }
+n8 ::= P33 n13. { /* r */ }
+n8 ::= P34 n81 T39. { /* r */ }
+n8 ::= P35 T22. { /* r */ }
+n9 ::= P36 n10 T27. { /* r */ }
+n9 ::= P37 T24 T31. { /* r */ }
+n9 ::= P38 T25. { /* r */ }
+n9 ::= P39 T12 n82 n53. { /* r */ }
+n10 ::= P40 n11 T6 n81 T34 T34. { /* r */ }
+n10 ::= P41 T2 T10. { /* r */ }
+n10 ::= P42 n38 T21. { /* r */ }
+n10 ::= P43 T21 T15 n88. { /* r */ }
+n11 ::= P44 n12 T35 n53 T4 T9. { /* r */ }
+n11 ::= P45 T39 n60. { /* r */ }
+n11 ::= P46 n40. { /* r */ }
+n11 ::= P47 n58. { /* r */ }
+n12 ::= P48 n13 n27 T17 T2. { /* r */ }
+n12 ::= P49 T0 T7 n18. { /* r */ }
+n12 ::= P50 T37 T7. { /* r */ }
+n12 ::= P51 T15 T6 T24 n82. { /* r */ }
+n13 ::= P52 n14 n75 T13 n19. { /* r */ }
+n13 ::= P53 T18. { /* r */ }
+n13 ::= P54 T20 T4 n90. { /* r */ }
+n13 ::= P55 T13 n83 n74 n47. { /* r */ }
+n14 ::= P56 n15 n54 T23. { /* r */ }
+n14 ::= P57 n26. { /* r */ }
+n14 ::= P58 T36 n44 T19 T11. { /* r */ }
+n14 ::= P59 n89 n53 T6. { /* r */ }
+n15 ::= P60 n16 T1. { /* r */ }
+n15 ::= P61 T17 n25. { /* r */ }
+n15 ::= P62 T0. { /* r */ }
+n15 ::= P63 n61 T9 T20. { /* r */ }
+n16 ::= P64 n17 n39. { /* r */ }
+n16 ::= P65 n35 n57. { /* r */ }
+n16 ::= P66 T32 n94 T13. { /* r */ }
+n16 ::= P67 n21 n96. { /* r */ }
+n17 ::= P68 n18 T27 n24. { /* r */ }
+n17 ::= P69 T4 n75. { /* r */ }
+n17 ::= P70 n87 T34 T25 n39. { /* r */ }
+n17 ::= P71 T26 n20 T22. { /* r */ }
+n18 ::= P72 n19 n36 T17. { /* r */ }
+n18 ::= P73 n41 n48 T11 n83. { /* r */ }
+n18 ::= P74 n47 T31 n47 n62. { /* r */ }
+n18 ::= P75 n47 T4 n66. { /* r */ }
+n19 ::= P76 n20 n46 T19. { /* r */ }
+n19 ::= P77 T29 n35 n85. { /* r */ }
+n19 ::= P78 T16 T36 n26 T25. { /* r */ }
+n19 ::= P79 T10 n25 n31. { /* r */ }
+n20 ::= P80 n21 n55 n31 n38. { /* r */ }
+n20 ::= P81 T15. { /* r */ }
+n20 ::= P82 n76 T20 T39 n48. { /* r */ }
+n20 ::= P83 T34. { /* r */ }
+n21 ::= P84 n22 n59 T24 n22 n89. { /* r */ }
+n21 ::= P85 n25 n99 T16 T18. { /* r */ }
+n21 ::= P86 n56 T16. { /* r */ }
+n21 ::= P87 n43 n84 T7 n95. { /* r */ }
+n22 ::= P88 n23 T6 n26 T0 n40. { /* r */ }
+n22 ::= P89 n96. { /* r */ }
+n22 ::= P90 T22 n64 T28. { /* r */ }
+n22 ::= P91 T34 T36 T24 T35. { /* r */ }
+n23 ::= P92 n24 n89. { /* r */ }
+n23 ::= P93 n83 n90. { /* r */ }
+n23 ::= P94 n63 n81 n91 T33. { /* r */ }
+n23 ::= P95 n98. { /* r */ }
+n24 ::= P96 n25 n68 n99 n33 T15. { /* r */ }
+n24 ::= P97 n77 n44 n75. { /* r */ }
+n24 ::= P98 n34 n26 T16. { /* r */ }
+n24 ::= P99 n94 T29 n87 T32. { /* r */ }
+n25 ::= P100 n26 T6. { /* r */ }
+n25 ::= P101 T4 n28 T10 n77. { /* r */ }
+n25 ::= P102 n52 n56 n60. { /* r */ }
+n25 ::= P103 T33. { /* r */ }
+n26 ::= P104 n27 T35 n48 T35. { /* r */ }
+n26 ::= P105 T14 T25 T16. { /* r */ }
+n26 ::= P106 n60 n58 n30. { /* r */ }
+n26 ::= P107 T27 n58 n51 T10. { /* r */ }
+n27 ::= P108 n28 n46 n61 T10 T8. { /* r */ }
+n27 ::= P109 T25 T13 n67 T14. { /* r */ }
+n27 ::= P110 T6 n33 T38 T13. { /* r */ }
+n27 ::= P111 T33. { /* r */ }
+n28 ::= P112 n29 T17 T11 T25 T28. { /* r */ }
+n28 ::= P113 n58 T18 T37 T28. { /* r */ }
+n28 ::= P114 T37 T13 n34. { /* r */ }
+n28 ::= P115 n90. { /* r */ }
+n29 ::= P116 n30 n66 n81 T9. { /* r */ }
+n29 ::= P117 T9. { /* r */ }
+n29 ::= P118 n62. { /* r */ }
+n29 ::= P119 T19 n34. { /* r */ }
+n30 ::= P120 n31 n47. { /* r */ }
+n30 ::= P121 n46. { /* r */ }
+n30 ::= P122 T1 T8 n55 n80. { /* r */ }
+n30 ::= P123 n64 n62 T37. { /* r */ }
+n31 ::= P124 n32 T38 n98. { /* r */ }
+n31 ::= P125 n84. { /* r */ }
+n31 ::= P126 n86 n40. { /* r */ }
+n31 ::= P127 n41 T6 T13. { /* r */ }
+n32 ::= P128 n33 n39 n98 T23 T20. { /* r */ }
+n32 ::= P129 T2. { /* r */ }
+n32 ::= P130 n83 n90 T33 T16. { /* r */ }
+n32 ::= P131 T2 n40 n73. { /* r */ }
+n33 ::= P132 n34 T24 n72. { /* r */ }
+n33 ::= P133 T15. { /* r */ }
+n33 ::= P134 T21 n84. { /* r */ }
+n33 ::= P135 T28 n37 n71 n59. { /* r */ }
+n34 ::= P136 n35 T20 T22 T4. { /* r */ }
+n34 ::= P137 T34. { /* r */ }
+n34 ::= P138 T20 T20 n99. { /* r */ }
+n34 ::= P139 n54. { /* r */ }
+n35 ::= P140 n36 n77 n44 T17. { /* r */ }
+n35 ::= P141 T23 n84 n46 n43. { /* r */ }
+n35 ::= P142 T31 n68. { /* r */ }
+n35 ::= P143 n79 T23. { /* r */ }
+n36 ::= P144 n37 T38 n71 n38 T14. { /* r */ }
+n36 ::= P145 n48 n97. { /* r */ }
+n36 ::= P146 n99. { /* r */ }
+n36 ::= P147 n50 T36 n42. { /* r */ }
+n37 ::= P148 n38 n51. { /* r */ }
+n37 ::= P149 n65 T23. { /* r */ }
+n37 ::= P150 n56 T12 n93 n53. { /* r */ }
+n37 ::= P151 T23 n98 T30 n90. { /* r */ }
+n38 ::= P152 n39 T0 n88 T31. { /* r */ }
+n38 ::= P153 T32. { /* r */ }
+n38 ::= P154 T29 T19 n80 T7. { /* r */ }
+n38 ::= P155 n86 T34 n74. { /* r */ }
+n39 ::= P156 n40 n74 n99 n66. { /* r */ }
+n39 ::= P157 T8 n77 T10. { /* r */ }
+n39 ::= P158 n67 n76 T26. { /* r */ }
+n39 ::= P159 T1 n99 T0 T29. { /* r */ }
+n40 ::= P160 n41 n64 n95 T21. { /* r */ }
+n40 ::= P161 T7 T9 T1 n93. { /* r */ }
+n40 ::= P162 T8 n59 n67. { /* r */ }
+n40 ::= P163 n59 n85 T21. { /* r */ }
+n41 ::= P164 n42 T31 n67 n47 T13. { /* r */ }
+n41 ::= P165 T1 T9. { /* r */ }
+n41 ::= P166 n48 T11 n47 T3. { /* r */ }
+n41 ::= P167 n64 T6. { /* r */ }
+n42 ::= P168 n43 n90 T16 n54 T3. { /* r */ }
+n42 ::= P169 n48 n50. { /* r */ }
+n42 ::= P170 T32 T25 T30 T24. { /* r */ }
+n42 ::= P171 T16 T34. { /* r */ }
+n43 ::= P172 n44 n84 n78 n94. { /* r */ }
+n43 ::= P173 n50 T22 n89. { /* r */ }
+n43 ::= P174 T28 T6 T17. { /* r */ }
+n43 ::= P175 n70 T16 T35. { /* r */ }
+n44 ::= P176 n45 n83. { /* r */ }
+n44 ::= P177 n62 T19. { /* r */ }
+n44 ::= P178 T31 T30 T11. { /* r */ }
+n44 ::= P179 n82 n79. { /* r */ }
+n45 ::= P180 n46 T20 n54. { /* r */ }
+n45 ::= P181 T31 T7. { /* r */ }
+n45 ::= P182 n90 T5. { /* r */ }
+n45 ::= P183 n89. { /* r */ }
+n46 ::= P184 n47 T12. { /* r */ }
+n46 ::= P185 T0 n99 T39. { /* r */ }
+n46 ::= P186 T14 T21. { /* r */ }
+n46 ::= P187 n80 T7 T8. { /* r */ }
+n47 ::= P188 n48 T9. { /* r */ }
+n47 ::= P189 T5. { /* r */ }
+n47 ::= P190 T15. { /* r */ }
+n47 ::= P191 n71 T8 n71. { /* r */ }
+n48 ::= P192 n49 T21 T32. { /* r */ }
+n48 ::= P193 n56 T8 n66. { /* r */ }
+n48 ::= P194 T36 n82 T26 n74. { /* r */ }
+n48 ::= P195 n89 T8 T32. { /* r */ }
+n49 ::= P196 n50 T13. { /* r */ }
+n49 ::= P197 T1 T17 n66 T25. { /* r */ }
+n49 ::= P198 n54. { /* r */ }
+n49 ::= P199 n96 n87 T19. { /* r */ }
+n50 ::= P200 n51 n60 T37 T13 T21. { /* r */ }
+n50 ::= P201 n61 T24 n76. { /* r */ }
+n50 ::= P202 n60. { /* r */ }
+n50 ::= P203 T38 n85 n92. { /* r */ }
+n51 ::= P204 n52 T35 n58. { /* r */ }
+n51 ::= P205 T27 n79 T23 T38. { /* r */ }
+n51 ::= P206 T30 n93 n52 n59. { /* r */ }
+n51 ::= P207 n74 n88. { /* r */ }
+n52 ::= P208 n53 n97 T39 T35. { /* r */ }
+n52 ::= P209 n60 n98 T22. { /* r */ }
+n52 ::= P210 n56 n79 T18. { /* r */ }
+n52 ::= P211 T15 n86 T21. { /* r */ }
+n53 ::= P212 n54 n65. { /* r */ }
+n53 ::= P213 n99 T37 T13 T11. { /* r */ }
+n53 ::= P214 n60 T21 n97 T30. { /* r */ }
+n53 ::= P215 T12 T25 n90. { /* r */ }
+n54 ::= P216 n55 n63 T24 T1 n66. { /* r */ }
+n54 ::= P217 n97 n73 n64 n61. { /* r */ }
+n54 ::= P218 T25 n69 n80. { /* r */ }
+n54 ::= P219 n70. { /* r */ }
+n55 ::= P220 n56 n98 T15 T34 n66. { /* r */ }
+n55 ::= P221 T1 n83. { /* r */ }
+n55 ::= P222 n89 n88. { /* r */ }
+n55 ::= P223 T29. { /* r */ }
+n56 ::= P224 n57 n60. { /* r */ }
+n56 ::= P225 T6 n87 T33 T0. { /* r */ }
+n56 ::= P226 n76. { /* r */ }
+n56 ::= P227 T26 T8 n77 n97. { /* r */ }
+n57 ::= P228 n58 n84 n83 n70 T17. { /* r */ }
+n57 ::= P229 n74 n69 n97. { /* r */ }
+n57 ::= P230 n79. { /* r */ }
+n57 ::= P231 T16 T17. { /* r */ }
+n58 ::= P232 n59 T8 n73 T37 n71. { /* r */ }
+n58 ::= P233 n74 n94 T12 T4. { /* r */ }
+n58 ::= P234 n62 T25. { /* r */ }
+n58 ::= P235 T8 n67 n93 T15. { /* r */ }
+n59 ::= P236 n60 T12 n85 T11 T9. { /* r */ }
+n59 ::= P237 T18 T19 T29. { /* r */ }
+n59 ::= P238 T39. { /* r */ }
+n59 ::= P239 n88. { /* r */ }
+n60 ::= P240 n61 n64 n81 T8. { /* r */ }
+n60 ::= P241 T27. { /* r */ }
+n60 ::= P242 n93 n68. { /* r */ }
+n60 ::= P243 n85 n94. { /* r */ }
+n61 ::= P244 n62 n99 T0. { /* r */ }
+n61 ::= P245 n98. { /* r */ }
+n61 ::= P246 n96 n79 T10 n97. { /* r */ }
+n61 ::= P247 n79 n88. { /* r */ }
+n62 ::= P248 n63 T6 n71 T1 T2. { /* r */ }
+n62 ::= P249 T34 n84 n69 T2. { /* r */ }
+n62 ::= P250 n75 n95 T32 T23. { /* r */ }
+n62 ::= P251 T37 n67. { /* r */ }
+n63 ::= P252 n64 n93 T39 T9. { /* r */ }
+n63 ::= P253 T37 n89 T25. { /* r */ }
+n63 ::= P254 T22 T3 n94. { /* r */ }
+n63 ::= P255 T37. { /* r */ }
+n64 ::= P256 n65 n82 T38 n88. { /* r */ }
+n64 ::= P257 T33 n72 T33 T21. { /* r */ }
+n64 ::= P258 n67 n69 T5. { /* r */ }
+n64 ::= P259 T34 T10 n88 T37. { /* r */ }
+n65 ::= P260 n66 n91 T32. { /* r */ }
+n65 ::= P261 n87 n89 T4 n81. { /* r */ }
+n65 ::= P262 n91 n71 T10. { /* r */ }
+n65 ::= P263 T8 T16 T6. { /* r */ }
+n66 ::= P264 n67 n70 n86 n80. { /* r */ }
+n66 ::= P265 n88. { /* r */ }
+n66 ::= P266 n75 T23 n69. { /* r */ }
+n66 ::= P267 n93. { /* r */ }
+n67 ::= P268 n68 n70 n95. { /* r */ }
+n67 ::= P269 n80 T37. { /* r */ }
+n67 ::= P270 n75 n97. { /* r */ }
+n67 ::= P271 n91 n89. { /* r */ }
+n68 ::= P272 n69 T0 T31 T16. { /* r */ }
+n68 ::= P273 T5. { /* r */ }
+n68 ::= P274 T33 T28. { /* r */ }
+n68 ::= P275 T32 T25 n71. { /* r */ }
+n69 ::= P276 n70 n76 n79. { /* r */ }
+n69 ::= P277 n81 T1 n91 n91. { /* r */ }
+n69 ::= P278 n88 T4 n76 n95. { /* r */ }
+n69 ::= P279 n96 n91 n86 n89. { /* r */ }
+n70 ::= P280 n71 n76 n92 n80 n96. { /* r */ }
+n70 ::= P281 n79 T0 n72 n85. { /* r */ }
+n70 ::= P282 T28 T30 n93. { /* r */ }
+n70 ::= P283 T27 T7. { /* r */ }
+n71 ::= P284 n72 n72 T34 n81. { /* r */ }
+n71 ::= P285 T21 T3 T5 T4. { /* r */ }
+n71 ::= P286 n81 n91. { /* r */ }
+n71 ::= P287 T11 n96 n90. { /* r */ }
+n72 ::= P288 n73 T24 T33 n98. { /* r */ }
+n72 ::= P289 n86. { /* r */ }
+n72 ::= P290 n92 T14. { /* r */ }
+n72 ::= P291 n85 T9. { /* r */ }
+n73 ::= P292 n74 n85 T19 T10. { /* r */ }
+n73 ::= P293 T23 T21. { /* r */ }
+n73 ::= P294 T38 T18 n95 T0. { /* r */ }
+n73 ::= P295 n94 T32 T38. { /* r */ }
+n74 ::= P296 n75 T14 T38 n91. { /* r */ }
+n74 ::= P297 T3 n77. { /* r */ }
+n74 ::= P298 T3 T1. { /* r */ }
+n74 ::= P299 T2. { /* r */ }
+n75 ::= P300 n76 T1 n93 T12. { /* r */ }
+n75 ::= P301 T35 n83 T25. { /* r */ }
+n75 ::= P302 T35. { /* r */ }
+n75 ::= P303 T20 T1 n92 n81. { /* r */ }
+n76 ::= P304 n77 T19 n80. { /* r */ }
+n76 ::= P305 n81. { /* r */ }
+n76 ::= P306 n81. { /* r */ }
+n76 ::= P307 T18 n78. { /* r */ }
+n77 ::= P308 n78 T14. { /* r */ }
+n77 ::= P309 T12 T7. { /* r */ }
+n77 ::= P310 n85. { /* r */ }
+n77 ::= P311 n94 T15 n86. { /* r */ }
+n78 ::= P312 n79 T22 T39. { /* r */ }
+n78 ::= P313 n91 T15 n94 n84. { /* r */ }
+n78 ::= P314 T27. { /* r */ }
+n78 ::= P315 n89 n90 T23. { /* r */ }
+n79 ::= P316 n80 T30 n91 T10. { /* r */ }
+n79 ::= P317 n97 n84 T9. { /* r */ }
+n79 ::= P318 T39 T22. { /* r */ }
+n79 ::= P319 T30 T27 T22. { /* r */ }
+n80 ::= P320 n81 n85 n83 n96 n82. { /* r */ }
+n80 ::= P321 n92 n92. { /* r */ }
+n80 ::= P322 T7 T24 T17. { /* r */ }
+n80 ::= P323 T19 T25. { /* r */ }
+n81 ::= P324 n82 T3 T18. { /* r */ }
+n81 ::= P325 T8. { /* r */ }
+n81 ::= P326 T17 T14. { /* r */ }
+n81 ::= P327 T32. { /* r */ }
+n82 ::= P328 n83 n97 n98 T22 T4. { /* r */ }
+n82 ::= P329 T9 T13 T31. { /* r */ }
+n82 ::= P330 T23 T15 n89. { /* r */ }
+n82 ::= P331 T12. { /* r */ }
+n83 ::= P332 n84 T1 T30 n85. { /* r */ }
+n83 ::= P333 T22 T4 n93. { /* r */ }
+n83 ::= P334 n86 T26 n92. { /* r */ }
+n83 ::= P335 n94. { /* r */ }
+n84 ::= P336 n85 n99. { /* r */ }
+n84 ::= P337 T16 n89 n92. { /* r */ }
+n84 ::= P338 n89 T18 T27 T39. { /* r */ }
+n84 ::= P339 T36 T18. { /* r */ }
+n85 ::= P340 n86 n91 T6 T33. { /* r */ }
+n85 ::= P341 T28 T30. { /* r */ }
+n85 ::= P342 T15 T4. { /* r */ }
+n85 ::= P343 n93. { /* r */ }
+n86 ::= P344 n87 n95 n96 n93 T35. { /* r */ }
+n86 ::= P345 T37 T23 n94 T34. { /* r */ }
+n86 ::= P346 n94 n92 T8. { /* r */ }
+n86 ::= P347 n87 n96 T11 n94. { /* r */ }
+n87 ::= P348 n88 n97. { /* r */ }
+n87 ::= P349 T10. { /* r */ }
+n87 ::= P350 n95 T16. { /* r */ }
+n87 ::= P351 n93 T39. { /* r */ }
+n88 ::= P352 n89 T27 T32 n91. { /* r */ }
+n88 ::= P353 n92 T9 n94. { /* r */ }
+n88 ::= P354 T32. { /* r */ }
+n88 ::= P355 n96 T34. { /* r */ }
+n89 ::= P356 n90 T13 T6 T24 T25. { /* r */ }
+n89 ::= P357 T33 n90. { /* r */ }
+n89 ::= P358 n99 T24. { /* r */ }
+n89 ::= P359 n92 n94 T1. { /* r */ }
+n90 ::= P360 n91 n92. { /* r */ }
+n90 ::= P361 T20 T6. { /* r */ }
+n90 ::= P362 T29 T26 T32 T25. { /* r */ }
+n90 ::= P363 n98 n96 T8 n94. { /* r */ }
+n91 ::= P364 n92 n94 T6. { /* r */ }
+n91 ::= P365 T9 n97 n98 T31. { /* r */ }
+n91 ::= P366 T19 n98 T18 T31. { /* r */ }
+n91 ::= P367 T29 T7. { /* r */ }
+n92 ::= P368 n93 T31 n97 n95. { /* r */ }
+n92 ::= P369 n99 T31 n99. { /* r */ }
+n92 ::= P370 T34 T38. { /* r */ }
+n92 ::= P371 T20 n99. { /* r */ }
+n93 ::= P372 n94 T1. { /* r */ }
+n93 ::= P373 T38 n99 n95. { /* r */ }
+n93 ::= P374 n96 T24 n95. { /* r */ }
+n93 ::= P375 T22. { /* r */ }
+n94 ::= P376 n95 T39 T13. { /* r */ }
+n94 ::= P377 T0 n95 n96. { /* r */ }
+n94 ::= P378 n96. { /* r */ }
+n94 ::= P379 T27 T33 n96. { /* r */ }
+n95 ::= P380 n96 T34 T9. { /* r */ }
+n95 ::= P381 T33. { /* r */ }
+n95 ::= P382 T21 n98. { /* r */ }
+n95 ::= P383 T11 T31. { /* r */ }
+n96 ::= P384 n97 T5 T30 n97 T8. { /* r */ }
+n96 ::= P385 n98 n98 T33. { /* r */ }
+n96 ::= P386 n99 T0 n98 T33. { /* r */ }
+n96 ::= P387 T6 n97. { /* r */ }
+n97 ::= P388 n98 T28 n99 n98 T22. { /* r */ }
+n97 ::= P389 T23 n98 T9 T1. { /* r */ }
+n97 ::= P390 n99 n99. { /* r */ }
+n97 ::= P391 T33. { /* r */ }
+n98 ::= P392 n99 T17. { /* r */ }
+n98 ::= P393 T15 n99 n99 n99. { /* r */ }
+n98 ::= P394 T33 T3 T15 n99. { /* r */ }
+n98 ::= P395 n99 T9 T30 n99. { /* r */ }
+n99 ::= P396 T37. { /* r */ }
+n99 ::= P397 T34 T6 T25 T34. { /* r */ }
+n99 ::= P398 T33 T20 T4 T39. { /* r */ }
+n99 ::= P399 T22 T12 T37. { /* r */ }
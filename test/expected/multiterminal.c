@@ -0,0 +1,1597 @@
+/* Driver template for the LEMON parser generator.
+ * The author disclaims copyright to this source code.
+ */
+#include <assert.h>
+#include <stdlib.h>
+
+/* Make sure the INTERFACE macro is defined. */
+#ifndef INTERFACE
+#define INTERFACE 1
+#endif
+
+/* Next is all token values, in a form suitable for use by makeheaders.
+ * This section will be null unless lemon is run with the -m switch.
+ */
+/* These constants (all generated automatically by the parser generator)
+ * specify the various kinds of tokens (terminals) that the parser
+ * understands.
+ *
+ * Each symbol here is a terminal symbol in the grammar.
+ */
+// clang-format off
+#if INTERFACE
+#define LP                              1
+#define A                               2
+#define B                               3
+#define RP                              4
+#define C                               5
+#define E                               6
+#endif
+// clang-format on
+/* The next thing included is series of defines which control
+ * various aspects of the generated parser.
+ *    YYCODETYPE         is the data type used for storing terminal
+ *                       and nonterminal numbers.  "unsigned char" is
+ *                       used if there are fewer than 250 terminals
+ *                       and nonterminals.  "int" is used otherwise.
+ *    YYNOCODE           is a number of type YYCODETYPE which corresponds
+ *                       to no legal terminal or nonterminal number.  This
+ *                       number is used to fill in empty slots of the hash
+ *                       table.
+ *    YYFALLBACK         If defined, this indicates that one or more tokens
+ *                       have fall-back values which should be used if the
+ *                       original value of the token will not parse.
+ *    YYTOKENCLASS       If defined, terminals are looked up in the action
+ *                       table by their class in yy_token_class[].
+ *    YYACTIONTYPE       is the data type used for storing terminal
+ *                       and nonterminal numbers.  "unsigned char" is
+ *                       used if there are fewer than 250 rules and
+ *                       states combined.  "int" is used otherwise.
+ *    ParseTOKENTYPE     is the data type used for minor tokens given
+ *                       directly to the parser from the tokenizer.
+ *    YYMINORTYPE        is the data type used for all minor tokens.
+ *                       This is typically a union of many types, one of
+ *                       which is ParseTOKENTYPE.  The entry in the union
+ *                       for base tokens is called "yy0".
+ *    YYMINORTYPES(X)    lists the number and type of every member of
+ *                       YYMINORTYPE, for ParseUnionReport().
+ *    YYBOXTYPES(X)      If defined, lists the types of the %boxed symbols.
+ *                       Their values are kept in a box arena, one box per
+ *                       stack entry, and YYMINORTYPE holds a pointer to
+ *                       the box in its "yybox" member.
+ *    YYSTACKDEPTH       is the maximum depth of the parser's stack.  If
+ *                       zero the stack is dynamically sized using realloc()
+ *    ParseARG_SDECL     A static variable declaration for the %extra_argument
+ *    ParseARG_PDECL     A parameter declaration for the %extra_argument
+ *    ParseARG_STORE     Code to store %extra_argument into yypParser
+ *    ParseARG_FETCH     Code to extract %extra_argument from yypParser
+ *    ParseARG_PARAM(X)  Passes X as the %extra_argument in a call to Parse
+ *    YYNSTATE           the combined number of states.
+ *    YYNRULE            the number of rules in the grammar
+ *    YYERRORSYMBOL      is the code number of the error symbol.  If not
+ *                       defined, then do no error processing.
+ *    YYSYNCTOKEN        is the code number of the %sync_token.  If
+ *                       defined, ParseParallel() is available when
+ *                       YYPARSEPOOL is also defined.
+ *    YYTABLEFILE        If defined, the parse tables are read at run time
+ *                       by ParseLoadTables() instead of compiled in.
+ *    YYTABLESIGNATURE   identifies the symbols and rules of the grammar
+ *                       that a table file must have been made from.
+ *    YYNTOKEN           the number of terminals.
+ */
+
+// clang-format off
+#define YYCODETYPE unsigned char
+#define YYNOCODE 14
+#define YYNTOKEN 7
+#define YYACTIONTYPE unsigned char
+#if INTERFACE
+#define ParseTOKENTYPE void*
+#endif
+typedef union {
+  int yyinit;
+  ParseTOKENTYPE yy0;
+} YYMINORTYPE;
+#define YYMINORTYPES(X) X(0, ParseTOKENTYPE)
+#ifndef YYSTACKDEPTH
+#define YYSTACKDEPTH 100
+#endif
+#if INTERFACE
+#define ParseARG_SDECL
+#define ParseARG_PDECL
+#define ParseARG_FETCH
+#define ParseARG_STORE
+#define ParseARG_PARAM(X)
+#endif
+#define YYNSTATE 12
+#define YYNRULE 8
+#define YYTOKENCLASS 1
+// clang-format on
+#ifndef NDEBUG
+#include <stdio.h>
+void ParseTrace(FILE *, char *);
+void ParseUnionReport(FILE *);
+#endif
+void *ParseAlloc();
+void ParseFree(void *);
+void Parse(void *, int , ParseTOKENTYPE yyminor ParseARG_PDECL);
+int ParseExpectedTokens(void *, int *, int);
+#ifdef YYTABLEFILE
+int ParseLoadTables(const char *);
+void ParseUnloadTables(void);
+#endif
+
+/* First off, code is included that follows the "include" declaration
+ * in the input grammar file.
+ */
+// clang-format off
+#include "multiterminal.h"
+// clang-format on
+#ifdef YYBOXTYPES
+#include <string.h>
+
+/* The box of a stack entry holds the value of a boxed symbol, so that
+ * a large type does not make every entry of the stack as large.
+ */
+union yyBox {
+#define YY_BOX_MEMBER(N, T) T yy##N;
+  YYBOXTYPES(YY_BOX_MEMBER)
+#undef YY_BOX_MEMBER
+};
+#endif
+#define YY_NO_ACTION (YYNSTATE + YYNRULE + 2)
+#define YY_ACCEPT_ACTION (YYNSTATE + YYNRULE + 1)
+#define YY_ERROR_ACTION (YYNSTATE + YYNRULE)
+
+/* The yyzerominor constant is used to initialize instances of
+ * YYMINORTYPE objects to zero.
+ */
+static const YYMINORTYPE yyzerominor = {0};
+
+/* Define the yytestcase() macro to be a no-op if is not already defined
+ * otherwise.
+ *
+ * Applications can choose to define yytestcase() in the %include section
+ * to a macro that can assist in verifying code coverage.  For production
+ * code the yytestcase() macro should be turned off.  But it is useful
+ * for testing.
+ */
+#ifndef yytestcase
+#define yytestcase(X)
+#endif
+
+/* Next are the tables used to determine what action to take based on the
+ * current state and lookahead token.  These tables are used to implement
+ * functions that take a state number and lookahead value and return an
+ * action integer.
+ *
+ * Suppose the action integer is N.  Then the action is determined as
+ * follows
+ *
+ *   0 <= N < YYNSTATE                  Shift N.  That is, push the lookahead
+ *                                      token onto the stack and goto state N.
+ *
+ *   YYNSTATE <= N < YYNSTATE+YYNRULE   Reduce by rule N-YYNSTATE.
+ *
+ *   N == YYNSTATE+YYNRULE              A syntax error has occurred.
+ *
+ *   N == YYNSTATE+YYNRULE+1            The parser accepts its input.
+ *
+ *   N == YYNSTATE+YYNRULE+2            No such action.  Denotes unused
+ *                                      slots in the yy_action[] table.
+ *
+ * The action table is constructed as a single large table named yy_action[].
+ * Given state S and lookahead X, the action is computed as
+ *
+ *      yy_action[ yy_shift_ofst[S] + X ]
+ *
+ * If the index value yy_shift_ofst[S]+X is out of range or if the value
+ * yy_lookahead[yy_shift_ofst[S]+X] is not equal to X or if yy_shift_ofst[S]
+ * is equal to YY_SHIFT_USE_DFLT, it means that the action is not in the table
+ * and that yy_default[S] should be used instead.
+ *
+ * The formula above is for computing the action when the lookahead is
+ * a terminal symbol.  If the lookahead is a non-terminal (as occurs after
+ * a reduce action) then the yy_reduce_ofst[] array is used in place of
+ * the yy_shift_ofst[] array and YY_REDUCE_USE_DFLT is used in place of
+ * YY_SHIFT_USE_DFLT, and a goto that is not in the table is found in
+ * yy_goto_default[X-YYNTOKEN] instead of yy_default[S].
+ *
+ * The following are the tables generated in this section:
+ *
+ *  yy_action[]        A single table containing all actions.
+ *  yy_lookahead[]     A table containing the lookahead for each entry in
+ *                     yy_action.  Used to detect hash collisions.
+ *  yy_shift_ofst[]    For each state, the offset into yy_action for
+ *                     shifting terminals.
+ *  yy_reduce_ofst[]   For each state, the offset into yy_action for
+ *                     shifting non-terminals after a reduce.
+ *  yy_default[]       Default action for each state.
+ *  yy_goto_default[]  For each non-terminal, the state that most gotos on
+ *                     it lead to.  yy_action holds only the others.
+ *  yy_expected[]      Bitmaps of YY_EXPECTED_WORDS words of the terminals
+ *                     that states expect, for ParseExpectedTokens().
+ *  yy_expected_row[]  For each state, the number of its bitmap.
+ *  yy_token_class[]   For each terminal, the terminal whose actions it
+ *                     shares.  Only present if YYTOKENCLASS is defined.
+ *
+ * States numbered YY_MIN_AUTOREDUCE and up have no action but to reduce
+ * by the rule of yy_default[], which the parser does right after the
+ * shift into them unless YYNOEAGERREDUCE is defined.
+ */
+// clang-format off
+#define YY_ACTTAB_COUNT (29)
+static const YYACTIONTYPE yy_action[] = {
+ /*     0 */    13,   13,   13,   15,   15,   15,   16,   16,   16,   17,
+ /*    10 */    17,   17,   14,   14,   14,   12,    2,   10,   18,    2,
+ /*    20 */    10,   11,    8,   19,    7,    7,    5,   22,    4,
+};
+static const YYCODETYPE yy_lookahead[] = {
+ /*     0 */     0,    1,    2,    0,    1,    2,    0,    1,    2,    0,
+ /*    10 */     1,    2,    0,    1,    2,    0,    1,    2,    2,    1,
+ /*    20 */     2,    2,    6,    2,   10,   11,    4,   13,    5,
+};
+#define YY_SHIFT_USE_DFLT (-1)
+#define YY_SHIFT_COUNT (11)
+#define YY_SHIFT_MIN   (0)
+#define YY_SHIFT_MAX   (23)
+static const signed char yy_shift_ofst[] = {
+ /*     0 */    18,   15,   16,   12,    9,    6,    3,    0,   21,   19,
+ /*    10 */    23,   22,
+};
+#define YY_REDUCE_USE_DFLT (-1)
+#define YY_REDUCE_COUNT (1)
+#define YY_REDUCE_MIN   (0)
+#define YY_REDUCE_MAX   (14)
+static const signed char yy_reduce_ofst[] = {
+ /*     0 */    -1,   14,
+};
+static const YYACTIONTYPE yy_default[] = {
+ /*     0 */    20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+ /*    10 */    20,   20,
+};
+static const YYACTIONTYPE yy_goto_default[] = {
+ /*     0 */    22,   21,    1,    1,    1,    9,
+};
+#define YY_EXPECTED_WORDS (1)
+static const unsigned int yy_expected[] = {
+ 0x0000000e, 0x0000000f, 0x0000004c, 0x0000000c, 0x00000020, 0x00000010,
+};
+static const unsigned char yy_expected_row[] = {
+ /*     0 */     0,    1,    2,    1,    1,    1,    1,    1,    3,    3,
+ /*    10 */     4,    5,
+};
+#define YY_MIN_AUTOREDUCE (12)
+static const YYCODETYPE yy_token_class[] = {
+ /*     0 */     0,    1,    2,    2,    4,    5,    6,
+};
+// clang-format on
+#ifdef YYTABLEFILE
+/* The tables above are not compiled into this parser.  ParseLoadTables()
+ * reads them at run time from the binary file that "lemon -b" writes
+ * along with the parser, and the macros below stand for their parts.
+ *
+ * The file starts with the 8 bytes "LEMONTBL" and a header of the
+ * YYTBL_NWORD words numbered below.  Every table is an array of
+ * 32-bit integers at the offset from the start of the file given in
+ * the header, and the parser reads it where it lies.  All integers are
+ * in the byte order of the machine that ran lemon.  The token names
+ * come last, as offsets to NUL-terminated strings.
+ */
+#include <stdio.h>
+#include <string.h>
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define YYTBL_MAGIC "LEMONTBL"
+#define YYTBL_VERSION 4
+#define YYTBL_BYTEORDER 0x01020304
+
+enum {
+  YYTBL_W_VERSION,       // YYTBL_VERSION
+  YYTBL_W_BYTEORDER,     // YYTBL_BYTEORDER, as written by lemon
+  YYTBL_W_SIGNATURE,     // YYTABLESIGNATURE of the grammar
+  YYTBL_W_NOCODE,        // YYNOCODE
+  YYTBL_W_NRULE,         // YYNRULE
+  YYTBL_W_NSTATE,        // YYNSTATE
+  YYTBL_W_NACTION,       // Entries in yy_action[] and yy_lookahead[]
+  YYTBL_W_NSHIFT,        // Entries in yy_shift_ofst[]
+  YYTBL_W_NREDUCE,       // Entries in yy_reduce_ofst[]
+  YYTBL_W_SHIFT_DFLT,    // YY_SHIFT_USE_DFLT
+  YYTBL_W_REDUCE_DFLT,   // YY_REDUCE_USE_DFLT
+  YYTBL_W_MIN_AUTOREDUCE, // YY_MIN_AUTOREDUCE
+  YYTBL_W_NTOKEN,        // Entries in yy_token_class[]
+  YYTBL_W_NFALLBACK,     // Entries in yyFallback[]
+  YYTBL_W_NEXPECTED,     // Number of bitmaps in yy_expected[]
+  YYTBL_W_ACTION,        // Offset of yy_action[]
+  YYTBL_W_LOOKAHEAD,     // Offset of yy_lookahead[]
+  YYTBL_W_SHIFT_OFST,    // Offset of yy_shift_ofst[]
+  YYTBL_W_REDUCE_OFST,   // Offset of yy_reduce_ofst[]
+  YYTBL_W_DEFAULT,       // Offset of yy_default[]
+  YYTBL_W_GOTO_DEFAULT,  // Offset of yy_goto_default[]
+  YYTBL_W_EXPECTED,      // Offset of yy_expected[]
+  YYTBL_W_EXPECTED_ROW,  // Offset of yy_expected_row[]
+  YYTBL_W_TOKEN_CLASS,   // Offset of yy_token_class[]
+  YYTBL_W_FALLBACK,      // Offset of yyFallback[]
+  YYTBL_W_TOKEN_NAME,    // Offset of the YYNOCODE-1 offsets of the names
+  YYTBL_W_SIZE,          // Size of the file in bytes, a multiple of 8
+  YYTBL_W_CHECKSUM,      // FNV-1a hash of all other words after the magic
+  YYTBL_NWORD
+};
+
+/* The tables in use, and the file they came from */
+static struct {
+  char *pFile;                              // Content of the table file
+  size_t nFile;                             // Size of the file in bytes
+  int isMapped;                             // True if pFile is mapped, false if malloc()ed
+  int nState;                               // YYNSTATE
+  int nAction;                              // YY_ACTTAB_COUNT
+  int nShift;                               // YY_SHIFT_COUNT+1
+  int nReduce;                              // YY_REDUCE_COUNT+1
+  int iShiftUseDflt;                        // YY_SHIFT_USE_DFLT
+  int iReduceUseDflt;                       // YY_REDUCE_USE_DFLT
+  int iMinAutoReduce;                       // YY_MIN_AUTOREDUCE
+  int nFallback;                            // Entries in yyFallback[]
+  const int *aAction;                       // yy_action[]
+  const int *aLookahead;                    // yy_lookahead[]
+  const int *aShiftOfst;                    // yy_shift_ofst[]
+  const int *aReduceOfst;                   // yy_reduce_ofst[]
+  const int *aDefault;                      // yy_default[]
+  const int *aGotoDefault;                  // yy_goto_default[]
+  const unsigned int *aExpected;            // yy_expected[]
+  const int *aExpectedRow;                  // yy_expected_row[]
+  const int *aTokenClass;                   // yy_token_class[]
+  const int *aFallback;                     // yyFallback[]
+#ifndef NDEBUG
+  const char **azTokenName;                 // yyTokenName[]
+#endif
+} yyTables;
+
+#define YY_ACTTAB_COUNT (yyTables.nAction)
+#define YY_SHIFT_USE_DFLT (yyTables.iShiftUseDflt)
+#define YY_SHIFT_COUNT (yyTables.nShift - 1)
+#define YY_REDUCE_USE_DFLT (yyTables.iReduceUseDflt)
+#define YY_REDUCE_COUNT (yyTables.nReduce - 1)
+#define YY_MIN_AUTOREDUCE (yyTables.iMinAutoReduce)
+#define YY_FALLBACK_COUNT (yyTables.nFallback)
+#define yy_action (yyTables.aAction)
+#define yy_lookahead (yyTables.aLookahead)
+#define yy_shift_ofst (yyTables.aShiftOfst)
+#define yy_reduce_ofst (yyTables.aReduceOfst)
+#define yy_default (yyTables.aDefault)
+#define yy_goto_default (yyTables.aGotoDefault)
+#define yy_expected (yyTables.aExpected)
+#define yy_expected_row (yyTables.aExpectedRow)
+#define YY_EXPECTED_WORDS ((YYNTOKEN + 31) / 32)
+#define yy_token_class (yyTables.aTokenClass)
+#define yyFallback (yyTables.aFallback)
+#ifndef NDEBUG
+#define yyTokenName (yyTables.azTokenName)
+#endif
+
+/* Return a pointer to the n words of a table at offset iOfst of the
+ * file, or NULL if they are not all inside the file or not aligned.
+ */
+static const int *
+yyTableAt(const char *pFile, size_t nFile, unsigned int iOfst, size_t n) {
+  if (iOfst % sizeof(int) != 0 || iOfst > nFile || n > (nFile - iOfst) / sizeof(int))
+    return 0;
+  return (const int *)&pFile[iOfst];
+}
+
+/* Add the n words of a[] to the FNV-1a hash h */
+static unsigned int
+yyTableChecksum(unsigned int h, const unsigned int *a, size_t n) {
+  size_t i;
+  for (i = 0; i < n; i++)
+    h = (h ^ a[i]) * 0x01000193;
+  return h;
+}
+
+/* Return true if all n values of a[] are between lwr and upr */
+static int
+yyTableInRange(const int *a, int n, int lwr, int upr) {
+  int i;
+  for (i = 0; i < n; i++) {
+    if (a[i] < lwr || a[i] > upr)
+      return 0;
+  }
+  return 1;
+}
+
+/* Release the tables read by ParseLoadTables().  No parser may be
+ * used afterwards until tables are loaded again.
+ */
+void
+ParseUnloadTables(void) {
+#ifndef NDEBUG
+  free((void *)yyTables.azTokenName);
+#endif
+  if (yyTables.isMapped) {
+#ifndef __WIN32__
+    munmap(yyTables.pFile, yyTables.nFile);
+#endif
+  } else {
+    free(yyTables.pFile);
+  }
+  memset(&yyTables, 0, sizeof(yyTables));
+}
+
+/* Read the parse tables from the file zFile, which "lemon -b" made from
+ * this same grammar.  The file is mapped into memory where the system
+ * allows it, so processes that load the same file share its pages.
+ * Tables loaded before are released.  No parser may be running while
+ * the tables change.
+ *
+ * Outputs:
+ * 0 on success.  -1 if the file cannot be read or does not hold tables
+ * for this grammar, in which case the tables in use stay as they were.
+ */
+int
+ParseLoadTables(const char *zFile) {
+  char *pFile = 0;
+  size_t nFile = 0;
+  int isMapped = 0;
+  const unsigned int *aHdr;
+  const int *aAction, *aLookahead, *aShiftOfst, *aReduceOfst, *aDefault, *aGotoDefault;
+  const int *aExpected, *aExpectedRow;
+  const int *aTokenClass, *aFallback, *aName;
+  int nState, nAction, nShift, nReduce, nFallback, nExpected, nLast, i;
+#ifndef NDEBUG
+  const char **azTokenName;
+#endif
+
+#ifndef __WIN32__
+  {
+    struct stat st;
+    int fd = open(zFile, O_RDONLY);
+    if (fd < 0)
+      return -1;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      nFile = (size_t)st.st_size;
+      pFile = (char *)mmap(0, nFile, PROT_READ, MAP_SHARED, fd, 0);
+      if (pFile == (char *)MAP_FAILED)
+        pFile = 0;
+      else
+        isMapped = 1;
+    }
+    close(fd);
+  }
+#endif
+  if (pFile == 0) {
+    FILE *in = fopen(zFile, "rb");
+    long n;
+    if (in == 0)
+      return -1;
+    if (fseek(in, 0, SEEK_END) == 0 && (n = ftell(in)) > 0 && fseek(in, 0, SEEK_SET) == 0) {
+      nFile = (size_t)n;
+      pFile = (char *)malloc(nFile);
+      if (pFile && fread(pFile, 1, nFile, in) != nFile) {
+        free(pFile);
+        pFile = 0;
+      }
+    }
+    fclose(in);
+    if (pFile == 0)
+      return -1;
+  }
+
+  /* Check that the file holds tables for this parser, undamaged, and
+   * that nothing in them leads the parser outside of them.
+   */
+  aHdr = (const unsigned int *)yyTableAt(pFile, nFile, 8, YYTBL_NWORD);
+  if (aHdr == 0 || memcmp(pFile, YYTBL_MAGIC, 8) != 0 || aHdr[YYTBL_W_VERSION] != YYTBL_VERSION ||
+      aHdr[YYTBL_W_BYTEORDER] != YYTBL_BYTEORDER || aHdr[YYTBL_W_SIGNATURE] != YYTABLESIGNATURE ||
+      aHdr[YYTBL_W_NOCODE] != YYNOCODE || aHdr[YYTBL_W_NRULE] != YYNRULE || aHdr[YYTBL_W_SIZE] != nFile ||
+      aHdr[YYTBL_W_NTOKEN] != YYNTOKEN || nFile % 8 != 0 || pFile[nFile - 1] != 0 ||
+      aHdr[YYTBL_W_CHECKSUM] != yyTableChecksum(yyTableChecksum(0x811c9dc5, aHdr, YYTBL_W_CHECKSUM),
+                                                &aHdr[YYTBL_NWORD], nFile / 4 - 2 - YYTBL_NWORD)) {
+    goto bad_file;
+  }
+  nState = (int)aHdr[YYTBL_W_NSTATE];
+  nAction = (int)aHdr[YYTBL_W_NACTION];
+  nShift = (int)aHdr[YYTBL_W_NSHIFT];
+  nReduce = (int)aHdr[YYTBL_W_NREDUCE];
+  nFallback = (int)aHdr[YYTBL_W_NFALLBACK];
+  nExpected = (int)aHdr[YYTBL_W_NEXPECTED];
+  if (nState <= 0 || nAction < 0 || nShift < 0 || nShift > nState || nReduce < 0 || nReduce > nState ||
+      nFallback < 0 || nFallback > YYNTOKEN || nExpected <= 0 || nExpected > nState) {
+    goto bad_file;
+  }
+  nLast = nState + YYNRULE + 2; // YY_NO_ACTION
+  aAction = yyTableAt(pFile, nFile, aHdr[YYTBL_W_ACTION], nAction);
+  aLookahead = yyTableAt(pFile, nFile, aHdr[YYTBL_W_LOOKAHEAD], nAction);
+  aShiftOfst = yyTableAt(pFile, nFile, aHdr[YYTBL_W_SHIFT_OFST], nShift);
+  aReduceOfst = yyTableAt(pFile, nFile, aHdr[YYTBL_W_REDUCE_OFST], nReduce);
+  aDefault = yyTableAt(pFile, nFile, aHdr[YYTBL_W_DEFAULT], nState);
+  aGotoDefault = yyTableAt(pFile, nFile, aHdr[YYTBL_W_GOTO_DEFAULT], YYNOCODE - 1 - YYNTOKEN);
+  aExpected = yyTableAt(pFile, nFile, aHdr[YYTBL_W_EXPECTED], (size_t)nExpected * YY_EXPECTED_WORDS);
+  aExpectedRow = yyTableAt(pFile, nFile, aHdr[YYTBL_W_EXPECTED_ROW], nState);
+  aTokenClass = yyTableAt(pFile, nFile, aHdr[YYTBL_W_TOKEN_CLASS], YYNTOKEN);
+  aFallback = yyTableAt(pFile, nFile, aHdr[YYTBL_W_FALLBACK], nFallback);
+  aName = yyTableAt(pFile, nFile, aHdr[YYTBL_W_TOKEN_NAME], YYNOCODE - 1);
+  if (aAction == 0 || aLookahead == 0 || aShiftOfst == 0 || aReduceOfst == 0 || aDefault == 0 || aGotoDefault == 0 ||
+      aTokenClass == 0 || aFallback == 0 || aName == 0 || aExpected == 0 || aExpectedRow == 0 ||
+      !yyTableInRange(aExpectedRow, nState, 0, nExpected - 1) ||
+      !yyTableInRange(aAction, nAction, 0, nLast) || !yyTableInRange(aLookahead, nAction, 0, YYNOCODE - 1) ||
+      !yyTableInRange(aDefault, nState, 0, nLast) || !yyTableInRange(aGotoDefault, YYNOCODE - 1 - YYNTOKEN, 0, nLast) ||
+      !yyTableInRange(aTokenClass, YYNTOKEN, 0, YYNTOKEN - 1) ||
+      !yyTableInRange(aFallback, nFallback, 0, YYNTOKEN - 1) ||
+      !yyTableInRange(aName, YYNOCODE - 1, (int)aHdr[YYTBL_W_TOKEN_NAME] + 4 * (YYNOCODE - 1), (int)nFile - 1)) {
+    goto bad_file;
+  }
+#ifndef NDEBUG
+  azTokenName = (const char **)malloc((YYNOCODE - 1) * sizeof(azTokenName[0]));
+  if (azTokenName == 0)
+    goto bad_file;
+  for (i = 0; i < YYNOCODE - 1; i++)
+    azTokenName[i] = &pFile[aName[i]];
+#endif
+
+  ParseUnloadTables();
+  yyTables.pFile = pFile;
+  yyTables.nFile = nFile;
+  yyTables.isMapped = isMapped;
+  yyTables.nState = nState;
+  yyTables.nAction = nAction;
+  yyTables.nShift = nShift;
+  yyTables.nReduce = nReduce;
+  yyTables.iShiftUseDflt = (int)aHdr[YYTBL_W_SHIFT_DFLT];
+  yyTables.iReduceUseDflt = (int)aHdr[YYTBL_W_REDUCE_DFLT];
+  yyTables.iMinAutoReduce = (int)aHdr[YYTBL_W_MIN_AUTOREDUCE];
+  yyTables.nFallback = nFallback;
+  yyTables.aAction = aAction;
+  yyTables.aLookahead = aLookahead;
+  yyTables.aShiftOfst = aShiftOfst;
+  yyTables.aReduceOfst = aReduceOfst;
+  yyTables.aDefault = aDefault;
+  yyTables.aGotoDefault = aGotoDefault;
+  yyTables.aExpected = (const unsigned int *)aExpected;
+  yyTables.aExpectedRow = aExpectedRow;
+  yyTables.aTokenClass = aTokenClass;
+  yyTables.aFallback = aFallback;
+#ifndef NDEBUG
+  yyTables.azTokenName = azTokenName;
+#endif
+  return 0;
+
+bad_file:
+  if (isMapped) {
+#ifndef __WIN32__
+    munmap(pFile, nFile);
+#endif
+  } else {
+    free(pFile);
+  }
+  return -1;
+}
+#else
+#define YY_FALLBACK_COUNT ((int)(sizeof(yyFallback) / sizeof(yyFallback[0])))
+#endif /* YYTABLEFILE */
+
+/* States from YY_MIN_AUTOREDUCE on are reduced right after the shift
+ * into them, unless YYNOEAGERREDUCE is defined or there are none.
+ */
+#ifndef YYNOEAGERREDUCE
+#ifdef YYTABLEFILE
+#define YYEAGERREDUCE 1
+#else
+#if YY_MIN_AUTOREDUCE < YYNSTATE
+#define YYEAGERREDUCE 1
+#endif
+#endif
+#endif
+
+/* The next table maps tokens into fallback tokens.  If a construct
+ * like the following:
+ *
+ *      %fallback ID X Y Z.
+ *
+ * appears in the grammar, then ID becomes a fallback token for X, Y,
+ * and Z.  Whenever one of the tokens X, Y, or Z is input to the parser
+ * but it does not parse, the type of the token is changed to ID and
+ * the parse is retried before an error is thrown.
+ */
+#if defined(YYFALLBACK) && !defined(YYTABLEFILE)
+static const YYCODETYPE yyFallback[] = {
+// clang-format off
+// clang-format on
+};
+#endif /* YYFALLBACK */
+
+/* The following structure represents a single element of the
+ * parser's stack.  Information stored includes:
+ *
+ *   +  The state number for the parser at this level of the stack.
+ *
+ *   +  The value of the token stored at this level of the stack.
+ *      (In other words, the "major" token.)
+ *
+ *   +  The semantic value stored at this level of the stack.  This is
+ *      the information used by the action routines in the grammar.
+ *      It is sometimes called the "minor" token.
+ */
+struct yyStackEntry {
+  YYACTIONTYPE stateno; // The state-number
+  YYCODETYPE major;     // The major token value.  This is the code number for the token at this stack level
+  YYMINORTYPE minor;    // The user-supplied minor token value.  This is the value of the token
+};
+typedef struct yyStackEntry yyStackEntry;
+
+/* The state of the parser is completely contained in an instance of
+ * the following structure
+ */
+struct yyParser {
+  int yyidx; // Index of top element in stack
+#ifdef YYTRACKMAXSTACKDEPTH
+  int yyidxMax; // Maximum value of yyidx
+#endif
+  int yyerrcnt;  // Shifts left before out of the error
+  ParseARG_SDECL // A place to hold %extra_argument
+#if YYSTACKDEPTH <= 0
+  int yystksz;           // Current side of the stack
+  yyStackEntry *yystack; // The parser's stack
+#ifdef YYBOXTYPES
+  int yynbox;            // Number of chunks of boxes
+  union yyBox **yyboxes; // Chunks of YYBOXCHUNK boxes, which never move
+#endif
+#else
+  yyStackEntry yystack[YYSTACKDEPTH]; // The parser's stack
+#ifdef YYBOXTYPES
+  union yyBox yybox[YYSTACKDEPTH + 1]; // The box of each stack entry, and one for a reduce
+#endif
+#endif
+};
+typedef struct yyParser yyParser;
+
+/* yyBoxAt(p, i) is the box of the i-th entry of the stack.  The box
+ * above the top of the stack holds the left-hand side of a reduce until
+ * the right-hand side is popped.
+ */
+#ifdef YYBOXTYPES
+#if YYSTACKDEPTH > 0
+#define yyBoxAt(p, i) (&(p)->yybox[i])
+#else
+#define YYBOXCHUNK 64
+#define yyBoxAt(p, i) (&(p)->yyboxes[(i) / YYBOXCHUNK][(i) % YYBOXCHUNK])
+#endif
+#endif
+
+#ifndef NDEBUG
+static FILE *yyTraceFILE = 0;
+static char *yyTracePrompt = 0;
+
+/* Turn parser tracing on by giving a stream to which to write the trace
+ * and a prompt to preface each trace message.  Tracing is turned off
+ * by making either argument NULL
+ *
+ * Inputs:
+ * <ul>
+ * <li> A FILE* to which trace output should be written.
+ *      If NULL, then tracing is turned off.
+ * <li> A prefix string written at the beginning of every
+ *      line of trace output.  If NULL, then tracing is
+ *      turned off.
+ * </ul>
+ *
+ * Outputs:
+ * None.
+ */
+void
+ParseTrace(FILE *TraceFILE, char *zTracePrompt) {
+  yyTraceFILE = TraceFILE;
+  yyTracePrompt = zTracePrompt;
+  if (yyTraceFILE == 0)
+    yyTracePrompt = 0;
+  else if (yyTracePrompt == 0)
+    yyTraceFILE = 0;
+}
+
+/* Write the size of every member of the union of semantic values, to
+ * find the types that make each entry of the stack large.  A boxed type
+ * is listed with the size of its box, as the stack only holds a pointer
+ * to it.
+ */
+void
+ParseUnionReport(FILE *out) {
+  static const struct {
+    int iMember;       // The member is yy<iMember>
+    const char *zType; // Its type, as declared in the grammar
+    unsigned nByte;    // Size of the type
+    int isBoxed;       // True if the value is kept in a box
+  } aMember[] = {
+#define YY_MEMBER(N, T) {N, #T, (unsigned)sizeof(T), 0},
+    YYMINORTYPES(YY_MEMBER)
+#undef YY_MEMBER
+#ifdef YYBOXTYPES
+#define YY_MEMBER(N, T) {N, #T, (unsigned)sizeof(T), 1},
+    YYBOXTYPES(YY_MEMBER)
+#undef YY_MEMBER
+#endif
+  };
+  unsigned i;
+  fprintf(out, "YYMINORTYPE: %u bytes, stack entry: %u bytes\n", (unsigned)sizeof(YYMINORTYPE),
+          (unsigned)sizeof(yyStackEntry));
+  for (i = 0; i < sizeof(aMember) / sizeof(aMember[0]); i++) {
+    const char *zNote = "";
+    if (aMember[i].isBoxed)
+      zNote = "  (boxed)";
+    else if (aMember[i].nByte == sizeof(YYMINORTYPE))
+      zNote = "  (sets the size)";
+    fprintf(out, "  yy%-5d %6u  %s%s\n", aMember[i].iMember, aMember[i].nByte, aMember[i].zType, zNote);
+  }
+}
+
+/* For tracing shifts, the names of all terminals and nonterminals
+ * are required.  The following table supplies these names
+ */
+#ifndef YYTABLEFILE
+static const char *const yyTokenName[] = {
+// clang-format off
+  "$",             "LP",            "A",             "B",           
+  "RP",            "C",             "E",             "error",       
+  "start",         "list",          "item",          "x",           
+  "z",           
+// clang-format on
+};
+#endif
+
+/* For tracing reduce actions, the names of all rules are required. */
+static const char *const yyRuleName[] = {
+// clang-format off
+ /*   0 */ "start ::= list",
+ /*   1 */ "list ::= list item",
+ /*   2 */ "list ::= item",
+ /*   3 */ "item ::= x",
+ /*   4 */ "item ::= LP z A|B RP",
+ /*   5 */ "x ::= A|B C",
+ /*   6 */ "z ::=",
+ /*   7 */ "z ::= E",
+// clang-format on
+};
+#endif /* NDEBUG */
+
+#if YYSTACKDEPTH <= 0
+/* Try to increase the size of the parser stack. */
+static void
+yyGrowStack(yyParser *p) {
+  int newSize;
+  yyStackEntry *pNew;
+
+  newSize = p->yystksz * 2 + 100;
+#ifdef YYBOXTYPES
+  /* The stack holds pointers to boxes, so they are added a chunk at a
+   * time rather than moved.  There is one box more than stack entries.
+   */
+  while (p->yynbox <= newSize / YYBOXCHUNK) {
+    union yyBox **aNew = realloc(p->yyboxes, (p->yynbox + 1) * sizeof(aNew[0]));
+    if (aNew == 0)
+      return;
+    p->yyboxes = aNew;
+    aNew[p->yynbox] = malloc(YYBOXCHUNK * sizeof(union yyBox));
+    if (aNew[p->yynbox] == 0)
+      return;
+    p->yynbox++;
+  }
+#endif
+  pNew = realloc(p->yystack, newSize * sizeof(pNew[0]));
+  if (pNew) {
+    p->yystack = pNew;
+    p->yystksz = newSize;
+#ifndef NDEBUG
+    if (yyTraceFILE) {
+      fprintf(yyTraceFILE, "%sStack grows to %d entries!\n", yyTracePrompt, p->yystksz);
+    }
+#endif
+  }
+}
+#endif
+
+/* This function allocates a new parser.
+ * The only argument is a pointer to a function which works like
+ * malloc.
+ *
+ * Inputs:
+ * A pointer to the function used to allocate memory.
+ *
+ * Outputs:
+ * A pointer to a parser.  This pointer is used in subsequent calls
+ * to Parse and ParseFree.
+ */
+void *
+ParseAlloc() {
+  yyParser *pParser;
+  pParser = (yyParser *)malloc((size_t)sizeof(yyParser));
+  if (pParser) {
+    pParser->yyidx = -1;
+#ifdef YYTRACKMAXSTACKDEPTH
+    pParser->yyidxMax = 0;
+#endif
+#if YYSTACKDEPTH <= 0
+    pParser->yystack = NULL;
+    pParser->yystksz = 0;
+#ifdef YYBOXTYPES
+    pParser->yyboxes = NULL;
+    pParser->yynbox = 0;
+#endif
+    yyGrowStack(pParser);
+#endif
+  }
+  return pParser;
+}
+
+/* The following function deletes the value associated with a
+ * symbol.  The symbol can be either a terminal or nonterminal.
+ * "yymajor" is the symbol code, and "yypminor" is a pointer to
+ * the value.
+ */
+static void
+yy_destructor(yyParser *yypParser,  // The parser
+              YYCODETYPE yymajor,   // Type code for object to destroy
+              YYMINORTYPE *yypminor // The object to be destroyed
+              ) {
+  ParseARG_FETCH;
+  switch (yymajor) {
+    /* Here is inserted the actions which take place when a
+     * terminal or non-terminal is destroyed.  This can happen
+     * when the symbol is popped from the stack during a
+     * reduce or during error processing or when a parser is
+     * being destroyed before it is finished parsing.
+     *
+     * Note: during a reduce, the only symbols destroyed are those
+     * which appear on the RHS of the rule, but which are not used
+     * inside the C code.
+     */
+// clang-format off
+// clang-format on
+    default : break; // If no destructor action specified: do nothing
+  }
+}
+
+/* Pop the parser's stack once.
+ *
+ * If there is a destructor routine associated with the token which
+ * is popped from the stack, then call it.
+ *
+ * Return the major token number for the symbol popped.
+ */
+static int
+yy_pop_parser_stack(yyParser *pParser) {
+  YYCODETYPE yymajor;
+  yyStackEntry *yytos = &pParser->yystack[pParser->yyidx];
+
+  if (pParser->yyidx < 0)
+    return 0;
+#ifndef NDEBUG
+  if (yyTraceFILE && pParser->yyidx >= 0) {
+    fprintf(yyTraceFILE, "%sPopping %s\n", yyTracePrompt, yyTokenName[yytos->major]);
+  }
+#endif
+  yymajor = yytos->major;
+  yy_destructor(pParser, yymajor, &yytos->minor);
+  pParser->yyidx--;
+  return yymajor;
+}
+
+/* Deallocate and destroy a parser.  Destructors are all called for
+ * all stack elements before shutting the parser down.
+ *
+ * Inputs:
+ * <ul>
+ * <li>  A pointer to the parser.  This should be a pointer
+ *       obtained from ParseAlloc.
+ * <li>  A pointer to a function used to reclaim memory obtained
+ *       from malloc.
+ * </ul>
+ */
+void
+ParseFree(void *p) {
+  yyParser *pParser = (yyParser *)p;
+  if (pParser == 0)
+    return;
+  while (pParser->yyidx >= 0)
+    yy_pop_parser_stack(pParser);
+#if YYSTACKDEPTH <= 0
+  free(pParser->yystack);
+#ifdef YYBOXTYPES
+  while (pParser->yynbox > 0)
+    free(pParser->yyboxes[--pParser->yynbox]);
+  free(pParser->yyboxes);
+#endif
+#endif
+  free((void *)pParser);
+}
+
+/* Return the peak depth of the stack for a parser. */
+#ifdef YYTRACKMAXSTACKDEPTH
+int
+ParseStackPeak(void *p) {
+  yyParser *pParser = (yyParser *)p;
+  return pParser->yyidxMax;
+}
+#endif
+
+/* Write the codes of up to nToken of the terminals that the parser
+ * expects next to aToken[], in increasing order, and return how many
+ * it expects in all.  Called from %syntax_error, these are the tokens
+ * that would have been accepted in place of the one in error.
+ */
+int
+ParseExpectedTokens(void *p, int *aToken, int nToken) {
+  yyParser *pParser = (yyParser *)p;
+  const unsigned int *aWord;
+  unsigned int w;
+  int stateno, i, j, n;
+
+  stateno = pParser->yyidx >= 0 ? pParser->yystack[pParser->yyidx].stateno : 0;
+  aWord = &yy_expected[yy_expected_row[stateno] * YY_EXPECTED_WORDS];
+  n = 0;
+  for (i = 0; i < YY_EXPECTED_WORDS; i++) {
+    for (w = aWord[i], j = 0; w; w >>= 1, j++) {
+      if (w & 1) {
+        if (n < nToken)
+          aToken[n] = i * 32 + j;
+        n++;
+      }
+    }
+  }
+  return n;
+}
+
+/* Find the appropriate action for a parser given the terminal
+ * look-ahead token iLookAhead, or rather its class in yy_token_class[].
+ *
+ * If the look-ahead token is YYNOCODE, then check to see if the action is
+ * independent of the look-ahead.  If it is, return the action, otherwise
+ * return YY_NO_ACTION.
+ */
+static int
+yy_find_shift_action(yyParser *pParser,    // The parser
+                     YYCODETYPE iLookAhead // The look-ahead token
+                     ) {
+  int i;
+  int stateno = pParser->yystack[pParser->yyidx].stateno;
+
+  if (stateno > YY_SHIFT_COUNT || (i = yy_shift_ofst[stateno]) == YY_SHIFT_USE_DFLT) {
+    return yy_default[stateno];
+  }
+  assert(iLookAhead != YYNOCODE);
+  i += iLookAhead;
+  if (i < 0 || i >= YY_ACTTAB_COUNT || yy_lookahead[i] != iLookAhead) {
+    if (iLookAhead > 0) {
+#ifdef YYFALLBACK
+      YYCODETYPE iFallback; // Fallback token
+      if (iLookAhead < YY_FALLBACK_COUNT && (iFallback = yyFallback[iLookAhead]) != 0) {
+#ifndef NDEBUG
+        if (yyTraceFILE) {
+          fprintf(yyTraceFILE, "%sFALLBACK %s => %s\n", yyTracePrompt, yyTokenName[iLookAhead], yyTokenName[iFallback]);
+        }
+#endif
+        return yy_find_shift_action(pParser, iFallback);
+      }
+#endif
+#ifdef YYWILDCARD
+      {
+        int j = i - iLookAhead + YYWILDCARD;
+        if (
+#if defined(YYTABLEFILE) || YY_SHIFT_MIN + YYWILDCARD < 0
+            j >= 0 &&
+#endif
+#ifdef YYTABLEFILE
+            j < YY_ACTTAB_COUNT &&
+#else
+#if YY_SHIFT_MAX + YYWILDCARD >= YY_ACTTAB_COUNT
+            j < YY_ACTTAB_COUNT &&
+#endif
+#endif
+            yy_lookahead[j] == YYWILDCARD) {
+#ifndef NDEBUG
+          if (yyTraceFILE) {
+            fprintf(yyTraceFILE, "%sWILDCARD %s => %s\n", yyTracePrompt, yyTokenName[iLookAhead],
+                    yyTokenName[YYWILDCARD]);
+          }
+#endif /* NDEBUG */
+          return yy_action[j];
+        }
+      }
+#endif /* YYWILDCARD */
+    }
+    return yy_default[stateno];
+  } else {
+    return yy_action[i];
+  }
+}
+
+/* Find the appropriate action for a parser given the non-terminal
+ * look-ahead token iLookAhead.
+ *
+ * If the look-ahead token is YYNOCODE, then check to see if the action is
+ * independent of the look-ahead.  If it is, return the action, otherwise
+ * return YY_NO_ACTION.  A goto that yy_action[] leaves out is the default
+ * of its non-terminal.
+ */
+static int
+yy_find_reduce_action(int stateno,          // Current state number
+                      YYCODETYPE iLookAhead // The look-ahead token
+                      ) {
+  int i;
+  assert(iLookAhead != YYNOCODE);
+  if (stateno <= YY_REDUCE_COUNT && yy_reduce_ofst[stateno] != YY_REDUCE_USE_DFLT) {
+    i = yy_reduce_ofst[stateno] + iLookAhead;
+    if (i >= 0 && i < YY_ACTTAB_COUNT && yy_lookahead[i] == iLookAhead) {
+      return yy_action[i];
+    }
+  }
+#ifdef YYERRORSYMBOL
+  if (iLookAhead == YYERRORSYMBOL) {
+    return yy_default[stateno];
+  }
+#endif
+  assert(iLookAhead >= YYNTOKEN);
+  return yy_goto_default[iLookAhead - YYNTOKEN];
+}
+
+/* The following routine is called if the stack overflows. */
+static void
+yyStackOverflow(yyParser *yypParser, YYMINORTYPE *yypMinor) {
+  ParseARG_FETCH;
+  yypParser->yyidx--;
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sStack Overflow!\n", yyTracePrompt);
+  }
+#endif
+  while (yypParser->yyidx >= 0)
+    yy_pop_parser_stack(yypParser);
+  /* Here code is inserted which will execute if the parser
+   * stack every overflows */
+// clang-format off
+// clang-format on
+  ParseARG_STORE; // Suppress warning about unused %extra_argument var
+}
+
+/* Perform a shift action. */
+static void
+yy_shift(yyParser *yypParser,  // The parser to be shifted
+         int yyNewState,       // The new state to shift in
+         int yyMajor,          // The major token to shift in
+         YYMINORTYPE *yypMinor // Pointer to the minor token to shift in
+         ) {
+  yyStackEntry *yytos;
+  yypParser->yyidx++;
+#ifdef YYTRACKMAXSTACKDEPTH
+  if (yypParser->yyidx > yypParser->yyidxMax) {
+    yypParser->yyidxMax = yypParser->yyidx;
+  }
+#endif
+#if YYSTACKDEPTH > 0
+  if (yypParser->yyidx >= YYSTACKDEPTH) {
+    yyStackOverflow(yypParser, yypMinor);
+    return;
+  }
+#else
+  if (yypParser->yyidx >= yypParser->yystksz) {
+    yyGrowStack(yypParser);
+    if (yypParser->yyidx >= yypParser->yystksz) {
+      yyStackOverflow(yypParser, yypMinor);
+      return;
+    }
+  }
+#endif
+  yytos = &yypParser->yystack[yypParser->yyidx];
+  yytos->stateno = (YYACTIONTYPE)yyNewState;
+  yytos->major = (YYCODETYPE)yyMajor;
+  yytos->minor = *yypMinor;
+#ifndef NDEBUG
+  if (yyTraceFILE && yypParser->yyidx > 0) {
+    int i;
+    fprintf(yyTraceFILE, "%sShift %d\n", yyTracePrompt, yyNewState);
+    fprintf(yyTraceFILE, "%sStack:", yyTracePrompt);
+    for (i = 1; i <= yypParser->yyidx; i++)
+      fprintf(yyTraceFILE, " %s", yyTokenName[yypParser->yystack[i].major]);
+    fprintf(yyTraceFILE, "\n");
+  }
+#endif
+}
+
+/* The following table contains information about every rule that
+ * is used during the reduce.  It is compiled in even with YYTABLEFILE,
+ * since the code of the rules below depends on it.
+ */
+static const struct {
+  YYCODETYPE lhs;     // Symbol on the left-hand side of the rule
+  unsigned char nrhs; // Number of right-hand side symbols in the rule
+} yyRuleInfo[] = {
+// clang-format off
+  { 8, 1 },
+  { 9, 2 },
+  { 9, 1 },
+  { 10, 1 },
+  { 10, 4 },
+  { 11, 2 },
+  { 12, 0 },
+  { 12, 1 },
+// clang-format on
+};
+
+static void yy_accept(yyParser *); // Forward Declaration
+
+/* Perform a reduce action and the shift that must immediately
+ * follow the reduce.
+ */
+static void
+yy_reduce(yyParser *yypParser, // The parser
+          int yyruleno         // Number of the rule by which to reduce
+          ) {
+  int yygoto;              // The next state
+  int yyact;               // The next action
+  YYMINORTYPE yygotominor; // The LHS of the rule reduced
+  yyStackEntry *yymsp;     // The top of the parser's stack
+  int yysize;              // Amount to pop the stack
+  ParseARG_FETCH;
+  yymsp = &yypParser->yystack[yypParser->yyidx];
+#ifndef NDEBUG
+  if (yyTraceFILE && yyruleno >= 0 && yyruleno < (int)(sizeof(yyRuleName) / sizeof(yyRuleName[0]))) {
+    fprintf(yyTraceFILE, "%sReduce [%s].\n", yyTracePrompt, yyRuleName[yyruleno]);
+  }
+#endif /* NDEBUG */
+
+  /* Silence complaints from purify about yygotominor being uninitialized
+   * in some cases when it is copied into the stack after the following
+   * switch.  yygotominor is uninitialized when a rule reduces that does
+   * not set the value of its left-hand side nonterminal.  Leaving the
+   * value of the nonterminal uninitialized is utterly harmless as long
+   * as the value is never used.  So really the only thing this code
+   * accomplishes is to quieten purify.
+   *
+   * 2007-01-16:  The wireshark project (www.wireshark.org) reports that
+   * without this code, their parser segfaults.  I'm not sure what there
+   * parser is doing to make this happen.  This is the second bug report
+   * from wireshark this week.  Clearly they are stressing Lemon in ways
+   * that it has not been previously stressed...  (SQLite ticket #2172)
+   */
+  yygotominor = yyzerominor;
+#ifdef YYBOXTYPES
+  /* A boxed left-hand side is built in the box above the top of the
+   * stack.  The action moves it down once the right-hand side is done.
+   * The box still holds whatever was built in it last, so it is zeroed
+   * here as yygotominor is above.
+   */
+  yygotominor.yybox = yyBoxAt(yypParser, yypParser->yyidx + 1);
+  memset(yygotominor.yybox, 0, sizeof(*yygotominor.yybox));
+#endif
+
+  switch (yyruleno) {
+    /* Beginning here are the reduction cases.  A typical example
+     * follows:
+     *   case 0:
+     *  #line <lineno> <grammarfile>
+     *     { ... }           // User supplied code
+     *  #line <lineno> <thisfile>
+     *     break;
+     */
+// clang-format off
+      case 0: /* start ::= list */
+      case 2: /* list ::= item */ yytestcase(yyruleno==2);
+      case 3: /* item ::= x */ yytestcase(yyruleno==3);
+#line 8 "multiterminal.y"
+{ yygotominor.yy0 = yymsp[0].minor.yy0; }
+#line 1184 "multiterminal.c"
+        break;
+      default:
+      /* (1) list ::= list item */ yytestcase(yyruleno==1);
+      /* (4) item ::= LP z A|B RP */ yytestcase(yyruleno==4);
+      /* (5) x ::= A|B C */ yytestcase(yyruleno==5);
+      /* (6) z ::= */ yytestcase(yyruleno==6);
+      /* (7) z ::= E */ yytestcase(yyruleno==7);
+        break;
+// clang-format on
+  };
+  yygoto = yyRuleInfo[yyruleno].lhs;
+  yysize = yyRuleInfo[yyruleno].nrhs;
+  yypParser->yyidx -= yysize;
+  yyact = yy_find_reduce_action(yymsp[-yysize].stateno, (YYCODETYPE)yygoto);
+  if (yyact < YYNSTATE) {
+#ifdef NDEBUG
+    /* If we are not debugging and the reduce action popped at least
+     * one element off the stack, then we can push the new element back
+     * onto the stack here, and skip the stack overflow test in yy_shift().
+     * That gives a significant speed improvement.
+     */
+    if (yysize) {
+      yypParser->yyidx++;
+      yymsp -= yysize - 1;
+      yymsp->stateno = (YYACTIONTYPE)yyact;
+      yymsp->major = (YYCODETYPE)yygoto;
+      yymsp->minor = yygotominor;
+    } else
+#endif
+    {
+      yy_shift(yypParser, yyact, yygoto, &yygotominor);
+    }
+  } else {
+    assert(yyact == YYNSTATE + YYNRULE + 1);
+    yy_accept(yypParser);
+  }
+}
+
+/* The following code executes when the parse fails */
+#ifndef YYNOERRORRECOVERY
+static void
+yy_parse_failed(yyParser *yypParser // The parser
+                ) {
+  ParseARG_FETCH;
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sFail!\n", yyTracePrompt);
+  }
+#endif
+  while (yypParser->yyidx >= 0)
+    yy_pop_parser_stack(yypParser);
+  /* Here code is inserted which will be executed whenever the
+   * parser fails
+   */
+// clang-format off
+// clang-format on
+  ParseARG_STORE; // Suppress warning about unused %extra_argument variable
+}
+#endif /* YYNOERRORRECOVERY */
+
+/* The following code executes when a syntax error first occurs. */
+static void
+yy_syntax_error(yyParser *yypParser, // The parser
+                int yymajor,         // The major type of the error token
+                YYMINORTYPE yyminor  // The minor type of the error token
+                ) {
+  ParseARG_FETCH;
+#define TOKEN (yyminor.yy0)
+// clang-format off
+// clang-format on
+  ParseARG_STORE; // Suppress warning about unused %extra_argument variable
+}
+
+/* The following is executed when the parser accepts */
+static void
+yy_accept(yyParser *yypParser // The parser
+          ) {
+  ParseARG_FETCH;
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sAccept!\n", yyTracePrompt);
+  }
+#endif
+  while (yypParser->yyidx >= 0)
+    yy_pop_parser_stack(yypParser);
+  /* Here code is inserted which will be executed whenever the
+   * parser accepts
+   */
+// clang-format off
+// clang-format on
+  ParseARG_STORE; // Suppress warning about unused %extra_argument variable
+}
+
+/* The main parser program.
+ * The first argument is a pointer to a structure obtained from
+ * "ParseAlloc" which describes the current state of the parser.
+ * The second argument is the major token number.  The third is
+ * the minor token.  The fourth optional argument is whatever the
+ * user wants (and specified in the grammar) and is available for
+ * use by the action routines.
+ *
+ * Inputs:
+ * <ul>
+ * <li> A pointer to the parser (an opaque structure.)
+ * <li> The major token number.
+ * <li> The minor token number.
+ * <li> An option argument of a grammar-specified type.
+ * </ul>
+ *
+ * Outputs:
+ * None.
+ */
+void
+Parse(void *yyp,             // The parser
+      int yymajor,           // The major token code number
+      ParseTOKENTYPE yyminor // The value for the token
+      ParseARG_PDECL         // Optional %extra_argument parameter
+      ) {
+  YYMINORTYPE yyminorunion;
+  int yyact;        // The parser action.
+  int yyendofinput; // True if we are at the end of input
+  int yyclass;      // The column of yymajor in the action table
+#ifdef YYERRORSYMBOL
+  int yyerrorhit = 0; // True if yymajor has invoked an error
+#endif
+  yyParser *yypParser; // The parser
+
+  /* (re)initialize the parser, if necessary */
+  yypParser = (yyParser *)yyp;
+  if (yypParser->yyidx < 0) {
+#if YYSTACKDEPTH <= 0
+    if (yypParser->yystksz <= 0) {
+      yyminorunion = yyzerominor;
+      yyStackOverflow(yypParser, &yyminorunion);
+      return;
+    }
+#endif
+    yypParser->yyidx = 0;
+    yypParser->yyerrcnt = -1;
+    yypParser->yystack[0].stateno = 0;
+    yypParser->yystack[0].major = 0;
+  }
+  yyminorunion.yy0 = yyminor;
+  yyendofinput = (yymajor == 0);
+#ifdef YYTOKENCLASS
+  yyclass = yy_token_class[yymajor];
+#else
+  yyclass = yymajor;
+#endif
+  ParseARG_STORE;
+
+#ifndef NDEBUG
+  if (yyTraceFILE) {
+    fprintf(yyTraceFILE, "%sInput %s\n", yyTracePrompt, yyTokenName[yymajor]);
+  }
+#endif
+
+  do {
+    yyact = yy_find_shift_action(yypParser, (YYCODETYPE)yyclass);
+    if (yyact < YYNSTATE) {
+      assert(!yyendofinput); // Impossible to shift the $ token
+      yy_shift(yypParser, yyact, yymajor, &yyminorunion);
+      yypParser->yyerrcnt--;
+      yymajor = YYNOCODE;
+#ifdef YYEAGERREDUCE
+      /* States from YY_MIN_AUTOREDUCE on reduce by their default rule
+       * whatever the next token is, so there is no need to wait for it.
+       * This lets the actions of a complete statement run before the
+       * tokenizer delivers another token.
+       */
+      while (yypParser->yyidx >= 0 && yypParser->yystack[yypParser->yyidx].stateno >= YY_MIN_AUTOREDUCE) {
+        yy_reduce(yypParser, yy_default[yypParser->yystack[yypParser->yyidx].stateno] - YYNSTATE);
+      }
+#endif
+    } else if (yyact < YYNSTATE + YYNRULE) {
+      yy_reduce(yypParser, yyact - YYNSTATE);
+    } else {
+      assert(yyact == YY_ERROR_ACTION);
+#ifdef YYERRORSYMBOL
+      int yymx;
+#endif
+#ifndef NDEBUG
+      if (yyTraceFILE) {
+        fprintf(yyTraceFILE, "%sSyntax Error!\n", yyTracePrompt);
+      }
+#endif
+#ifdef YYERRORSYMBOL
+      /* A syntax error has occurred.
+       * The response to an error depends upon whether or not the
+       * grammar defines an error token "ERROR".
+       *
+       * This is what we do if the grammar does define ERROR:
+       *
+       *  * Call the %syntax_error function.
+       *
+       *  * Begin popping the stack until we enter a state where
+       *    it is legal to shift the error symbol, then shift
+       *    the error symbol.
+       *
+       *  * Set the error count to three.
+       *
+       *  * Begin accepting and shifting new tokens.  No new error
+       *    processing will occur until three tokens have been
+       *    shifted successfully.
+       *
+       */
+      if (yypParser->yyerrcnt < 0) {
+        yy_syntax_error(yypParser, yymajor, yyminorunion);
+      }
+      yymx = yypParser->yystack[yypParser->yyidx].major;
+      if (yymx == YYERRORSYMBOL || yyerrorhit) {
+#ifndef NDEBUG
+        if (yyTraceFILE) {
+          fprintf(yyTraceFILE, "%sDiscard input token %s\n", yyTracePrompt, yyTokenName[yymajor]);
+        }
+#endif
+        yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+        yymajor = YYNOCODE;
+      } else {
+        while (yypParser->yyidx >= 0 && yymx != YYERRORSYMBOL &&
+               (yyact = yy_find_reduce_action(yypParser->yystack[yypParser->yyidx].stateno, YYERRORSYMBOL)) >=
+                   YYNSTATE) {
+          yy_pop_parser_stack(yypParser);
+        }
+        if (yypParser->yyidx < 0 || yymajor == 0) {
+          yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+          yy_parse_failed(yypParser);
+          yymajor = YYNOCODE;
+        } else if (yymx != YYERRORSYMBOL) {
+          YYMINORTYPE u2;
+          u2.YYERRSYMDT = 0;
+          yy_shift(yypParser, yyact, YYERRORSYMBOL, &u2);
+        }
+      }
+      yypParser->yyerrcnt = 3;
+      yyerrorhit = 1;
+#elif defined(YYNOERRORRECOVERY)
+      /* If the YYNOERRORRECOVERY macro is defined, then do not attempt to
+       * do any kind of error recovery.  Instead, simply invoke the syntax
+       * error routine and continue going as if nothing had happened.
+       *
+       * Applications can set this macro (for example inside %include) if
+       * they intend to abandon the parse upon the first syntax error seen.
+       */
+      yy_syntax_error(yypParser, yymajor, yyminorunion);
+      yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+      yymajor = YYNOCODE;
+
+#else // YYERRORSYMBOL is not defined
+      /* This is what we do if the grammar does not define ERROR:
+       *
+       *  * Report an error message, and throw away the input token.
+       *
+       *  * If the input token is $, then fail the parse.
+       *
+       * As before, subsequent error messages are suppressed until
+       * three input tokens have been successfully shifted.
+       */
+      if (yypParser->yyerrcnt <= 0) {
+        yy_syntax_error(yypParser, yymajor, yyminorunion);
+      }
+      yypParser->yyerrcnt = 3;
+      yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+      if (yyendofinput) {
+        yy_parse_failed(yypParser);
+      }
+      yymajor = YYNOCODE;
+#endif
+    }
+  } while (yymajor != YYNOCODE && yypParser->yyidx >= 0);
+  return;
+}
+
+#ifdef YYPARSEPOOL
+#ifndef YYSYNCTOKEN
+#error "YYPARSEPOOL requires a %sync_token declaration in the grammar"
+#endif
+#include <pthread.h>
+
+/* The parallel driver.  The input is split into segments after every
+ * YYSYNCTOKEN, and every segment is parsed as a complete input on one of
+ * a pool of parsers, each owned by a worker thread.  The generated tables
+ * are read-only, so the parsers share nothing but the job below.
+ */
+typedef struct yyPoolJob {
+  const int *aMajor;            // Major token codes of the whole input
+  const ParseTOKENTYPE *aMinor; // Minor token values of the whole input
+  const int *aStart;            // First token of each segment, then nToken
+  int nSegment;                 // Number of segments
+  int iNext;                    // Next segment to hand out
+  void **apArg;                 // The %extra_argument of each segment
+  void *(*xArg)(void *, int);   // Makes the argument of a segment
+  void *pCtx;                   // First argument to xArg
+  pthread_mutex_t mutex;        // Protects iNext
+} yyPoolJob;
+
+/* Parse segments until the job runs out of them.  A worker that gets no
+ * parser leaves the segments to the others.
+ */
+static void *
+yy_pool_worker(void *pArg) {
+  yyPoolJob *pJob = (yyPoolJob *)pArg;
+  yyParser *pParser;
+  int i, j;
+
+  pParser = (yyParser *)ParseAlloc();
+  if (pParser == 0)
+    return 0;
+  for (;;) {
+    pthread_mutex_lock(&pJob->mutex);
+    i = pJob->iNext;
+    if (i < pJob->nSegment)
+      pJob->iNext++;
+    pthread_mutex_unlock(&pJob->mutex);
+    if (i >= pJob->nSegment)
+      break;
+    pArg = pJob->xArg(pJob->pCtx, i);
+    pJob->apArg[i] = pArg;
+    for (j = pJob->aStart[i]; j < pJob->aStart[i + 1]; j++) {
+      Parse(pParser, pJob->aMajor[j], pJob->aMinor[j] ParseARG_PARAM(pArg));
+    }
+    Parse(pParser, 0, yyzerominor.yy0 ParseARG_PARAM(pArg));
+    /* A segment that failed without recovering may leave symbols behind */
+    while (pParser->yyidx >= 0) {
+      yy_pop_parser_stack(pParser);
+    }
+  }
+  ParseFree(pParser);
+  return 0;
+}
+
+/* Parse the "nToken" tokens in aMajor[] and aMinor[] on "nThread" threads.
+ * The input does not include the final end-of-input token; every segment
+ * gets its own.
+ *
+ * "xArg" is called from the worker threads, once per segment and before
+ * its first token, to make the %extra_argument the segment is parsed with,
+ * so the %extra_argument must be a pointer.  Once the workers are done,
+ * "xMerge" is called from this thread with each of those arguments, in
+ * input order.
+ *
+ * Outputs:
+ * Zero on success, or non-zero if memory ran out.  If no thread could get
+ * a parser for the last segments, xMerge is called only for the segments
+ * before them, which are all that have an argument.
+ */
+int
+ParseParallel(const int *aMajor,                       // Major token codes
+              const ParseTOKENTYPE *aMinor,            // Minor token values
+              int nToken,                              // Number of tokens
+              int nThread,                             // Number of threads
+              void *(*xArg)(void *, int),              // Argument of a segment
+              void (*xMerge)(void *, int, void *),     // Merges a segment
+              void *pCtx                               // First argument to xArg and xMerge
+              ) {
+  yyPoolJob job;
+  pthread_t *aThread;
+  int *aStart;
+  int i, nSegment, nStarted;
+
+  nSegment = 0;
+  for (i = 0; i < nToken; i++) {
+    if (aMajor[i] == YYSYNCTOKEN || i == nToken - 1)
+      nSegment++;
+  }
+  aStart = (int *)malloc((nSegment + 1) * sizeof(aStart[0]));
+  job.apArg = (void **)malloc((nSegment + 1) * sizeof(job.apArg[0]));
+  if (nThread > nSegment)
+    nThread = nSegment;
+  if (nThread < 1)
+    nThread = 1;
+  aThread = (pthread_t *)malloc(nThread * sizeof(aThread[0]));
+  if (aStart == 0 || job.apArg == 0 || aThread == 0) {
+    free(aStart);
+    free(job.apArg);
+    free(aThread);
+    return 1;
+  }
+  nSegment = 0;
+  aStart[0] = 0;
+  for (i = 0; i < nToken; i++) {
+    if (aMajor[i] == YYSYNCTOKEN || i == nToken - 1)
+      aStart[++nSegment] = i + 1;
+  }
+
+  job.aMajor = aMajor;
+  job.aMinor = aMinor;
+  job.aStart = aStart;
+  job.nSegment = nSegment;
+  job.iNext = 0;
+  job.xArg = xArg;
+  job.pCtx = pCtx;
+  pthread_mutex_init(&job.mutex, 0);
+  for (nStarted = 0; nStarted < nThread; nStarted++) {
+    if (pthread_create(&aThread[nStarted], 0, yy_pool_worker, &job) != 0)
+      break;
+  }
+  for (i = 0; i < nStarted; i++) {
+    pthread_join(aThread[i], 0);
+  }
+  if (job.iNext < nSegment)
+    yy_pool_worker(&job); // No threads or no parsers to be had: parse the rest here
+  pthread_mutex_destroy(&job.mutex);
+
+  /* The segments are handed out in order, so those parsed come first */
+  for (i = 0; i < job.iNext; i++) {
+    xMerge(pCtx, i, job.apArg[i]);
+  }
+  free(aStart);
+  free(job.apArg);
+  free(aThread);
+  return job.iNext < nSegment;
+}
+#endif /* YYPARSEPOOL */
@@ -0,0 +1,21 @@
+/* An expression grammar with a chain of four unit rules, expr ::= add,
+ * add ::= mul, mul ::= unary and unary ::= primary.  See bench.sh.
+ */
+%token_type {int}
+%type expr {int}
+%type add {int}
+%type mul {int}
+%type unary {int}
+%type primary {int}
+%extra_argument {int *pResult}
+%syntax_error { *pResult = -1; }
+prog ::= expr(A). { *pResult = A; }
+expr ::= add.
+add(X) ::= add(A) PLUS mul(B). { X = A + B; }
+add ::= mul.
+mul(X) ::= mul(A) TIMES unary(B). { X = A * B; }
+mul ::= unary.
+unary(X) ::= MINUS unary(B). { X = -B; }
+unary ::= primary.
+primary(X) ::= INT(A). { X = A; }
+primary(X) ::= LP expr(A) RP. { X = A; }
@@ -0,0 +1,38 @@
+/* Evaluate the expression given as the first argument with the parser
+ * that lemon made from expr.y.  With a second argument, the parser
+ * traces to stdout.  See bench.sh.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "expr.c"
+
+int
+main(int argc, char **argv) {
+  const char *z = argc > 1 ? argv[1] : "";
+  int r = 0;
+  void *p = ParseAlloc();
+
+#ifndef NDEBUG
+  if (argc > 2)
+    ParseTrace(stdout, "T: ");
+#endif
+  for (; *z; z++) {
+    if (*z >= '0' && *z <= '9')
+      Parse(p, INT, *z - '0', &r);
+    else if (*z == '+')
+      Parse(p, PLUS, 0, &r);
+    else if (*z == '*')
+      Parse(p, TIMES, 0, &r);
+    else if (*z == '-')
+      Parse(p, MINUS, 0, &r);
+    else if (*z == '(')
+      Parse(p, LP, 0, &r);
+    else if (*z == ')')
+      Parse(p, RP, 0, &r);
+  }
+  Parse(p, 0, 0, &r);
+  ParseFree(p);
+  printf("%s = %d\n", argc > 1 ? argv[1] : "", r);
+  return 0;
+}
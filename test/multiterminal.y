@@ -0,0 +1,15 @@
+/* Compounds written into the right-hand side of rules, as in "A|B".
+ * They are in no symbol table, yet their constituents have to show up
+ * in the first sets of x, item and list, and in the follow-set of z.
+ * Built with -c, the states of multiterminal.out that begin an item
+ * shift A and B, and the state after LP reduces z ::= . on A and B.
+ * test/run.sh compares the output with test/expected.
+ */
+start ::= list.
+list ::= list item.
+list ::= item.
+item ::= x.
+item ::= LP z A|B RP.
+x ::= A|B C.
+z ::= .
+z ::= E.
@@ -0,0 +1,50 @@
+#!/bin/sh
+# Run lemon on the grammars of this directory and compare the parser
+# and the report it writes with those in test/expected.
+#
+#   test/run.sh path/to/lemon
+#
+# With UPDATE=1 in the environment, the expected files are written
+# instead.  The exit code is the number of files that differ.
+
+LEMON=${1:-./lemon}
+case $LEMON in
+/*) ;;
+*) LEMON=$(pwd)/$LEMON ;;
+esac
+TEST=$(cd "$(dirname "$0")" && pwd)
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+FAILED=0
+
+# check NAME GRAMMAR [OPTIONS...]
+#   Build GRAMMAR with OPTIONS and compare NAME.c and NAME.out.
+check() {
+  name=$1
+  grammar=$2
+  shift 2
+  rm -rf "$WORK/$name"
+  mkdir "$WORK/$name"
+  cp "$TEST/$grammar" "$WORK/$name/$name.y"
+  if ! (cd "$WORK/$name" && "$LEMON" "$@" "$name.y" >/dev/null 2>&1); then
+    echo "$name: lemon failed"
+    FAILED=$((FAILED + 1))
+    return
+  fi
+  for ext in c out; do
+    if [ -n "$UPDATE" ]; then
+      cp "$WORK/$name/$name.$ext" "$TEST/expected/$name.$ext"
+    elif ! cmp -s "$WORK/$name/$name.$ext" "$TEST/expected/$name.$ext"; then
+      echo "$name.$ext differs"
+      diff -u "$TEST/expected/$name.$ext" "$WORK/$name/$name.$ext" | head -20
+      FAILED=$((FAILED + 1))
+    fi
+  done
+}
+
+check multiterminal multiterminal.y -c
+check expr expr.y
+check tokclass tokclass.y
+
+[ $FAILED -eq 0 ] && echo "all passed"
+exit $FAILED
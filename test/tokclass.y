@@ -0,0 +1,25 @@
+/* Twenty-four keywords that the grammar only uses through one
+ * %token_class.  Their action columns are identical, so the generated
+ * parser maps them all to one token class.  See bench.sh.
+ */
+%name Tc
+%token_type {int}
+%extra_argument {struct ctx *ctx}
+%include {
+struct ctx { int sum, nerr, nrec, acc, fail, ndes; };
+}
+%syntax_error { ctx->nerr++; }
+%parse_accept { ctx->acc++; }
+%parse_failure { ctx->fail++; }
+%token_destructor { ctx->ndes++; (void)$$; }
+%token_class kw K1|K2|K3|K4|K5|K6|K7|K8|K9|K10|K11|K12|K13|K14|K15|K16|K17|K18|K19|K20|K21|K22|K23|K24.
+%left PLUS.
+program ::= list.
+list ::= list stmt.
+list ::= .
+stmt ::= kw(K) expr(E) SEMI. { ctx->sum += K * E; }
+stmt ::= ID EQ expr(E) SEMI. { ctx->sum += E; }
+stmt ::= error SEMI. { ctx->nrec++; }
+expr(A) ::= expr(B) PLUS expr(C). { A = B + C; }
+expr(A) ::= INT(N). { A = N; }
+%type expr {int}